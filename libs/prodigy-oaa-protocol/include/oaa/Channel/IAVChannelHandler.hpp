@@ -2,6 +2,7 @@
 
 #include <oaa/Channel/IChannelHandler.hpp>
 #include <cstdint>
+#include <memory>
 
 namespace oaa {
 
@@ -13,6 +14,28 @@ public:
 
     virtual void onMediaData(const QByteArray& data, uint64_t timestamp) = 0;
     virtual bool canAcceptMedia() const = 0;
+
+    /// Media entry point used by AASession: the full assembled message plus
+    /// the offset of the media bytes (past message ID and timestamp).
+    /// @p hasTimestamp is false for AV_MEDIA_INDICATION, which carries none;
+    /// @p timestamp is then 0. The default copies the media bytes out and
+    /// forwards to onMediaData(); handlers that retain frames override it to
+    /// keep a shared view instead.
+    virtual void onMediaPayload(const QByteArray& payload, int dataOffset,
+                                uint64_t timestamp, bool hasTimestamp);
+
+    /// Ref-counted view of payload[dataOffset..] without copying the bytes.
+    /// The returned array wraps the payload's storage and the pointer keeps
+    /// that storage alive; hold the pointer, not a copy of the array.
+    static std::shared_ptr<const QByteArray> sharePayload(const QByteArray& payload,
+                                                          int dataOffset);
+
+    /// Route AV_MEDIA_WITH_TIMESTAMP / AV_MEDIA_INDICATION to onMediaPayload()
+    /// when @p handler is an AV handler, splitting off the 8-byte BE timestamp.
+    /// Returns false when the message is not media for an AV handler and
+    /// should go to onMessage() instead.
+    static bool dispatchMedia(IChannelHandler* handler, uint16_t messageId,
+                              const QByteArray& payload, int dataOffset);
 };
 
 } // namespace oaa
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <QObject>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace oaa {
+
+/// How a media channel hands send permits back to the phone.
+struct MediaAckPolicy {
+    enum class Mode {
+        /// One AVMediaAckIndication (ack_count = 1) per accepted frame.
+        Immediate,
+        /// One indication per event-loop turn carrying every permit owed, or
+        /// earlier once flushThreshold permits are pending.
+        Coalesced,
+    };
+
+    Mode mode = Mode::Immediate;
+    /// Coalesced only. 0 selects half the advertised window; any value is
+    /// clamped to [1, max_unacked] so the phone can never stall on permits.
+    uint32_t flushThreshold = 0;
+
+    /// Back-pressure, for channels given a backlog probe (video): while the
+    /// consumer has at least holdBacklog frames queued, permits are held
+    /// instead of returned, so the max_unacked window throttles the phone at
+    /// the source. 0 disables.
+    uint32_t holdBacklog = 0;
+    /// Held permits go out after this long even if the backlog persists, so a
+    /// stuck consumer cannot stall the phone indefinitely.
+    uint32_t maxHoldMs = 100;
+};
+
+/// Accumulates media ACK permits for one channel and emits them through
+/// @p sender as a single ack_count. The deferred flush is queued on
+/// @p context, so it runs on the handler's own thread and is dropped with it.
+/// With a backlog probe and MediaAckPolicy::holdBacklog set, permits are
+/// withheld while the consumer is behind; the hold is re-checked every few
+/// milliseconds on @p context and released in one indication.
+class MediaAckCoalescer {
+public:
+    using Sender = std::function<void(uint32_t ackCount)>;
+    /// Frames accepted but not yet consumed downstream. Called on the
+    /// handler's thread, so it must be safe to call from there.
+    using BacklogProbe = std::function<uint32_t()>;
+    /// Monotonic microseconds; times holds against maxHoldMs.
+    using ClockFn = std::function<qint64()>;
+
+    MediaAckCoalescer(QObject* context, uint32_t window, Sender sender);
+
+    void setPolicy(const MediaAckPolicy& policy) { policy_ = policy; }
+    const MediaAckPolicy& policy() const { return policy_; }
+    /// The max_unacked value advertised in the channel's setup response.
+    uint32_t window() const { return window_; }
+    uint32_t flushThreshold() const;
+    uint32_t pending() const { return pending_; }
+
+    void setBacklogProbe(BacklogProbe probe) { probe_ = std::move(probe); }
+    void setClockForTest(ClockFn fn) { now_ = std::move(fn); }
+    bool isHolding() const { return holding_; }
+    /// Hold statistics; readable from any thread.
+    uint64_t holdCount() const { return holdCount_.load(); }
+    uint64_t holdTimeoutCount() const { return holdTimeouts_.load(); }
+    uint64_t heldPermitCount() const { return heldPermits_.load(); }
+    uint64_t heldUs() const { return heldUs_.load(); }
+
+    /// One frame accepted: the phone is owed one permit.
+    void frameConsumed();
+    /// Send every pending permit now, as one indication. No-op when none.
+    void flush();
+    /// Forget pending permits without sending them (channel open/close).
+    void reset();
+
+private:
+    static constexpr int kHoldPollMs = 2;
+
+    bool backlogHigh() const;
+    void scheduleHoldPoll();
+    void pollHold();
+    void endHold();
+
+    QObject* context_;
+    uint32_t window_;
+    Sender sender_;
+    MediaAckPolicy policy_;
+    BacklogProbe probe_;
+    ClockFn now_;
+    uint32_t pending_ = 0;
+    bool flushScheduled_ = false;
+    bool holding_ = false;
+    bool holdPollScheduled_ = false;
+    qint64 holdStartUs_ = 0;
+    std::atomic<uint64_t> holdCount_{0};
+    std::atomic<uint64_t> holdTimeouts_{0};
+    std::atomic<uint64_t> heldPermits_{0};
+    std::atomic<uint64_t> heldUs_{0};
+    // Bumped by reset() so a flush queued for the old stream is ignored.
+    uint64_t epoch_ = 0;
+};
+
+} // namespace oaa
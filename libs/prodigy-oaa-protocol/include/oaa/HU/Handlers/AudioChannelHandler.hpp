@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <QString>
 #include <oaa/Channel/IAVChannelHandler.hpp>
+#include <oaa/Channel/MediaAckCoalescer.hpp>
 #include <oaa/Channel/MessageIds.hpp>
-#include <QString>
 
 namespace oaa {
 namespace hu {
@@ -22,6 +24,13 @@ public:
     void onMediaData(const QByteArray& data, uint64_t timestamp) override;
     bool canAcceptMedia() const override { return channelOpen_ && streaming_; }
 
+    void setAckPolicy(const oaa::MediaAckPolicy& policy) { acks_.setPolicy(policy); }
+    uint64_t receivedFrameCount() const { return receivedFrameCount_.load(); }
+    /// ACK_INDICATION messages sent; below receivedFrameCount() when coalescing.
+    uint64_t ackCount() const { return ackCount_.load(); }
+    /// Permits returned to the phone across all ACK messages.
+    uint64_t ackedFrameCount() const { return ackedFrameCount_.load(); }
+
 signals:
     void audioDataReceived(const QByteArray& data, uint64_t timestamp);
     void streamStarted(int32_t session);
@@ -37,13 +46,17 @@ private:
     void handleStartIndication(const QByteArray& payload);
     void handleMediaOptions(const QByteArray& payload);
     void handleStopIndication();
-    void sendAck();
+    void sendAck(uint32_t count);
 
     uint8_t channelId_;
     oaa::SessionProtocolPolicy protocolPolicy_;
     int32_t session_ = -1;
     bool channelOpen_ = false;
     bool streaming_ = false;
+    std::atomic<uint64_t> receivedFrameCount_{0};
+    std::atomic<uint64_t> ackCount_{0};
+    std::atomic<uint64_t> ackedFrameCount_{0};
+    oaa::MediaAckCoalescer acks_;
 };
 
 } // namespace hu
@@ -5,6 +5,7 @@
 #include <QMap>
 #include <QString>
 #include <oaa/Channel/IAVChannelHandler.hpp>
+#include <oaa/Channel/MediaAckCoalescer.hpp>
 #include <oaa/Channel/ChannelId.hpp>
 #include <oaa/Channel/MessageIds.hpp>
 #include <oaa/video/VideoFocusModeEnum.pb.h>
@@ -27,6 +28,8 @@ public:
 
     // IAVChannelHandler
     void onMediaData(const QByteArray& data, uint64_t timestamp) override;
+    void onMediaPayload(const QByteArray& payload, int dataOffset,
+                        uint64_t timestamp, bool hasTimestamp) override;
     bool canAcceptMedia() const override { return channelOpen_ && streaming_; }
 
     // Video focus control — called by orchestrator
@@ -34,13 +37,34 @@ public:
 
     /// Set how many video configs were advertised (for setup response)
     void setNumVideoConfigs(uint32_t n) { numVideoConfigs_ = n; }
+    void setAckPolicy(const oaa::MediaAckPolicy& policy) { acks_.setPolicy(policy); }
+    /// Reports the decoder's queue depth for MediaAckPolicy::holdBacklog.
+    /// Called on this handler's thread.
+    void setBacklogProbe(oaa::MediaAckCoalescer::BacklogProbe probe)
+    {
+        acks_.setBacklogProbe(std::move(probe));
+    }
+    void setAckClockForTest(oaa::MediaAckCoalescer::ClockFn fn)
+    {
+        acks_.setClockForTest(std::move(fn));
+    }
+    /// Times ACKs were withheld for back-pressure, and for how long in total.
+    uint64_t ackHoldCount() const { return acks_.holdCount(); }
+    uint64_t ackHoldTimeoutCount() const { return acks_.holdTimeoutCount(); }
+    uint64_t ackHeldUs() const { return acks_.heldUs(); }
     uint64_t receivedFrameCount() const { return receivedFrameCount_.load(); }
+    /// ACK_INDICATION messages sent; below receivedFrameCount() when coalescing.
     uint64_t ackCount() const { return ackCount_.load(); }
+    /// Permits returned to the phone across all ACK messages.
+    uint64_t ackedFrameCount() const { return ackedFrameCount_.load(); }
 
 signals:
     void setupRequested(int codec);
     void handlerError(const QString& message);
-    void videoFrameData(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs);
+    /// @p phoneTimestampUs is the AV_MEDIA_WITH_TIMESTAMP value, -1 when the
+    /// phone sent none.
+    void videoFrameData(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs,
+                        qint64 phoneTimestampUs);
     void streamStarted(int32_t session, uint32_t configIndex);
     void streamStartDetailsReceived(int32_t sessionId, uint32_t configIndex,
                                     int sessionType, bool hasMediaConfig,
@@ -52,13 +76,15 @@ signals:
                                  const QMap<QString, uint32_t>& nightTokens);
 
 private:
+    static constexpr uint32_t MAX_UNACKED = 10;
+
     void handleSetupRequest(const QByteArray& payload);
     void handleStartIndication(const QByteArray& payload);
     void handleMediaOptions(const QByteArray& payload);
     void handleStopIndication();
     void handleVideoFocusRequest(const QByteArray& payload);
     void handleVideoFocusIndication(const QByteArray& payload);
-    void sendAck();
+    void sendAck(uint32_t count);
 
     uint8_t channelId_ = oaa::ChannelId::Video;
     oaa::proto::enums::VideoFocusMode::Enum setupFocusMode_
@@ -69,6 +95,8 @@ private:
     bool streaming_ = false;
     std::atomic<uint64_t> receivedFrameCount_{0};
     std::atomic<uint64_t> ackCount_{0};
+    std::atomic<uint64_t> ackedFrameCount_{0};
+    oaa::MediaAckCoalescer acks_;
 };
 
 } // namespace hu
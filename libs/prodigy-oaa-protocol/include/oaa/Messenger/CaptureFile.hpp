@@ -0,0 +1,97 @@
+#pragma once
+
+#include <QByteArray>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include <oaa/Messenger/FrameType.hpp>
+
+namespace oaa {
+
+/// Binary session capture: decrypted, timestamped, channel-tagged messages as
+/// they crossed the Messenger. Written by ProtocolLogger in
+/// OutputFormat::Binary, read back by CaptureReader and replayed by
+/// SessionReplayer.
+///
+/// All integers are little-endian.
+///
+///   file header (16 bytes)
+///     char[8]  magic "OAACAP\r\n"
+///     u16      version
+///     u16      header size (readers skip unknown trailing header bytes)
+///     u32      file flags (FileFlag)
+///   record (16-byte header + payload), repeated to end of file
+///     u64      microseconds since the capture was opened
+///     u32      payload size
+///     u16      message ID
+///     u8       channel ID
+///     u8       record flags (RecordFlag)
+///     payload  message body after the 2-byte message ID, or for Digest
+///              records u64 FNV-1a digest + u32 original size
+namespace capture {
+
+constexpr char kMagic[8] = {'O', 'A', 'A', 'C', 'A', 'P', '\r', '\n'};
+constexpr uint16_t kVersion = 1;
+constexpr int kFileHeaderSize = 16;
+constexpr int kRecordHeaderSize = 16;
+/// Upper bound on a single record; anything larger is treated as corruption.
+constexpr uint32_t kMaxPayloadSize = 64u * 1024 * 1024;
+constexpr int kDigestPayloadSize = 12;
+
+enum FileFlag : uint32_t {
+    IncludesMedia  = 1u << 0,
+    PayloadDigests = 1u << 1,  // every record is a Digest record
+};
+
+enum RecordFlag : uint8_t {
+    Outbound       = 1u << 0,  // HU->Phone
+    ControlMessage = 1u << 1,  // MessageType::Control (inbound only)
+    Digest         = 1u << 2,
+    GapBefore      = 1u << 3,  // the logger dropped messages just before this one
+};
+
+void writeFileHeader(std::ostream& out, uint32_t fileFlags);
+void writeRecord(std::ostream& out, uint64_t timestampUs, uint8_t channelId,
+                 uint16_t messageId, uint8_t recordFlags,
+                 const uint8_t* payload, size_t payloadSize);
+void writeRecord(std::string& out, uint64_t timestampUs, uint8_t channelId,
+                 uint16_t messageId, uint8_t recordFlags,
+                 const uint8_t* payload, size_t payloadSize);
+
+} // namespace capture
+
+struct CaptureRecord {
+    uint64_t timestampUs = 0;
+    uint8_t channelId = 0;
+    uint16_t messageId = 0;
+    MessageType messageType = MessageType::Specific;
+    bool outbound = false;
+    bool digestOnly = false;
+    bool gapBefore = false;
+    QByteArray payload;
+};
+
+/// Sequential reader for binary session captures.
+class CaptureReader {
+public:
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file_.is_open(); }
+    uint32_t fileFlags() const { return fileFlags_; }
+
+    /// Read the next record. Returns false at end of file and on a damaged
+    /// record; error() is empty only for a clean end. A capture cut off by a
+    /// crash ends with a truncated record, so everything before it is usable.
+    bool next(CaptureRecord& record);
+    const std::string& error() const { return error_; }
+
+private:
+    std::ifstream file_;
+    uint32_t fileFlags_ = 0;
+    std::string error_;
+};
+
+} // namespace oaa
@@ -59,6 +59,20 @@ public:
         return result;
     }
 
+    // Copy len bytes into caller storage without allocating. Used for the
+    // fixed-size frame header/size fields, which may straddle the wrap point.
+    void peekInto(char* dst, size_t len) const
+    {
+        assert(len <= m_size);
+        len = std::min(len, m_size);
+
+        size_t firstChunk = std::min(len, m_capacity - m_readPos);
+        std::memcpy(dst, m_data.data() + m_readPos, firstChunk);
+        if (firstChunk < len) {
+            std::memcpy(dst + firstChunk, m_data.data(), len - firstChunk);
+        }
+    }
+
     const char* readPtr(size_t& contigLen) const
     {
         if (m_size == 0) {
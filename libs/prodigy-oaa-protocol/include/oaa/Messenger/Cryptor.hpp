@@ -44,12 +44,29 @@ public:
     QString lastError() const;
     DataResult readHandshakeBuffer();
     bool writeHandshakeBuffer(const QByteArray& data);
+    /// Queue TLS records that arrive outside an encrypted frame once the
+    /// handshake is done (TLS 1.3 session tickets, key updates). The next
+    /// decrypt consumes them ahead of its frame, in either BIO mode.
+    bool queueTlsInput(const QByteArray& data);
 
     DataResult encrypt(const QByteArray& plaintext);
+    /// Encrypt @p size bytes and append the TLS records to @p out. In record
+    /// mode OpenSSL writes straight into @p out's storage. On success the
+    /// result carries no data; @p out keeps any partial output on failure.
+    DataResult encryptInto(const char* plaintext, int size, QByteArray& out);
     DataResult decrypt(const QByteArray& ciphertext, int frameLength);
 
     bool isActive() const;
 
+    /// Record mode replaces the memory BIO pair once the handshake is done
+    /// and both BIOs are drained. From then on OpenSSL reads ciphertext from
+    /// the caller's frame and writes records into the caller's output buffer.
+    /// Enabled by default; disabling it keeps the memory-BIO path (used as
+    /// the baseline in the throughput benchmark). Takes effect on the next
+    /// encrypt/decrypt and cannot revert a session already switched.
+    void setRecordIoEnabled(bool enabled) { m_recordIoEnabled = enabled; }
+    bool usesRecordIo() const { return m_recordBio != nullptr; }
+
 private:
     SSL_CTX* m_ctx = nullptr;
     SSL* m_ssl = nullptr;
@@ -58,8 +75,36 @@ private:
     bool m_active = false;
     QString m_lastError;
 
+    // Caller buffers the record BIO reads from and appends to. Only set for
+    // the duration of one SSL_read/SSL_write.
+    struct RecordIo {
+        const char* input = nullptr;
+        int inputSize = 0;
+        int inputOffset = 0;
+        QByteArray* output = nullptr;
+        // queueTlsInput() bytes, read before the frame; kept across calls.
+        QByteArray queued;
+        int queuedOffset = 0;
+    };
+    BIO* m_recordBio = nullptr; // owned by m_ssl once installed
+    RecordIo m_recordIo;
+    // Records OpenSSL emits while reading (alerts, key updates); they lead
+    // the next encrypt output so the wire order matches the memory-BIO path.
+    QByteArray m_deferredOutput;
+    bool m_recordIoEnabled = true;
+
+    bool enterRecordIo();
+    DataResult encryptRecordIo(const char* plaintext, int size, QByteArray& out);
+    DataResult decryptRecordIo(const QByteArray& ciphertext);
+    DataResult readPlaintext(int capacity);
     DataResult readWriteBio(const QString& context);
+    DataResult appendWriteBio(QByteArray& out, const QString& context);
     DataResult failData(const QString& context, int sslError = -1);
+    static BIO_METHOD* recordBioMethod();
+    static int recordBioRead(BIO* bio, char* data, int size);
+    static int recordBioWrite(BIO* bio, const char* data, int size);
+    static long recordBioCtrl(BIO* bio, int cmd, long num, void* ptr);
+    static int recordBioCreate(BIO* bio);
     bool failInitialization(const QString& context, int sslError = -1);
     static QString buildError(const QString& context, int sslError = -1);
 
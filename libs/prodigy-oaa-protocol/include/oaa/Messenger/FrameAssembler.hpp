@@ -19,6 +19,9 @@ public:
                    QObject* parent = nullptr);
     void reset();
 
+    /// Fragment bytes copied into reassembly buffers since construction.
+    quint64 bytesCopied() const { return m_bytesCopied; }
+
 public slots:
     void onFrame(const oaa::FrameHeader& header, const QByteArray& payload);
 
@@ -44,6 +47,7 @@ private:
     uint64_t m_reservedBytes = 0;
     uint32_t m_maxMessageSize = MAX_ASSEMBLED_MESSAGE_SIZE;
     uint64_t m_maxAggregateSize = MAX_IN_FLIGHT_ASSEMBLY_SIZE;
+    quint64 m_bytesCopied = 0;
 };
 
 } // namespace oaa
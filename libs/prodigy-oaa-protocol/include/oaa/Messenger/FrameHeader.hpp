@@ -15,7 +15,10 @@ struct FrameHeader {
     uint32_t totalMessageSize = 0;
 
     static FrameHeader parse(const QByteArray& data);
+    static FrameHeader parse(const char* data);
     QByteArray serialize() const;
+    /// Write the two header bytes at @p dst without allocating.
+    void serializeTo(char* dst) const;
     static int sizeFieldLength(FrameType type);
 };
 
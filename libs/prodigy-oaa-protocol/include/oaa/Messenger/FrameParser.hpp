@@ -15,6 +15,13 @@ public:
     explicit FrameParser(QObject* parent = nullptr);
     void reset();
 
+    /// Frames emitted since construction (not cleared by reset()).
+    quint64 framesParsed() const { return m_framesParsed; }
+    /// Bytes memcpy'd by the parser since construction: partial-frame bytes
+    /// staged in the ring plus the payloads emitted from them. Whole frames
+    /// in a transport chunk are emitted as shared slices of it and cost none.
+    quint64 bytesCopied() const { return m_bytesCopied; }
+
 public slots:
     void onData(const QByteArray& data);
 
@@ -28,6 +35,7 @@ private:
         ReadPayload
     };
 
+    size_t parseContiguous(const QByteArray& chunk);
     void process();
 
     State m_state = State::ReadHeader;
@@ -35,6 +43,9 @@ private:
     FrameHeader m_currentHeader{};
     int m_sizeFieldLength = 0;
     uint16_t m_framePayloadSize = 0;
+    quint64 m_resetCount = 0;
+    quint64 m_framesParsed = 0;
+    quint64 m_bytesCopied = 0;
 };
 
 } // namespace oaa
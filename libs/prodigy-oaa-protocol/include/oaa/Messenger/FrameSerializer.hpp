@@ -16,6 +16,26 @@ public:
                                        EncryptionType encType,
                                        const QByteArray& payload);
 
+    /// Append every plaintext frame of one message to @p out with a single
+    /// resize. The big-endian @p messageId is framed in front of @p payload
+    /// without first building a joined copy. Returns the frame count.
+    static int appendMessage(QByteArray& out,
+                             uint8_t channelId,
+                             MessageType msgType,
+                             uint16_t messageId,
+                             const QByteArray& payload);
+
+    /// Number of frames a message of @p messageSize bytes is split into.
+    static int frameCount(int messageSize);
+    /// BULK for a single frame, otherwise FIRST, MIDDLE..., LAST.
+    static FrameType frameTypeFor(int index, int count);
+    /// Header plus size field length of a frame of @p type.
+    static int headerLength(FrameType type);
+    /// Write header and size field at @p dst. @p totalSize is only written
+    /// for FIRST frames.
+    static void writeHeader(char* dst, const FrameHeader& header,
+                            uint16_t frameSize, uint32_t totalSize = 0);
+
 private:
     static QByteArray buildFrame(const FrameHeader& header,
                                  const QByteArray& payload,
@@ -34,6 +34,16 @@ public:
     void startHandshake();
     bool isEncrypted() const;
 
+    /// Receive-path copy accounting since construction. bytesCopied counts
+    /// every payload memcpy between the transport chunk and messageReceived
+    /// (parser staging, memory-BIO TLS staging, fragment reassembly), so
+    /// bytesCopied / frames is the per-frame copy cost.
+    struct ReceiveStats {
+        quint64 frames = 0;
+        quint64 bytesCopied = 0;
+    };
+    ReceiveStats receiveStats() const;
+
 signals:
     void messageReceived(uint8_t channelId, uint16_t messageId,
                          const QByteArray& payload, int dataOffset,
@@ -48,7 +58,8 @@ signals:
 
 private:
     struct SendItem {
-        QList<QByteArray> frames;
+        // Every frame of one message, back to back: one transport write.
+        QByteArray frames;
     };
 
     void onFrameParsed(const FrameHeader& header, const QByteArray& framePayload);
@@ -60,6 +71,9 @@ private:
     void failTls(const QString& message);
     void failProtocol(const QString& message);
     void processSendQueue();
+    bool serializeEncrypted(QByteArray& out, uint8_t channelId,
+                            MessageType msgType, uint16_t messageId,
+                            const QByteArray& payload);
 
     ITransport* transport_;
     FrameParser parser_;
@@ -68,12 +82,14 @@ private:
     EncryptionPolicy encryptionPolicy_;
 
     QQueue<SendItem> sendQueue_;
+    QByteArray sendScratch_;
     bool sending_ = false;
     bool started_ = false;
     bool handshakeFailureEmitted_ = false;
     bool tlsFailureEmitted_ = false;
     bool protocolFailureEmitted_ = false;
     uint64_t lifecycleGeneration_ = 0;
+    quint64 tlsBytesStaged_ = 0;
 };
 
 } // namespace oaa
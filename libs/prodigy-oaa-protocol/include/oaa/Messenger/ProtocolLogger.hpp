@@ -1,19 +1,35 @@
 #pragma once
 
+#include <QByteArray>
 #include <QObject>
+#include <oaa/Messenger/FrameType.hpp>
+#include <oaa/Messenger/SpscQueue.hpp>
 #include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <chrono>
 #include <string>
+#include <thread>
 #include <cstdint>
 
 namespace oaa {
 
 class Messenger;
 
-/// Logs AA protocol messages to a TSV file.
+/// Logs AA protocol messages to a TSV, JSONL or binary capture file.
 /// Attach to a Messenger via attach() — connects to messageReceived and messageSent signals.
+/// The binary format (see CaptureFile.hpp) keeps full decrypted payloads and
+/// microsecond timestamps so a session can be replayed by SessionReplayer.
+///
+/// Logging never blocks the caller: messages are queued on a bounded SPSC
+/// ring (sharing the Messenger's payload, not copying it) and formatted and
+/// written in batches by a background thread. When the ring or its byte
+/// budget is full the message is dropped and counted; the next record that
+/// is written carries the gap. The ring has a single producer: attached
+/// signals are delivered on the logger's thread, and open(), close(), log()
+/// and record() must be called from that thread too.
 class ProtocolLogger : public QObject {
     Q_OBJECT
 
@@ -21,18 +37,38 @@ public:
     enum class OutputFormat {
         Tsv,
         Jsonl,
+        Binary,
     };
 
+    /// Full: hex in JSONL, a 64-byte hex preview in TSV, raw bytes in Binary.
+    /// Digest: payload size plus a 64-bit FNV-1a digest in every format.
+    enum class PayloadMode {
+        Full,
+        Digest,
+    };
+
+    static constexpr size_t kDefaultQueueEntries = 8192;
+    static constexpr size_t kDefaultQueueBytes = 64u * 1024 * 1024;
+
     explicit ProtocolLogger(QObject* parent = nullptr);
     ~ProtocolLogger() override;
 
+    /// Format, payload mode and queue limits are fixed for the file at open().
     void open(const std::string& path = "/tmp/oap-protocol.log");
+    /// Drains everything queued so far, then closes the file.
     void close();
     bool isOpen() const;
     void setFormat(OutputFormat format);
     OutputFormat format() const;
+    void setPayloadMode(PayloadMode mode);
+    PayloadMode payloadMode() const;
     void setIncludeMedia(bool includeMedia);
     bool includeMedia() const;
+    void setQueueLimits(size_t maxEntries, size_t maxBytes);
+
+    /// Messages written / dropped since the last open().
+    uint64_t writtenCount() const { return written_.load(std::memory_order_relaxed); }
+    uint64_t droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
 
     /// Connect to a Messenger's signals for automatic logging
     void attach(Messenger* messenger);
@@ -43,17 +79,58 @@ public:
              uint8_t channelId, uint16_t messageId,
              const uint8_t* payload, size_t payloadSize);
 
+    /// Queue one message. The QByteArray overload shares @p payload from
+    /// @p dataOffset on; the pointer overload copies. log() forwards here
+    /// with MessageType::Specific. Only the binary format records messageType.
+    void record(bool outbound, uint8_t channelId, uint16_t messageId,
+                MessageType messageType, const QByteArray& payload, int dataOffset = 0);
+    void record(bool outbound, uint8_t channelId, uint16_t messageId,
+                MessageType messageType, const uint8_t* payload, size_t payloadSize);
+
     static std::string channelName(uint8_t id);
     static std::string messageName(uint8_t channelId, uint16_t msgId);
 
 private:
+    struct Entry {
+        int64_t elapsedUs = 0;
+        QByteArray payload;
+        int dataOffset = 0;
+        uint32_t droppedBefore = 0;
+        uint16_t messageId = 0;
+        uint8_t channelId = 0;
+        bool outbound = false;
+        MessageType messageType = MessageType::Specific;
+    };
+
+    void stopWriter();
+    void writerLoop();
+    void format(const Entry& entry, std::string& out) const;
+
     std::ofstream file_;
     std::mutex mutex_;
     std::chrono::steady_clock::time_point startTime_;
     std::atomic<bool> open_{false};
     Messenger* messenger_ = nullptr;
     OutputFormat format_ = OutputFormat::Tsv;
-    bool includeMedia_ = true;
+    PayloadMode payloadMode_ = PayloadMode::Full;
+    std::atomic<bool> includeMedia_{true};
+    size_t maxQueueEntries_ = kDefaultQueueEntries;
+    size_t maxQueueBytes_ = kDefaultQueueBytes;
+
+    // Fixed at open() for the lifetime of the writer.
+    OutputFormat activeFormat_ = OutputFormat::Tsv;
+    PayloadMode activePayloadMode_ = PayloadMode::Full;
+    size_t activeQueueBytes_ = kDefaultQueueBytes;
+
+    std::unique_ptr<SpscQueue<Entry>> queue_;
+    std::thread writer_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    bool stopRequested_ = false;  // guarded by wakeMutex_
+    std::atomic<size_t> queuedBytes_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    uint32_t pendingDrops_ = 0;  // producer-only
 };
 
 } // namespace oaa
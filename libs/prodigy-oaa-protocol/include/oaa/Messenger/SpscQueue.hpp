@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace oaa {
+
+/// Bounded lock-free single-producer/single-consumer queue.
+/// One thread calls tryPush(), one (other) thread calls tryPop(). Capacity is
+/// rounded up to a power of two. A full queue rejects the push; the caller
+/// decides what a drop means.
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : slots_(roundUp(capacity))
+        , mask_(slots_.size() - 1)
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    size_t capacity() const { return slots_.size(); }
+
+    /// Producer side.
+    bool tryPush(T&& value)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == slots_.size())
+            return false;
+        slots_[head & mask_] = std::move(value);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side. The slot is reset so it drops any references it holds.
+    bool tryPop(T& out)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire))
+            return false;
+        out = std::move(slots_[tail & mask_]);
+        slots_[tail & mask_] = T();
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Exact from either side only when the other side is idle.
+    size_t sizeApprox() const
+    {
+        return head_.load(std::memory_order_acquire)
+            - tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t roundUp(size_t capacity)
+    {
+        size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        return size;
+    }
+
+    std::vector<T> slots_;
+    const size_t mask_;
+    // Producer and consumer indices on separate cache lines.
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+} // namespace oaa
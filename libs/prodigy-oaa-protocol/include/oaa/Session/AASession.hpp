@@ -92,6 +92,7 @@ private:
     QSet<uint8_t> openChannels_;
     SessionState state_ = SessionState::Idle;
 
+    // Parented to the session so moveToThread() carries them along.
     QTimer stateTimer_;
     QTimer pingTimer_;
     QTimer pongDeadlineTimer_;
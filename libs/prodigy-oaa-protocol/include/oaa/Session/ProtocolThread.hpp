@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+#include <functional>
+
+namespace oaa {
+
+/// Optional dedicated event-loop thread for the transport/Messenger/AASession
+/// stack and its channel handlers.
+///
+/// Objects are moved onto the thread with attach() and back with detach().
+/// Once attached, every Qt::AutoConnection from a handler signal to an
+/// owner-thread receiver becomes queued, so the handler signal is the only
+/// cross-thread edge. Signal order from one sender is preserved.
+///
+/// Blocking is one-directional: the owner thread may block on this thread
+/// (invokeBlocking), but code running here must never block on the owner.
+/// Work that needs the owner thread is posted to it instead.
+class ProtocolThread {
+public:
+    ProtocolThread();
+    ~ProtocolThread();
+
+    ProtocolThread(const ProtocolThread&) = delete;
+    ProtocolThread& operator=(const ProtocolThread&) = delete;
+
+    void start();
+    /// Quit the event loop and join. Attached objects must be detached or
+    /// destroyed first; their thread affinity is left dangling otherwise.
+    void stop();
+    bool isRunning() const;
+    QThread* eventThread() { return &thread_; }
+    bool isCurrentThread() const;
+
+    /// Move a parentless QObject (and its children) onto the protocol thread.
+    /// Must be called from the object's current thread. Returns false for
+    /// parented objects, which Qt cannot move independently.
+    bool attach(QObject* object);
+    /// Move an attached object back to @p target. Runs on the protocol thread
+    /// when called from elsewhere, because Qt only pushes from the current
+    /// affinity thread.
+    void detach(QObject* object, QThread* target);
+
+    /// Run @p fn on the protocol thread and wait for it. Inline when already
+    /// there or when the thread is not running.
+    void invokeBlocking(const std::function<void()>& fn);
+    /// Queue @p fn on the protocol thread. Inline when the thread is not
+    /// running, so callers need no separate single-threaded path.
+    void post(std::function<void()> fn);
+
+private:
+    QThread thread_;
+    QObject* context_ = nullptr;
+};
+
+} // namespace oaa
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QTimer>
+#include <cstdint>
+#include <string>
+
+#include <oaa/Channel/IChannelHandler.hpp>
+#include <oaa/Messenger/CaptureFile.hpp>
+
+namespace oaa {
+
+/// Drives a binary session capture through registered channel handlers with
+/// no phone, transport or TLS, so decode and audio paths can be exercised
+/// headlessly on real traffic.
+///
+/// Only Phone->HU records are dispatched, with AASession's routing: media
+/// goes to IAVChannelHandler::onMediaPayload(), everything else to
+/// onMessage(). Control-channel traffic is skipped (there is no session to
+/// negotiate). A channel is opened on its CHANNEL_OPEN_REQUEST, or on first
+/// traffic when the capture began mid-session. Whatever handlers send back is
+/// counted and discarded.
+///
+/// WallClock pacing reproduces the captured inter-message timing; MaxSpeed
+/// dispatches as fast as the handlers accept, yielding to the event loop
+/// every few records so queued work (decoder hand-off, ACK flushes) keeps up.
+class SessionReplayer : public QObject {
+    Q_OBJECT
+public:
+    enum class Pace {
+        WallClock,
+        MaxSpeed,
+    };
+
+    struct Stats {
+        uint64_t records = 0;
+        uint64_t dispatched = 0;
+        uint64_t dispatchedBytes = 0;
+        uint64_t outboundSkipped = 0;
+        uint64_t unhandled = 0;
+        uint64_t handlerSends = 0;
+        /// Records the logger flagged as following dropped messages.
+        uint64_t gaps = 0;
+        /// Capture time span of the records read so far.
+        int64_t captureUs = 0;
+        /// Wall time from start() to finished().
+        int64_t elapsedUs = 0;
+        /// WallClock only: worst dispatch delay behind the captured timeline.
+        int64_t maxLagUs = 0;
+    };
+
+    explicit SessionReplayer(QObject* parent = nullptr);
+    ~SessionReplayer() override;
+
+    void registerChannel(uint8_t channelId, IChannelHandler* handler);
+
+    /// Fails for captures written in PayloadMode::Digest, which carry no
+    /// payloads to replay.
+    bool open(const std::string& path);
+    const std::string& error() const { return error_; }
+    void setPace(Pace pace) { pace_ = pace; }
+    Pace pace() const { return pace_; }
+
+    void start();
+    /// Stop dispatching and close every open channel. The owner must call
+    /// this (or let the replay finish) while the handlers are still alive.
+    void stop();
+    bool isRunning() const { return running_; }
+
+    /// Dispatch the next record synchronously, ignoring pacing. Returns false
+    /// once the capture is exhausted.
+    bool step();
+
+    const Stats& stats() const { return stats_; }
+
+signals:
+    void finished();
+
+private:
+    static constexpr int kMaxSpeedBatch = 32;
+
+    void pump();
+    bool readAhead();
+    void dispatch(const CaptureRecord& record);
+    void openChannel(uint8_t channelId, IChannelHandler* handler);
+    void closeChannels();
+    void finish();
+
+    CaptureReader reader_;
+    std::string error_;
+    CaptureRecord pending_;
+    bool hasPending_ = false;
+    bool haveBase_ = false;
+    uint64_t baseTimestampUs_ = 0;
+    QHash<uint8_t, IChannelHandler*> channels_;
+    QSet<uint8_t> openChannels_;
+    Pace pace_ = Pace::WallClock;
+    bool running_ = false;
+    QTimer pumpTimer_;
+    QElapsedTimer clock_;
+    Stats stats_;
+};
+
+} // namespace oaa
@@ -4,4 +4,50 @@ namespace oaa {
 
 IAVChannelHandler::~IAVChannelHandler() = default;
 
+void IAVChannelHandler::onMediaPayload(const QByteArray& payload, int dataOffset,
+                                       uint64_t timestamp, bool /*hasTimestamp*/)
+{
+    onMediaData(dataOffset > 0 ? payload.mid(dataOffset) : payload, timestamp);
+}
+
+std::shared_ptr<const QByteArray> IAVChannelHandler::sharePayload(
+    const QByteArray& payload, int dataOffset)
+{
+    if (dataOffset <= 0)
+        return std::make_shared<const QByteArray>(payload);
+    if (dataOffset >= payload.size())
+        return std::make_shared<const QByteArray>();
+
+    // fromRawData() aliases the payload's bytes; the deleter's captured copy
+    // holds a reference on the underlying buffer until the last user is done.
+    auto* view = new QByteArray(QByteArray::fromRawData(
+        payload.constData() + dataOffset, payload.size() - dataOffset));
+    return std::shared_ptr<const QByteArray>(
+        view, [owner = payload](const QByteArray* v) { delete v; });
+}
+
+bool IAVChannelHandler::dispatchMedia(IChannelHandler* handler, uint16_t messageId,
+                                      const QByteArray& payload, int dataOffset)
+{
+    if (messageId != 0x0000 && messageId != 0x0001)
+        return false;
+    auto* avHandler = qobject_cast<IAVChannelHandler*>(handler);
+    if (!avHandler)
+        return false;
+
+    const int dataSize = payload.size() - dataOffset;
+    const char* data = payload.constData() + dataOffset;
+    if (messageId == 0x0000 && dataSize >= 8) {
+        // AV_MEDIA_WITH_TIMESTAMP: first 8 bytes = uint64 BE timestamp
+        uint64_t timestamp = 0;
+        for (int i = 0; i < 8; ++i)
+            timestamp = (timestamp << 8) | static_cast<uint8_t>(data[i]);
+        avHandler->onMediaPayload(payload, dataOffset + 8, timestamp, true);
+    } else {
+        // AV_MEDIA_INDICATION: no timestamp
+        avHandler->onMediaPayload(payload, dataOffset, 0, false);
+    }
+    return true;
+}
+
 } // namespace oaa
@@ -0,0 +1,123 @@
+#include <oaa/Channel/MediaAckCoalescer.hpp>
+
+#include <QMetaObject>
+#include <QTimer>
+#include <algorithm>
+#include <chrono>
+
+namespace oaa {
+
+MediaAckCoalescer::MediaAckCoalescer(QObject* context, uint32_t window, Sender sender)
+    : context_(context)
+    , window_(std::max<uint32_t>(window, 1))
+    , sender_(std::move(sender))
+    , now_([]() {
+        return static_cast<qint64>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    })
+{
+}
+
+uint32_t MediaAckCoalescer::flushThreshold() const
+{
+    if (policy_.mode == MediaAckPolicy::Mode::Immediate)
+        return 1;
+    const uint32_t requested = policy_.flushThreshold > 0
+        ? policy_.flushThreshold
+        : window_ / 2;
+    return std::clamp<uint32_t>(requested, 1, window_);
+}
+
+void MediaAckCoalescer::frameConsumed()
+{
+    ++pending_;
+    if (holding_)
+        return;
+    if (backlogHigh()) {
+        holding_ = true;
+        holdStartUs_ = now_();
+        holdCount_.fetch_add(1, std::memory_order_relaxed);
+        scheduleHoldPoll();
+        return;
+    }
+    if (pending_ >= flushThreshold()) {
+        flush();
+        return;
+    }
+    if (flushScheduled_)
+        return;
+
+    // Queued behind whatever the event loop is already dispatching, so every
+    // frame parsed from the current socket read shares one indication.
+    flushScheduled_ = true;
+    QMetaObject::invokeMethod(context_, [this, epoch = epoch_]() {
+        if (epoch != epoch_)
+            return;
+        flushScheduled_ = false;
+        if (!holding_)
+            flush();
+    }, Qt::QueuedConnection);
+}
+
+bool MediaAckCoalescer::backlogHigh() const
+{
+    return policy_.holdBacklog > 0 && probe_ && probe_() >= policy_.holdBacklog;
+}
+
+void MediaAckCoalescer::scheduleHoldPoll()
+{
+    if (holdPollScheduled_)
+        return;
+    holdPollScheduled_ = true;
+    QTimer::singleShot(kHoldPollMs, context_, [this, epoch = epoch_]() {
+        if (epoch != epoch_)
+            return;
+        holdPollScheduled_ = false;
+        pollHold();
+    });
+}
+
+void MediaAckCoalescer::pollHold()
+{
+    if (!holding_)
+        return;
+    const bool timedOut =
+        now_() - holdStartUs_ >= static_cast<qint64>(policy_.maxHoldMs) * 1000;
+    if (!timedOut && backlogHigh()) {
+        scheduleHoldPoll();
+        return;
+    }
+    if (timedOut)
+        holdTimeouts_.fetch_add(1, std::memory_order_relaxed);
+    flush();
+}
+
+void MediaAckCoalescer::endHold()
+{
+    holding_ = false;
+    heldPermits_.fetch_add(pending_, std::memory_order_relaxed);
+    heldUs_.fetch_add(static_cast<uint64_t>(std::max<qint64>(now_() - holdStartUs_, 0)),
+                      std::memory_order_relaxed);
+}
+
+void MediaAckCoalescer::flush()
+{
+    if (holding_)
+        endHold();
+    if (pending_ == 0)
+        return;
+    const uint32_t count = pending_;
+    pending_ = 0;
+    sender_(count);
+}
+
+void MediaAckCoalescer::reset()
+{
+    pending_ = 0;
+    flushScheduled_ = false;
+    holding_ = false;
+    holdPollScheduled_ = false;
+    ++epoch_;
+}
+
+} // namespace oaa
@@ -15,6 +15,7 @@ namespace hu {
 AudioChannelHandler::AudioChannelHandler(uint8_t channelId, QObject* parent)
     : oaa::IAVChannelHandler(parent)
     , channelId_(channelId)
+    , acks_(this, MAX_UNACKED, [this](uint32_t count) { sendAck(count); })
 {
 }
 
@@ -29,6 +30,10 @@ void AudioChannelHandler::onChannelOpened()
     channelOpen_ = true;
     streaming_ = false;
     session_ = -1;
+    receivedFrameCount_ = 0;
+    ackCount_ = 0;
+    ackedFrameCount_ = 0;
+    acks_.reset();
 
     qDebug() << "[AudioChannel" << channelId_ << "] opened";
 }
@@ -37,6 +42,7 @@ void AudioChannelHandler::onChannelClosed()
 {
     channelOpen_ = false;
     streaming_ = false;
+    acks_.reset();
     qDebug() << "[AudioChannel" << channelId_ << "] closed";
 }
 
@@ -116,6 +122,8 @@ void AudioChannelHandler::handleStartIndication(const QByteArray& payload)
         return;
     }
 
+    // Permits still owed belong to the previous session id.
+    acks_.flush();
     session_ = start.session();
     streaming_ = true;
 
@@ -140,6 +148,7 @@ void AudioChannelHandler::handleStartIndication(const QByteArray& payload)
 
 void AudioChannelHandler::handleStopIndication()
 {
+    acks_.flush();
     streaming_ = false;
     qDebug() << "[AudioChannel" << channelId_ << "] stream stopped";
     emit streamStopped();
@@ -150,26 +159,30 @@ void AudioChannelHandler::onMediaData(const QByteArray& data, uint64_t timestamp
     if (!channelOpen_ || !streaming_)
         return;
 
+    ++receivedFrameCount_;
     emit audioDataReceived(data, timestamp);
 
     if (!protocolPolicy_.usesAcklessAudio()) {
-        // Each accepted frame consumes one of the advertised permits. Return
-        // one immediately so the phone retains the remaining pipeline headroom.
-        sendAck();
+        // Each accepted frame consumes one of the advertised permits. The
+        // coalescer returns it immediately or batched within the window,
+        // per the configured policy.
+        acks_.frameConsumed();
     }
 }
 
-void AudioChannelHandler::sendAck()
+void AudioChannelHandler::sendAck(uint32_t count)
 {
     oaa::proto::messages::AVMediaAckIndication ack;
     ack.set_session_id(session_);
     // ack_count = number of frames being acknowledged (permit replenishment),
     // not cumulative total. Phone uses this to restore its send permits.
-    ack.set_ack_count(1);
+    ack.set_ack_count(count);
 
     QByteArray data(ack.ByteSizeLong(), '\0');
     ack.SerializeToArray(data.data(), data.size());
     emit sendRequested(channelId_, oaa::AVMessageId::ACK_INDICATION, data);
+    ++ackCount_;
+    ackedFrameCount_ += count;
 }
 
 } // namespace hu
@@ -37,6 +37,7 @@ VideoChannelHandler::VideoChannelHandler(
     : oaa::IAVChannelHandler(parent)
     , channelId_(channelId)
     , setupFocusMode_(setupFocusMode)
+    , acks_(this, MAX_UNACKED, [this](uint32_t count) { sendAck(count); })
 {
 }
 
@@ -47,6 +48,8 @@ void VideoChannelHandler::onChannelOpened()
     session_ = -1;
     receivedFrameCount_ = 0;
     ackCount_ = 0;
+    ackedFrameCount_ = 0;
+    acks_.reset();
 
     qDebug() << "[VideoChannel] opened";
 }
@@ -55,6 +58,7 @@ void VideoChannelHandler::onChannelClosed()
 {
     channelOpen_ = false;
     streaming_ = false;
+    acks_.reset();
     qDebug() << "[VideoChannel] closed";
 }
 
@@ -159,7 +163,7 @@ void VideoChannelHandler::handleSetupRequest(const QByteArray& payload)
 
     oaa::proto::messages::AVChannelSetupResponse resp;
     resp.set_media_status(oaa::proto::enums::AVChannelSetupStatus::OK);
-    resp.set_max_unacked(10);
+    resp.set_max_unacked(MAX_UNACKED);
     // Accept all our advertised configs (phone picks best match)
     for (uint32_t i = 0; i < numVideoConfigs_; ++i)
         resp.add_configs(i);
@@ -193,6 +197,8 @@ void VideoChannelHandler::handleStartIndication(const QByteArray& payload)
         return;
     }
 
+    // Permits still owed belong to the previous session id.
+    acks_.flush();
     session_ = start.session();
     streaming_ = true;
 
@@ -233,6 +239,7 @@ void VideoChannelHandler::handleMediaOptions(const QByteArray& payload)
 
 void VideoChannelHandler::handleStopIndication()
 {
+    acks_.flush();
     streaming_ = false;
     qDebug() << "[VideoChannel] stream stopped";
     emit streamStopped();
@@ -279,6 +286,12 @@ void VideoChannelHandler::handleVideoFocusIndication(const QByteArray& payload)
 }
 
 void VideoChannelHandler::onMediaData(const QByteArray& data, uint64_t timestamp)
+{
+    onMediaPayload(data, 0, timestamp, true);
+}
+
+void VideoChannelHandler::onMediaPayload(const QByteArray& payload, int dataOffset,
+                                         uint64_t timestamp, bool hasTimestamp)
 {
     if (!channelOpen_ || !streaming_)
         return;
@@ -287,10 +300,13 @@ void VideoChannelHandler::onMediaData(const QByteArray& data, uint64_t timestamp
     qint64 enqueueNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
         now.time_since_epoch()).count();
 
-    auto shared = std::make_shared<const QByteArray>(data);
+    // Shares the assembled message buffer through to the decoder queue —
+    // the access unit is never copied on its way to VideoDecoder.
+    auto shared = sharePayload(payload, dataOffset);
     ++receivedFrameCount_;
-    emit videoFrameData(shared, enqueueNs);
-    sendAck();
+    emit videoFrameData(shared, enqueueNs,
+                        hasTimestamp ? static_cast<qint64>(timestamp) : -1);
+    acks_.frameConsumed();
 }
 
 void VideoChannelHandler::requestVideoFocus(bool focused)
@@ -311,17 +327,18 @@ void VideoChannelHandler::requestVideoFocus(bool focused)
     emit sendRequested(channelId(), oaa::AVMessageId::VIDEO_FOCUS_INDICATION, data);
 }
 
-void VideoChannelHandler::sendAck()
+void VideoChannelHandler::sendAck(uint32_t count)
 {
     oaa::proto::messages::AVMediaAckIndication ack;
     ack.set_session_id(session_);
     // ack_count is permit replenishment for this ACK message, not cumulative count.
-    ack.set_ack_count(1);
+    ack.set_ack_count(count);
 
     QByteArray data(ack.ByteSizeLong(), '\0');
     ack.SerializeToArray(data.data(), data.size());
     emit sendRequested(channelId(), oaa::AVMessageId::ACK_INDICATION, data);
     ++ackCount_;
+    ackedFrameCount_ += count;
 }
 
 } // namespace hu
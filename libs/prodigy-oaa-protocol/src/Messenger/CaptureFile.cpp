@@ -0,0 +1,133 @@
+#include <oaa/Messenger/CaptureFile.hpp>
+#include <QtEndian>
+#include <cstring>
+
+namespace oaa {
+
+namespace capture {
+
+void writeFileHeader(std::ostream& out, uint32_t fileFlags)
+{
+    char header[kFileHeaderSize];
+    memcpy(header, kMagic, sizeof(kMagic));
+    qToLittleEndian(kVersion, header + 8);
+    qToLittleEndian(static_cast<uint16_t>(kFileHeaderSize), header + 10);
+    qToLittleEndian(fileFlags, header + 12);
+    out.write(header, sizeof(header));
+}
+
+namespace {
+
+void fillRecordHeader(char* header, uint64_t timestampUs, uint8_t channelId,
+                      uint16_t messageId, uint8_t recordFlags, size_t payloadSize)
+{
+    qToLittleEndian(timestampUs, header);
+    qToLittleEndian(static_cast<uint32_t>(payloadSize), header + 8);
+    qToLittleEndian(messageId, header + 12);
+    header[14] = static_cast<char>(channelId);
+    header[15] = static_cast<char>(recordFlags);
+}
+
+} // namespace
+
+void writeRecord(std::ostream& out, uint64_t timestampUs, uint8_t channelId,
+                 uint16_t messageId, uint8_t recordFlags,
+                 const uint8_t* payload, size_t payloadSize)
+{
+    char header[kRecordHeaderSize];
+    fillRecordHeader(header, timestampUs, channelId, messageId, recordFlags, payloadSize);
+    out.write(header, sizeof(header));
+    if (payloadSize > 0)
+        out.write(reinterpret_cast<const char*>(payload),
+                  static_cast<std::streamsize>(payloadSize));
+}
+
+void writeRecord(std::string& out, uint64_t timestampUs, uint8_t channelId,
+                 uint16_t messageId, uint8_t recordFlags,
+                 const uint8_t* payload, size_t payloadSize)
+{
+    char header[kRecordHeaderSize];
+    fillRecordHeader(header, timestampUs, channelId, messageId, recordFlags, payloadSize);
+    out.append(header, sizeof(header));
+    if (payloadSize > 0)
+        out.append(reinterpret_cast<const char*>(payload), payloadSize);
+}
+
+} // namespace capture
+
+bool CaptureReader::open(const std::string& path)
+{
+    close();
+    auto fail = [this](std::string message) {
+        close();
+        error_ = std::move(message);
+        return false;
+    };
+
+    file_.open(path, std::ios::binary);
+    if (!file_.is_open())
+        return fail("cannot open " + path);
+
+    char header[capture::kFileHeaderSize];
+    if (!file_.read(header, sizeof(header))
+        || memcmp(header, capture::kMagic, sizeof(capture::kMagic)) != 0)
+        return fail("not a binary session capture");
+    const auto version = qFromLittleEndian<uint16_t>(header + 8);
+    const auto headerSize = qFromLittleEndian<uint16_t>(header + 10);
+    if (version != capture::kVersion || headerSize < capture::kFileHeaderSize)
+        return fail("unsupported capture version " + std::to_string(version));
+    fileFlags_ = qFromLittleEndian<uint32_t>(header + 12);
+    file_.seekg(headerSize, std::ios::beg);
+    return true;
+}
+
+void CaptureReader::close()
+{
+    if (file_.is_open())
+        file_.close();
+    file_.clear();
+    fileFlags_ = 0;
+    error_.clear();
+}
+
+bool CaptureReader::next(CaptureRecord& record)
+{
+    if (!file_.is_open())
+        return false;
+
+    char header[capture::kRecordHeaderSize];
+    file_.read(header, sizeof(header));
+    if (file_.gcount() == 0 && file_.eof())
+        return false;
+    if (file_.gcount() != sizeof(header)) {
+        error_ = "truncated record header";
+        return false;
+    }
+
+    const auto payloadSize = qFromLittleEndian<uint32_t>(header + 8);
+    if (payloadSize > capture::kMaxPayloadSize) {
+        error_ = "record payload too large: " + std::to_string(payloadSize);
+        return false;
+    }
+
+    const auto flags = static_cast<uint8_t>(header[15]);
+    record.timestampUs = qFromLittleEndian<uint64_t>(header);
+    record.messageId = qFromLittleEndian<uint16_t>(header + 12);
+    record.channelId = static_cast<uint8_t>(header[14]);
+    record.outbound = flags & capture::Outbound;
+    record.digestOnly = flags & capture::Digest;
+    record.gapBefore = flags & capture::GapBefore;
+    record.messageType = (flags & capture::ControlMessage) ? MessageType::Control
+                                                           : MessageType::Specific;
+    // Fresh storage per record: handlers may retain the payload (video
+    // frames are shared, not copied), so it must not be recycled.
+    record.payload = QByteArray(static_cast<qsizetype>(payloadSize), Qt::Uninitialized);
+    if (payloadSize > 0
+        && !file_.read(record.payload.data(), payloadSize)) {
+        error_ = "truncated record payload";
+        return false;
+    }
+    return true;
+}
+
+} // namespace oaa
@@ -1,6 +1,7 @@
 #include <oaa/Messenger/Cryptor.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 
@@ -140,7 +141,10 @@ void Cryptor::deinit()
         m_ssl = nullptr;
         m_readBio = nullptr;
         m_writeBio = nullptr;
+        m_recordBio = nullptr;
     }
+    m_recordIo = {};
+    m_deferredOutput.clear();
     if (m_ctx) {
         SSL_CTX_free(m_ctx);
         m_ctx = nullptr;
@@ -218,22 +222,43 @@ bool Cryptor::writeHandshakeBuffer(const QByteArray& data)
     return true;
 }
 
+bool Cryptor::queueTlsInput(const QByteArray& data)
+{
+    if (!m_recordBio)
+        return writeHandshakeBuffer(data);
+    m_recordIo.queued.append(data);
+    m_lastError.clear();
+    return true;
+}
+
 Cryptor::DataResult Cryptor::encrypt(const QByteArray& plaintext)
+{
+    QByteArray output;
+    auto result = encryptInto(plaintext.constData(), plaintext.size(), output);
+    if (result.isComplete())
+        result.data = std::move(output);
+    return result;
+}
+
+Cryptor::DataResult Cryptor::encryptInto(const char* plaintext, int size,
+                                         QByteArray& out)
 {
     if (!m_active || !m_ssl)
         return failData(QStringLiteral("TLS encryption is not active"));
-    if (plaintext.size() > FRAME_MAX_PAYLOAD)
+    if (size > FRAME_MAX_PAYLOAD)
         return failData(QStringLiteral("TLS plaintext exceeds one AA frame"));
-    if (plaintext.isEmpty()) {
+    if (size <= 0) {
         m_lastError.clear();
         return {DataResult::Status::Complete, {}, {}};
     }
+    if (enterRecordIo())
+        return encryptRecordIo(plaintext, size, out);
 
     int written = 0;
-    while (written < plaintext.size()) {
-        const int remaining = plaintext.size() - written;
+    while (written < size) {
+        const int remaining = size - written;
         ERR_clear_error();
-        const int result = SSL_write(m_ssl, plaintext.constData() + written, remaining);
+        const int result = SSL_write(m_ssl, plaintext + written, remaining);
         if (result <= 0) {
             const int error = SSL_get_error(m_ssl, result);
             return failData(QStringLiteral("SSL_write failed"), error);
@@ -241,10 +266,11 @@ Cryptor::DataResult Cryptor::encrypt(const QByteArray& plaintext)
         written += result;
     }
 
-    auto output = readWriteBio(QStringLiteral("encrypted output BIO read failed"));
+    const qsizetype before = out.size();
+    auto output = appendWriteBio(out, QStringLiteral("encrypted output BIO read failed"));
     if (!output.isComplete())
         return output;
-    if (output.data.isEmpty())
+    if (out.size() == before)
         return failData(QStringLiteral("SSL_write produced no encrypted bytes"));
     return output;
 }
@@ -253,12 +279,14 @@ Cryptor::DataResult Cryptor::decrypt(const QByteArray& ciphertext, int frameLeng
 {
     if (!m_active || !m_ssl)
         return failData(QStringLiteral("TLS decryption is not active"));
-    if (!m_readBio)
+    if (!m_readBio && !m_recordBio)
         return failData(QStringLiteral("TLS input BIO is not initialized"));
     if (ciphertext.isEmpty())
         return failData(QStringLiteral("encrypted AA frame is empty"));
     if (frameLength != ciphertext.size())
         return failData(QStringLiteral("encrypted AA frame length mismatch"));
+    if (enterRecordIo())
+        return decryptRecordIo(ciphertext);
     if (!containsOnlyCompleteTlsRecords(ciphertext))
         return failData(QStringLiteral("incomplete TLS record in encrypted AA frame"));
 
@@ -273,24 +301,30 @@ Cryptor::DataResult Cryptor::decrypt(const QByteArray& ciphertext, int frameLeng
         written += result;
     }
 
-    int estimatedSize = frameLength - TLS_OVERHEAD;
-    if (estimatedSize <= 0) estimatedSize = 2048;
-
-    QByteArray plaintext;
-    plaintext.reserve(estimatedSize);
+    return readPlaintext(ciphertext.size());
+}
 
-    char chunk[2048];
+Cryptor::DataResult Cryptor::readPlaintext(int capacity)
+{
+    // A TLS record's plaintext never exceeds its ciphertext, so SSL_read can
+    // write straight into one buffer sized from the frame instead of bouncing
+    // through a stack chunk and appending.
+    QByteArray plaintext(capacity, Qt::Uninitialized);
+    int produced = 0;
     while (true) {
+        if (produced == plaintext.size())
+            plaintext.resize(plaintext.size() + TLS_OVERHEAD);
         ERR_clear_error();
-        const int read = SSL_read(m_ssl, chunk, sizeof(chunk));
+        const int read = SSL_read(m_ssl, plaintext.data() + produced,
+                                  plaintext.size() - produced);
         if (read > 0) {
-            plaintext.append(chunk, read);
+            produced += read;
             continue;
         }
 
         const int error = SSL_get_error(m_ssl, read);
         if ((error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_WRITE)
-            && !plaintext.isEmpty()) {
+            && produced > 0) {
             break;
         }
         return failData(
@@ -299,6 +333,7 @@ Cryptor::DataResult Cryptor::decrypt(const QByteArray& ciphertext, int frameLeng
                 : QStringLiteral("SSL_read failed"),
             error);
     }
+    plaintext.resize(produced);
 
     m_lastError.clear();
     return {DataResult::Status::Complete, std::move(plaintext), {}};
@@ -309,7 +344,169 @@ bool Cryptor::isActive() const
     return m_active;
 }
 
+bool Cryptor::enterRecordIo()
+{
+    if (m_recordBio)
+        return true;
+    if (!m_recordIoEnabled || !m_active || !m_ssl || !m_readBio || !m_writeBio)
+        return false;
+    // Bytes still queued in the memory BIOs (late handshake flight, session
+    // tickets) would be lost by the swap; stay on them until they drain.
+    if (BIO_ctrl_pending(m_readBio) > 0 || BIO_ctrl_pending(m_writeBio) > 0)
+        return false;
+
+    BIO_METHOD* method = recordBioMethod();
+    BIO* bio = method ? BIO_new(method) : nullptr;
+    if (!bio)
+        return false;
+    BIO_set_data(bio, &m_recordIo);
+
+    // One BIO serves both directions; SSL_set_bio takes a single reference
+    // and frees the memory pair.
+    SSL_set_bio(m_ssl, bio, bio);
+    m_readBio = nullptr;
+    m_writeBio = nullptr;
+    m_recordBio = bio;
+    return true;
+}
+
+Cryptor::DataResult Cryptor::encryptRecordIo(const char* plaintext, int size,
+                                             QByteArray& out)
+{
+    // FRAME_MAX_PAYLOAD fits one TLS record, so the output grows by exactly
+    // one record's overhead; reserve it so OpenSSL's write is a plain copy.
+    const qsizetype before = out.size();
+    out.reserve(before + m_deferredOutput.size() + size + TLS_OVERHEAD);
+    if (!m_deferredOutput.isEmpty()) {
+        out.append(m_deferredOutput);
+        m_deferredOutput.clear();
+    }
+
+    m_recordIo.output = &out;
+    ERR_clear_error();
+    const int result = SSL_write(m_ssl, plaintext, size);
+    m_recordIo.output = nullptr;
+    if (result <= 0) {
+        const int error = SSL_get_error(m_ssl, result);
+        return failData(QStringLiteral("SSL_write failed"), error);
+    }
+    // SSL_MODE_ENABLE_PARTIAL_WRITE is off: a positive return is the full size.
+    if (out.size() == before)
+        return failData(QStringLiteral("SSL_write produced no encrypted bytes"));
+    m_lastError.clear();
+    return {DataResult::Status::Complete, {}, {}};
+}
+
+Cryptor::DataResult Cryptor::decryptRecordIo(const QByteArray& ciphertext)
+{
+    m_recordIo.input = ciphertext.constData();
+    m_recordIo.inputSize = ciphertext.size();
+    m_recordIo.inputOffset = 0;
+    m_recordIo.output = &m_deferredOutput;
+
+    auto result = readPlaintext(ciphertext.size());
+
+    // The record layer only stops short of the frame end on a truncated
+    // record, which it keeps buffered; that replaces the up-front header walk.
+    const bool consumed = m_recordIo.inputOffset == m_recordIo.inputSize
+        && SSL_has_pending(m_ssl) == 0;
+    m_recordIo.input = nullptr;
+    m_recordIo.inputSize = 0;
+    m_recordIo.inputOffset = 0;
+    m_recordIo.output = nullptr;
+    if (m_recordIo.queuedOffset == m_recordIo.queued.size()) {
+        m_recordIo.queued.clear();
+        m_recordIo.queuedOffset = 0;
+    }
+    if (result.isComplete() && !consumed)
+        return failData(QStringLiteral("incomplete TLS record in encrypted AA frame"));
+    return result;
+}
+
+BIO_METHOD* Cryptor::recordBioMethod()
+{
+    static BIO_METHOD* const method = []() -> BIO_METHOD* {
+        BIO_METHOD* m = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK,
+                                     "oaa record io");
+        if (!m)
+            return nullptr;
+        BIO_meth_set_read(m, &Cryptor::recordBioRead);
+        BIO_meth_set_write(m, &Cryptor::recordBioWrite);
+        BIO_meth_set_ctrl(m, &Cryptor::recordBioCtrl);
+        BIO_meth_set_create(m, &Cryptor::recordBioCreate);
+        return m;
+    }();
+    return method;
+}
+
+int Cryptor::recordBioRead(BIO* bio, char* data, int size)
+{
+    auto* io = static_cast<RecordIo*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+    const int queued = io ? io->queued.size() - io->queuedOffset : 0;
+    if (queued > 0) {
+        const int count = std::min(size, queued);
+        std::memcpy(data, io->queued.constData() + io->queuedOffset,
+                    static_cast<size_t>(count));
+        io->queuedOffset += count;
+        return count;
+    }
+    const int remaining = io ? io->inputSize - io->inputOffset : 0;
+    if (remaining <= 0) {
+        BIO_set_retry_read(bio);
+        return -1;
+    }
+    const int count = std::min(size, remaining);
+    std::memcpy(data, io->input + io->inputOffset, static_cast<size_t>(count));
+    io->inputOffset += count;
+    return count;
+}
+
+int Cryptor::recordBioWrite(BIO* bio, const char* data, int size)
+{
+    auto* io = static_cast<RecordIo*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+    if (!io || !io->output)
+        return -1;
+    io->output->append(data, size);
+    return size;
+}
+
+long Cryptor::recordBioCtrl(BIO* bio, int cmd, long num, void* ptr)
+{
+    Q_UNUSED(num)
+    Q_UNUSED(ptr)
+    auto* io = static_cast<RecordIo*>(BIO_get_data(bio));
+    switch (cmd) {
+    case BIO_CTRL_FLUSH:
+        return 1;
+    case BIO_CTRL_PENDING:
+        return io ? io->queued.size() - io->queuedOffset
+                        + io->inputSize - io->inputOffset
+                  : 0;
+    case BIO_CTRL_WPENDING:
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+int Cryptor::recordBioCreate(BIO* bio)
+{
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
 Cryptor::DataResult Cryptor::readWriteBio(const QString& context)
+{
+    QByteArray output;
+    auto result = appendWriteBio(output, context);
+    if (result.isComplete())
+        result.data = std::move(output);
+    return result;
+}
+
+Cryptor::DataResult Cryptor::appendWriteBio(QByteArray& out, const QString& context)
 {
     if (!m_writeBio)
         return failData(context + QStringLiteral(": BIO is not initialized"));
@@ -319,22 +516,22 @@ Cryptor::DataResult Cryptor::readWriteBio(const QString& context)
         m_lastError.clear();
         return {DataResult::Status::Complete, {}, {}};
     }
-    if (pending > std::numeric_limits<int>::max())
+    if (pending > std::numeric_limits<int>::max() - out.size())
         return failData(context + QStringLiteral(": pending data is too large"));
 
-    QByteArray output;
-    output.resize(static_cast<int>(pending));
-    int offset = 0;
-    while (offset < output.size()) {
+    const qsizetype base = out.size();
+    out.resize(base + static_cast<int>(pending));
+    qsizetype offset = base;
+    while (offset < out.size()) {
         ERR_clear_error();
-        const int read = BIO_read(m_writeBio, output.data() + offset,
-                                  output.size() - offset);
+        const int read = BIO_read(m_writeBio, out.data() + offset,
+                                  static_cast<int>(out.size() - offset));
         if (read <= 0)
             return failData(context);
         offset += read;
     }
     m_lastError.clear();
-    return {DataResult::Status::Complete, std::move(output), {}};
+    return {DataResult::Status::Complete, {}, {}};
 }
 
 Cryptor::DataResult Cryptor::failData(const QString& context, int sslError)
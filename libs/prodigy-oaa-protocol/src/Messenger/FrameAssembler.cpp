@@ -90,8 +90,12 @@ void FrameAssembler::onFrame(const FrameHeader& header,
             return;
         }
 
+        // Reserve the declared total once; later fragments append in place
+        // instead of detaching and regrowing the FIRST payload.
         PartialMessage partial;
-        partial.payload = payload;
+        partial.payload.reserve(static_cast<qsizetype>(header.totalMessageSize));
+        partial.payload.append(payload);
+        m_bytesCopied += payloadSize;
         partial.declaredSize = header.totalMessageSize;
         partial.messageType = header.messageType;
         partial.encryptionType = header.encryptionType;
@@ -123,6 +127,7 @@ void FrameAssembler::onFrame(const FrameHeader& header,
                 return;
             }
             it->payload.append(payload);
+            m_bytesCopied += static_cast<quint64>(payload.size());
             return;
         }
 
@@ -133,6 +138,7 @@ void FrameAssembler::onFrame(const FrameHeader& header,
         }
 
         it->payload.append(payload);
+        m_bytesCopied += static_cast<quint64>(payload.size());
         const MessageType messageType = it->messageType;
         QByteArray message = std::move(it->payload);
         release(header.channelId);
@@ -3,6 +3,11 @@
 namespace oaa {
 
 FrameHeader FrameHeader::parse(const QByteArray& data)
+{
+    return parse(data.constData());
+}
+
+FrameHeader FrameHeader::parse(const char* data)
 {
     uint8_t byte0 = static_cast<uint8_t>(data[0]);
     uint8_t byte1 = static_cast<uint8_t>(data[1]);
@@ -19,13 +24,18 @@ FrameHeader FrameHeader::parse(const QByteArray& data)
 QByteArray FrameHeader::serialize() const
 {
     QByteArray result(2, '\0');
-    result[0] = static_cast<char>(channelId);
-    result[1] = static_cast<char>(
+    serializeTo(result.data());
+    return result;
+}
+
+void FrameHeader::serializeTo(char* dst) const
+{
+    dst[0] = static_cast<char>(channelId);
+    dst[1] = static_cast<char>(
         static_cast<uint8_t>(frameType) |
         static_cast<uint8_t>(encryptionType) |
         static_cast<uint8_t>(messageType)
     );
-    return result;
 }
 
 int FrameHeader::sizeFieldLength(FrameType type)
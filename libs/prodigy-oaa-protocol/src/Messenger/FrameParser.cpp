@@ -6,6 +6,21 @@ Q_LOGGING_CATEGORY(lcFrameParser, "oaa.messenger.frameparser")
 
 namespace oaa {
 
+namespace {
+
+// A payload that references the chunk's storage instead of copying it. The
+// slice holds a reference on the chunk, so it stays valid after the chunk
+// goes; it is not NUL-terminated, and writing to it detaches as usual.
+QByteArray sharedSlice(const QByteArray& chunk, size_t offset, size_t length)
+{
+    QByteArray::DataPointer view = chunk.data_ptr();
+    view.setBegin(view.data() + offset);
+    view.size = static_cast<qsizetype>(length);
+    return QByteArray(std::move(view));
+}
+
+} // namespace
+
 FrameParser::FrameParser(QObject* parent)
     : QObject(parent)
 {
@@ -13,6 +28,7 @@ FrameParser::FrameParser(QObject* parent)
 
 void FrameParser::reset()
 {
+    ++m_resetCount;
     m_state = State::ReadHeader;
     m_buffer.clear();
     m_currentHeader = {};
@@ -22,10 +38,71 @@ void FrameParser::reset()
 
 void FrameParser::onData(const QByteArray& data)
 {
-    m_buffer.append(data.constData(), data.size());
+    const char* src = data.constData();
+    size_t length = static_cast<size_t>(data.size());
+
+    // Nothing staged: decode whole frames straight out of the transport chunk
+    // and hand their payloads out as slices of it instead of ring-append + peek.
+    if (m_state == State::ReadHeader && m_buffer.available() == 0) {
+        const quint64 resetCount = m_resetCount;
+        const size_t consumed = parseContiguous(data);
+        if (resetCount != m_resetCount)
+            return;  // A receiver reset the parser; drop the rest of the chunk.
+        src += consumed;
+        length -= consumed;
+    }
+
+    if (length == 0)
+        return;
+    m_buffer.append(src, length);
+    m_bytesCopied += length;
     process();
 }
 
+size_t FrameParser::parseContiguous(const QByteArray& chunk)
+{
+    const char* data = chunk.constData();
+    const size_t length = static_cast<size_t>(chunk.size());
+    // Raw-data chunks have no storage to share; their payloads are copied.
+    QByteArray::DataPointer storage = chunk.data_ptr();
+    const bool shareable = storage.d_ptr() != nullptr;
+    const quint64 resetCount = m_resetCount;
+    size_t offset = 0;
+
+    while (length - offset >= 2) {
+        const char* frame = data + offset;
+        FrameHeader header = FrameHeader::parse(frame);
+        const size_t sizeFieldLength = static_cast<size_t>(
+            FrameHeader::sizeFieldLength(header.frameType));
+        if (length - offset < 2 + sizeFieldLength)
+            break;
+
+        const auto* sizeField = reinterpret_cast<const uchar*>(frame + 2);
+        const uint16_t payloadSize = qFromBigEndian<uint16_t>(sizeField);
+        header.totalMessageSize = header.frameType == FrameType::First
+            ? qFromBigEndian<uint32_t>(sizeField + 2)
+            : 0;
+
+        const size_t headerLength = 2 + sizeFieldLength;
+        if (length - offset < headerLength + payloadSize)
+            break;
+
+        QByteArray payload;
+        if (shareable) {
+            payload = sharedSlice(chunk, offset + headerLength, payloadSize);
+        } else {
+            payload = QByteArray(frame + headerLength, payloadSize);
+            m_bytesCopied += payloadSize;
+        }
+        offset += headerLength + payloadSize;
+        ++m_framesParsed;
+        emit frameParsed(header, payload);
+        if (resetCount != m_resetCount)
+            return length;
+    }
+    return offset;
+}
+
 void FrameParser::process()
 {
     while (true) {
@@ -34,7 +111,8 @@ void FrameParser::process()
             if (m_buffer.available() < 2)
                 return;
             {
-                QByteArray hdr = m_buffer.peek(2);
+                char hdr[2];
+                m_buffer.peekInto(hdr, sizeof(hdr));
                 m_currentHeader = FrameHeader::parse(hdr);
                 m_sizeFieldLength = FrameHeader::sizeFieldLength(m_currentHeader.frameType);
                 m_buffer.consume(2);
@@ -46,15 +124,15 @@ void FrameParser::process()
             if (m_buffer.available() < static_cast<size_t>(m_sizeFieldLength))
                 return;
             {
-                // Peek the size field bytes to extract payload size
-                QByteArray sizeData = m_buffer.peek(m_sizeFieldLength);
+                // Size field is at most 6 bytes — decode from the stack, not the heap
+                char sizeData[6];
+                m_buffer.peekInto(sizeData, m_sizeFieldLength);
+                const auto* sizeField = reinterpret_cast<const uchar*>(sizeData);
                 // Frame payload size is always the first 2 bytes (big-endian uint16)
-                m_framePayloadSize = qFromBigEndian<uint16_t>(
-                    reinterpret_cast<const uchar*>(sizeData.constData()));
+                m_framePayloadSize = qFromBigEndian<uint16_t>(sizeField);
                 m_currentHeader.totalMessageSize =
                     m_currentHeader.frameType == FrameType::First
-                    ? qFromBigEndian<uint32_t>(
-                        reinterpret_cast<const uchar*>(sizeData.constData() + 2))
+                    ? qFromBigEndian<uint32_t>(sizeField + 2)
                     : 0;
                 m_buffer.consume(m_sizeFieldLength);
             }
@@ -68,6 +146,8 @@ void FrameParser::process()
                 QByteArray payload = m_buffer.peek(m_framePayloadSize);
                 m_buffer.consume(m_framePayloadSize);
                 m_state = State::ReadHeader;
+                ++m_framesParsed;
+                m_bytesCopied += m_framePayloadSize;
                 emit frameParsed(m_currentHeader, payload);
             }
             break;
@@ -1,35 +1,52 @@
 #include <oaa/Messenger/FrameSerializer.hpp>
 #include <QtEndian>
 
+#include <algorithm>
+#include <cstring>
+
 namespace oaa {
 
+int FrameSerializer::frameCount(int messageSize)
+{
+    if (messageSize <= FRAME_MAX_PAYLOAD)
+        return 1;
+    return (messageSize + FRAME_MAX_PAYLOAD - 1) / FRAME_MAX_PAYLOAD;
+}
+
+FrameType FrameSerializer::frameTypeFor(int index, int count)
+{
+    if (count <= 1)
+        return FrameType::Bulk;
+    if (index == 0)
+        return FrameType::First;
+    return index == count - 1 ? FrameType::Last : FrameType::Middle;
+}
+
+int FrameSerializer::headerLength(FrameType type)
+{
+    return 2 + FrameHeader::sizeFieldLength(type);
+}
+
+void FrameSerializer::writeHeader(char* dst, const FrameHeader& header,
+                                  uint16_t frameSize, uint32_t totalSize)
+{
+    // Header (2 bytes), then 2B frame payload size (BE); FIRST adds the 4B
+    // total message size (BE).
+    header.serializeTo(dst);
+    qToBigEndian(frameSize, dst + 2);
+    if (header.frameType == FrameType::First)
+        qToBigEndian(totalSize, dst + 4);
+}
+
 QByteArray FrameSerializer::buildFrame(const FrameHeader& header,
                                        const QByteArray& payload,
                                        qint32 totalSize)
 {
-    int sizeLen = FrameHeader::sizeFieldLength(header.frameType);
-    QByteArray frame;
-    frame.reserve(2 + sizeLen + payload.size());
-
-    // Header (2 bytes)
-    frame.append(header.serialize());
-
-    // Size field
-    if (header.frameType == FrameType::First) {
-        // FIRST: 2B frame payload size (BE) + 4B total message size (BE)
-        uint16_t frameSizeBE = qToBigEndian(static_cast<uint16_t>(payload.size()));
-        frame.append(reinterpret_cast<const char*>(&frameSizeBE), 2);
-        uint32_t totalSizeBE = qToBigEndian(static_cast<uint32_t>(totalSize));
-        frame.append(reinterpret_cast<const char*>(&totalSizeBE), 4);
-    } else {
-        // BULK/MIDDLE/LAST: 2B frame payload size (BE)
-        uint16_t frameSizeBE = qToBigEndian(static_cast<uint16_t>(payload.size()));
-        frame.append(reinterpret_cast<const char*>(&frameSizeBE), 2);
-    }
-
-    // Payload
-    frame.append(payload);
-
+    const int headerLen = headerLength(header.frameType);
+    QByteArray frame(headerLen + payload.size(), Qt::Uninitialized);
+    writeHeader(frame.data(), header, static_cast<uint16_t>(payload.size()),
+                static_cast<uint32_t>(totalSize));
+    std::memcpy(frame.data() + headerLen, payload.constData(), payload.size());
     return frame;
 }
 
@@ -77,4 +94,44 @@ QList<QByteArray> FrameSerializer::serialize(uint8_t channelId,
     return frames;
 }
 
+int FrameSerializer::appendMessage(QByteArray& out,
+                                   uint8_t channelId,
+                                   MessageType msgType,
+                                   uint16_t messageId,
+                                   const QByteArray& payload)
+{
+    const int messageSize = 2 + payload.size();
+    const int count = frameCount(messageSize);
+    // Every frame carries a 4-byte header+size; FIRST adds the 4-byte total.
+    const int bytes = messageSize + count * 4 + (count > 1 ? 4 : 0);
+
+    const qsizetype base = out.size();
+    out.resize(base + bytes);
+    char* dst = out.data() + base;
+
+    char messageIdBE[2];
+    qToBigEndian(messageId, messageIdBE);
+
+    // offset walks the logical [messageId][payload] message.
+    int offset = 0;
+    for (int i = 0; i < count; ++i) {
+        const FrameType type = frameTypeFor(i, count);
+        const int chunk = std::min(messageSize - offset, FRAME_MAX_PAYLOAD);
+        writeHeader(dst, FrameHeader{channelId, type, EncryptionType::Plain, msgType},
+                    static_cast<uint16_t>(chunk), static_cast<uint32_t>(messageSize));
+        dst += headerLength(type);
+
+        int copied = 0;
+        if (offset < 2) {
+            copied = 2 - offset;
+            std::memcpy(dst, messageIdBE + offset, copied);
+        }
+        std::memcpy(dst + copied, payload.constData() + (offset + copied - 2),
+                    chunk - copied);
+        dst += chunk;
+        offset += chunk;
+    }
+    return count;
+}
+
 } // namespace oaa
@@ -3,6 +3,8 @@
 #include <QtEndian>
 #include <QDebug>
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 
 namespace oaa {
@@ -87,13 +89,6 @@ void Messenger::sendMessage(uint8_t channelId, uint16_t messageId,
     if (!started_ || generation != lifecycleGeneration_)
         return;
 
-    // Prepend 2-byte big-endian messageId
-    QByteArray fullPayload;
-    fullPayload.reserve(2 + payload.size());
-    uint16_t msgIdBE = qToBigEndian(messageId);
-    fullPayload.append(reinterpret_cast<const char*>(&msgIdBE), 2);
-    fullPayload.append(payload);
-
     // Message type follows aasdk convention:
     // - Channel 0 (control): always Specific
     // - Non-zero channels, msg 0x0008 (ChannelOpenResponse): Control
@@ -113,52 +108,22 @@ void Messenger::sendMessage(uint8_t channelId, uint16_t messageId,
             ? EncryptionType::Encrypted
             : EncryptionType::Plain;
 
-    // Serialize into frames
-    auto frames = FrameSerializer::serialize(channelId, msgType, encType, fullPayload);
-
-    // Encrypt frame payloads if needed
-    if (encType == EncryptionType::Encrypted) {
-        for (int i = 0; i < frames.size(); ++i) {
-            const auto& frame = frames[i];
-            auto hdr = FrameHeader::parse(frame.left(2));
-            int sizeLen = FrameHeader::sizeFieldLength(hdr.frameType);
-            int headerLen = 2 + sizeLen;
-            QByteArray frameHeader = frame.left(headerLen);
-            QByteArray framePl = frame.mid(headerLen);
-
-            auto encrypted = cryptor_.encrypt(framePl);
-            if (!encrypted.isComplete()) {
-                failTls(encrypted.error);
-                return;
-            }
-
-            // Rebuild frame with encrypted payload and updated size
-            QByteArray newFrame;
-            newFrame.reserve(headerLen + encrypted.data.size());
-            newFrame.append(frameHeader.left(2)); // header bytes
-
-            // Rewrite size field with encrypted size
-            if (hdr.frameType == FrameType::First) {
-                uint16_t frameSizeBE = qToBigEndian(
-                    static_cast<uint16_t>(encrypted.data.size()));
-                newFrame.append(reinterpret_cast<const char*>(&frameSizeBE), 2);
-                // Total size in FIRST stays as-is (refers to plaintext total)
-                newFrame.append(frameHeader.mid(4, 4));
-            } else {
-                uint16_t frameSizeBE = qToBigEndian(
-                    static_cast<uint16_t>(encrypted.data.size()));
-                newFrame.append(reinterpret_cast<const char*>(&frameSizeBE), 2);
-            }
-            newFrame.append(encrypted.data);
-            frames[i] = newFrame;
-        }
+    // Every frame of the message lands in one buffer that becomes a single
+    // transport write.
+    SendItem item;
+    if (encType == EncryptionType::Plain) {
+        FrameSerializer::appendMessage(item.frames, channelId, msgType,
+                                       messageId, payload);
+    } else if (!serializeEncrypted(item.frames, channelId, msgType,
+                                   messageId, payload)) {
+        return;
     }
 
     // Queue and send — input channel (touch) gets priority
     if (channelId == ChannelId::Input) {
-        sendQueue_.prepend(SendItem{std::move(frames)});
+        sendQueue_.prepend(std::move(item));
     } else {
-        sendQueue_.enqueue(SendItem{std::move(frames)});
+        sendQueue_.enqueue(std::move(item));
     }
     processSendQueue();
 }
@@ -194,22 +159,58 @@ void Messenger::sendRaw(uint8_t channelId, const QByteArray& data,
     }
 
     FrameHeader header{channelId, frameType, encType, msgType};
-    QByteArray frame;
-    int sizeLen = FrameHeader::sizeFieldLength(frameType);
-    frame.reserve(2 + sizeLen + data.size());
+    const int headerLen = FrameSerializer::headerLength(frameType);
+    SendItem item;
+    item.frames.resize(headerLen + data.size());
+    FrameSerializer::writeHeader(item.frames.data(), header,
+                                 static_cast<uint16_t>(data.size()),
+                                 totalMessageSize);
+    memcpy(item.frames.data() + headerLen, data.constData(), data.size());
+
+    sendQueue_.enqueue(std::move(item));
+    processSendQueue();
+}
 
-    frame.append(header.serialize());
-    uint16_t sizeBE = qToBigEndian(static_cast<uint16_t>(data.size()));
-    frame.append(reinterpret_cast<const char*>(&sizeBE), 2);
-    if (frameType == FrameType::First) {
-        // Extended size field: 4 additional bytes for total size
-        uint32_t totalBE = qToBigEndian(totalMessageSize);
-        frame.append(reinterpret_cast<const char*>(&totalBE), 4);
+bool Messenger::serializeEncrypted(QByteArray& out, uint8_t channelId,
+                                   MessageType msgType, uint16_t messageId,
+                                   const QByteArray& payload)
+{
+    // TLS needs each frame's plaintext contiguous, so the id-prefixed message
+    // is staged once in a reused scratch buffer rather than per frame.
+    const int messageSize = 2 + payload.size();
+    sendScratch_.resize(messageSize);
+    qToBigEndian(messageId, sendScratch_.data());
+    memcpy(sendScratch_.data() + 2, payload.constData(), payload.size());
+
+    const int count = FrameSerializer::frameCount(messageSize);
+    out.reserve(messageSize + count * (8 + TLS_OVERHEAD));
+
+    int offset = 0;
+    for (int i = 0; i < count; ++i) {
+        const FrameType type = FrameSerializer::frameTypeFor(i, count);
+        const int chunk = std::min(messageSize - offset,
+                                   int(FrameSerializer::FRAME_MAX_PAYLOAD));
+        const int headerLen = FrameSerializer::headerLength(type);
+
+        // Reserve the header, let the Cryptor append ciphertext behind it,
+        // then fill the header in with the ciphertext size. The FIRST total
+        // stays the plaintext message size.
+        const qsizetype headerAt = out.size();
+        out.resize(headerAt + headerLen);
+        auto encrypted = cryptor_.encryptInto(sendScratch_.constData() + offset,
+                                              chunk, out);
+        if (!encrypted.isComplete()) {
+            failTls(encrypted.error);
+            return false;
+        }
+        const qsizetype cipherLen = out.size() - headerAt - headerLen;
+        FrameSerializer::writeHeader(
+            out.data() + headerAt,
+            FrameHeader{channelId, type, EncryptionType::Encrypted, msgType},
+            static_cast<uint16_t>(cipherLen), static_cast<uint32_t>(messageSize));
+        offset += chunk;
     }
-    frame.append(data);
-
-    sendQueue_.enqueue(SendItem{{frame}});
-    processSendQueue();
+    return true;
 }
 
 void Messenger::startHandshake()
@@ -227,6 +228,12 @@ bool Messenger::isEncrypted() const
     return cryptor_.isActive();
 }
 
+Messenger::ReceiveStats Messenger::receiveStats() const
+{
+    return {parser_.framesParsed(),
+            parser_.bytesCopied() + tlsBytesStaged_ + assembler_.bytesCopied()};
+}
+
 void Messenger::onFrameParsed(const FrameHeader& header,
                                const QByteArray& framePayload)
 {
@@ -237,7 +244,11 @@ void Messenger::onFrameParsed(const FrameHeader& header,
 
     // Decrypt if frame says it's encrypted
     if (header.encryptionType == EncryptionType::Encrypted) {
+        // The memory-BIO path stages ciphertext into the TLS input BIO
+        // before SSL_read; record I/O reads it straight from the frame.
         auto decrypted = cryptor_.decrypt(framePayload, framePayload.size());
+        if (!cryptor_.usesRecordIo())
+            tlsBytesStaged_ += static_cast<quint64>(framePayload.size());
         if (!decrypted.isComplete()) {
             failTls(decrypted.error);
             return;
@@ -272,6 +283,16 @@ void Messenger::onMessageAssembled(uint8_t channelId, MessageType messageType,
         return;
     }
 
+    // Post-handshake TLS records (TLS 1.3 session tickets, key updates) still
+    // travel as plain SSL_HANDSHAKE messages. They belong to the TLS stream:
+    // queue them for the next SSL_read instead of surfacing them, or every
+    // later record would fail its sequence check.
+    if (channelId == 0 && messageId == 0x0003) {
+        if (!cryptor_.queueTlsInput(payload.mid(msgIdSize)))
+            failTls(cryptor_.lastError());
+        return;
+    }
+
     // Pass full payload with offset to avoid per-message QByteArray allocation
     emit messageReceived(channelId, messageId, payload, msgIdSize, messageType);
 }
@@ -345,13 +366,9 @@ void Messenger::processSendQueue()
     while (started_ && generation == lifecycleGeneration_
            && !sendQueue_.isEmpty()) {
         SendItem item = sendQueue_.dequeue();
-        for (const auto& frame : item.frames) {
-            if (!started_ || generation != lifecycleGeneration_)
-                return;
-            transport_->write(frame);
-            if (!started_ || generation != lifecycleGeneration_)
-                return;
-        }
+        transport_->write(item.frames);
+        if (!started_ || generation != lifecycleGeneration_)
+            return;
     }
 
     if (generation == lifecycleGeneration_)
@@ -1,8 +1,12 @@
 #include <oaa/Messenger/ProtocolLogger.hpp>
+#include <oaa/Messenger/CaptureFile.hpp>
 #include <oaa/Messenger/Messenger.hpp>
 #include <oaa/Channel/ChannelId.hpp>
 #include <oaa/Channel/MessageIds.hpp>
+#include <QDebug>
+#include <QtEndian>
 #include <algorithm>
+#include <cstdio>
 #include <iomanip>
 #include <sstream>
 
@@ -10,6 +14,12 @@ namespace oaa {
 
 namespace {
 
+// Writes go out when this much is formatted or the queue runs dry.
+constexpr size_t kBatchBytes = 256 * 1024;
+// Upper bound on how long a queued message waits when a wake-up is missed.
+constexpr auto kIdleWait = std::chrono::milliseconds(50);
+constexpr size_t kPreviewMax = 64;
+
 bool isAVMediaFrame(uint8_t channelId, uint16_t messageId)
 {
     if (messageId != AVMessageId::AV_MEDIA_WITH_TIMESTAMP
@@ -25,14 +35,34 @@ bool isAVMediaFrame(uint8_t channelId, uint16_t messageId)
         || channelId == ChannelId::AVInput;
 }
 
-std::string hexNoSpaces(const uint8_t* payload, size_t payloadSize)
+void appendHex(std::string& out, const uint8_t* payload, size_t payloadSize,
+               bool spaced)
 {
-    std::ostringstream out;
-    out << std::hex << std::setfill('0');
+    static constexpr char kDigits[] = "0123456789abcdef";
+    out.reserve(out.size() + payloadSize * (spaced ? 3 : 2));
     for (size_t i = 0; i < payloadSize; ++i) {
-        out << std::setw(2) << static_cast<int>(payload[i]);
+        if (spaced && i > 0)
+            out += ' ';
+        out += kDigits[payload[i] >> 4];
+        out += kDigits[payload[i] & 0x0f];
     }
-    return out.str();
+}
+
+uint64_t fnv1a64(const uint8_t* payload, size_t payloadSize)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < payloadSize; ++i) {
+        hash ^= payload[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+void appendDigest(std::string& out, uint64_t digest)
+{
+    char text[17];
+    snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(digest));
+    out += text;
 }
 
 std::string jsonEscape(const std::string& input)
@@ -76,20 +106,65 @@ ProtocolLogger::~ProtocolLogger()
 void ProtocolLogger::open(const std::string& path)
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (open_) file_.close();
-    file_.open(path, std::ios::trunc);
+    stopWriter();
+
+    activeFormat_ = format_;
+    activePayloadMode_ = payloadMode_;
+    activeQueueBytes_ = maxQueueBytes_;
+    written_ = 0;
+    dropped_ = 0;
+    queuedBytes_ = 0;
+    pendingDrops_ = 0;
+
+    const bool binary = activeFormat_ == OutputFormat::Binary;
+    file_.open(path, binary ? std::ios::trunc | std::ios::binary : std::ios::trunc);
     startTime_ = std::chrono::steady_clock::now();
-    open_ = file_.is_open();
-    if (open_ && format_ == OutputFormat::Tsv) {
+    if (!file_.is_open())
+        return;
+
+    if (activeFormat_ == OutputFormat::Tsv) {
         file_ << "TIME\tDIR\tCHANNEL\tMESSAGE\tSIZE\tPAYLOAD_PREVIEW\n";
-        file_.flush();
+    } else if (binary) {
+        uint32_t flags = 0;
+        if (includeMedia_)
+            flags |= capture::IncludesMedia;
+        if (activePayloadMode_ == PayloadMode::Digest)
+            flags |= capture::PayloadDigests;
+        capture::writeFileHeader(file_, flags);
     }
+    file_.flush();
+
+    queue_ = std::make_unique<SpscQueue<Entry>>(maxQueueEntries_);
+    stopRequested_ = false;
+    writer_ = std::thread(&ProtocolLogger::writerLoop, this);
+    open_ = true;
 }
 
 void ProtocolLogger::close()
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (open_) { file_.close(); open_ = false; }
+    stopWriter();
+}
+
+void ProtocolLogger::stopWriter()
+{
+    open_ = false;
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> wakeLock(wakeMutex_);
+            stopRequested_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
+    }
+    if (file_.is_open()) {
+        file_.close();
+        if (dropped_ > 0) {
+            qWarning() << "[ProtocolLogger] capture dropped" << dropped_.load()
+                       << "of" << (written_.load() + dropped_.load())
+                       << "messages (queue full)";
+        }
+    }
 }
 
 bool ProtocolLogger::isOpen() const
@@ -108,9 +183,19 @@ ProtocolLogger::OutputFormat ProtocolLogger::format() const
     return format_;
 }
 
-void ProtocolLogger::setIncludeMedia(bool includeMedia)
+void ProtocolLogger::setPayloadMode(PayloadMode mode)
 {
     std::lock_guard<std::mutex> lock(mutex_);
+    payloadMode_ = mode;
+}
+
+ProtocolLogger::PayloadMode ProtocolLogger::payloadMode() const
+{
+    return payloadMode_;
+}
+
+void ProtocolLogger::setIncludeMedia(bool includeMedia)
+{
     includeMedia_ = includeMedia;
 }
 
@@ -119,6 +204,13 @@ bool ProtocolLogger::includeMedia() const
     return includeMedia_;
 }
 
+void ProtocolLogger::setQueueLimits(size_t maxEntries, size_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxQueueEntries_ = std::max<size_t>(maxEntries, 2);
+    maxQueueBytes_ = maxBytes;
+}
+
 void ProtocolLogger::attach(Messenger* messenger)
 {
     detach();
@@ -127,16 +219,12 @@ void ProtocolLogger::attach(Messenger* messenger)
 
     connect(messenger_, &Messenger::messageReceived,
             this, [this](uint8_t ch, uint16_t msgId, const QByteArray& payload,
-                         int dataOffset, MessageType) {
-                log("Phone->HU", ch, msgId,
-                    reinterpret_cast<const uint8_t*>(payload.constData() + dataOffset),
-                    payload.size() - dataOffset);
+                         int dataOffset, MessageType messageType) {
+                record(false, ch, msgId, messageType, payload, dataOffset);
             });
     connect(messenger_, &Messenger::messageSent,
             this, [this](uint8_t ch, uint16_t msgId, const QByteArray& payload) {
-                log("HU->Phone", ch, msgId,
-                    reinterpret_cast<const uint8_t*>(payload.constData()),
-                    payload.size());
+                record(true, ch, msgId, MessageType::Specific, payload);
             });
 }
 
@@ -152,62 +240,200 @@ void ProtocolLogger::log(const std::string& direction,
                           uint8_t channelId, uint16_t messageId,
                           const uint8_t* payload, size_t payloadSize)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!open_) return;
+    record(direction == "HU->Phone", channelId, messageId, MessageType::Specific,
+           payload, payloadSize);
+}
+
+void ProtocolLogger::record(bool outbound, uint8_t channelId, uint16_t messageId,
+                            MessageType messageType,
+                            const uint8_t* payload, size_t payloadSize)
+{
+    if (!open_)
+        return;
+    if (!includeMedia_ && isAVMediaFrame(channelId, messageId))
+        return;
+    record(outbound, channelId, messageId, messageType,
+           QByteArray(reinterpret_cast<const char*>(payload),
+                      static_cast<qsizetype>(payloadSize)));
+}
+
+void ProtocolLogger::record(bool outbound, uint8_t channelId, uint16_t messageId,
+                            MessageType messageType,
+                            const QByteArray& payload, int dataOffset)
+{
+    if (!open_)
+        return;
+    if (!includeMedia_ && isAVMediaFrame(channelId, messageId))
+        return;
 
-    const bool isDataMsg = isAVMediaFrame(channelId, messageId);
-    if (!includeMedia_ && isDataMsg) {
+    // The entry pins the whole shared payload, so that is what the byte
+    // budget counts.
+    const size_t bytes = static_cast<size_t>(payload.size());
+    if (queuedBytes_.load(std::memory_order_relaxed) + bytes > activeQueueBytes_) {
+        ++pendingDrops_;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
         return;
     }
 
-    auto now = std::chrono::steady_clock::now();
-    const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now - startTime_).count();
-
-    if (format_ == OutputFormat::Jsonl) {
-        std::ostringstream line;
-        line << "{\"ts_ms\":" << elapsedMs
-             << ",\"direction\":\"" << jsonEscape(direction) << "\""
-             << ",\"channel_id\":" << static_cast<int>(channelId)
-             << ",\"message_id\":" << messageId
-             << ",\"message_name\":\"" << jsonEscape(messageName(channelId, messageId)) << "\""
-             << ",\"payload_hex\":\"" << hexNoSpaces(payload, payloadSize) << "\"}\n";
-        file_ << line.str();
-        file_.flush();
+    Entry entry;
+    entry.elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime_).count();
+    entry.payload = payload;
+    entry.dataOffset = dataOffset;
+    entry.droppedBefore = pendingDrops_;
+    entry.messageId = messageId;
+    entry.channelId = channelId;
+    entry.outbound = outbound;
+    entry.messageType = messageType;
+
+    queuedBytes_.fetch_add(bytes, std::memory_order_relaxed);
+    if (!queue_->tryPush(std::move(entry))) {
+        queuedBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+        ++pendingDrops_;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
         return;
     }
+    pendingDrops_ = 0;
+    // Only an idle writer needs waking; a busy one drains in the same pass.
+    if (queue_->sizeApprox() == 1)
+        wake_.notify_one();
+}
 
-    const auto elapsed = std::chrono::duration<double>(now - startTime_).count();
+void ProtocolLogger::writerLoop()
+{
+    std::string batch;
+    batch.reserve(kBatchBytes + 4096);
+    Entry entry;
+    for (;;) {
+        bool wrote = false;
+        while (queue_->tryPop(entry)) {
+            const size_t bytes = static_cast<size_t>(entry.payload.size());
+            format(entry, batch);
+            entry.payload = QByteArray();
+            queuedBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+            written_.fetch_add(1, std::memory_order_relaxed);
+            if (batch.size() >= kBatchBytes) {
+                file_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                batch.clear();
+                wrote = true;
+            }
+        }
+        if (!batch.empty()) {
+            file_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            batch.clear();
+            wrote = true;
+        }
+        if (wrote)
+            file_.flush();
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        if (stopRequested_ && queue_->sizeApprox() == 0)
+            return;
+        wake_.wait_for(lock, kIdleWait, [this]() {
+            return stopRequested_ || queue_->sizeApprox() > 0;
+        });
+    }
+}
 
-    // Hex preview of first 64 payload bytes
-    std::ostringstream hex;
-    const size_t previewMax = 64;
+void ProtocolLogger::format(const Entry& entry, std::string& out) const
+{
+    const auto* payload = reinterpret_cast<const uint8_t*>(
+        entry.payload.constData() + entry.dataOffset);
+    const size_t payloadSize = static_cast<size_t>(entry.payload.size() - entry.dataOffset);
+    const bool digest = activePayloadMode_ == PayloadMode::Digest;
+
+    if (activeFormat_ == OutputFormat::Binary) {
+        uint8_t flags = 0;
+        if (entry.outbound)
+            flags |= capture::Outbound;
+        if (entry.messageType == MessageType::Control)
+            flags |= capture::ControlMessage;
+        if (entry.droppedBefore > 0)
+            flags |= capture::GapBefore;
+
+        if (digest) {
+            flags |= capture::Digest;
+            uint8_t summary[capture::kDigestPayloadSize];
+            qToLittleEndian(fnv1a64(payload, payloadSize), summary);
+            qToLittleEndian(static_cast<uint32_t>(payloadSize), summary + 8);
+            capture::writeRecord(out, static_cast<uint64_t>(entry.elapsedUs),
+                                 entry.channelId, entry.messageId, flags,
+                                 summary, sizeof(summary));
+        } else {
+            capture::writeRecord(out, static_cast<uint64_t>(entry.elapsedUs),
+                                 entry.channelId, entry.messageId, flags,
+                                 payload, payloadSize);
+        }
+        return;
+    }
 
-    if (isDataMsg) {
-        hex << "[" << (channelId == ChannelId::Video
-                            || channelId == ChannelId::ClusterVideo
-                        ? "video" : "audio")
-            << " data]";
-    } else if (payloadSize > 0) {
-        size_t previewLen = std::min(payloadSize, previewMax);
-        for (size_t i = 0; i < previewLen; ++i) {
-            if (i > 0) hex << ' ';
-            hex << std::hex << std::setfill('0') << std::setw(2)
-                << static_cast<int>(payload[i]);
+    const char* direction = entry.outbound ? "HU->Phone" : "Phone->HU";
+
+    if (activeFormat_ == OutputFormat::Jsonl) {
+        out += "{\"ts_ms\":";
+        out += std::to_string(entry.elapsedUs / 1000);
+        out += ",\"direction\":\"";
+        out += direction;
+        out += "\",\"channel_id\":";
+        out += std::to_string(entry.channelId);
+        out += ",\"message_id\":";
+        out += std::to_string(entry.messageId);
+        out += ",\"message_name\":\"";
+        out += jsonEscape(messageName(entry.channelId, entry.messageId));
+        out += '"';
+        if (entry.droppedBefore > 0) {
+            out += ",\"dropped_before\":";
+            out += std::to_string(entry.droppedBefore);
+        }
+        if (digest) {
+            out += ",\"payload_size\":";
+            out += std::to_string(payloadSize);
+            out += ",\"payload_fnv1a\":\"";
+            appendDigest(out, fnv1a64(payload, payloadSize));
+        } else {
+            out += ",\"payload_hex\":\"";
+            appendHex(out, payload, payloadSize, false);
         }
-        if (payloadSize > previewMax) hex << "...";
+        out += "\"}\n";
+        return;
     }
 
-    std::ostringstream line;
-    line << std::fixed << std::setprecision(3) << elapsed << '\t'
-         << direction << '\t'
-         << "ch" << static_cast<int>(channelId) << "/" << channelName(channelId) << '\t'
-         << messageName(channelId, messageId) << '\t'
-         << payloadSize << '\t'
-         << hex.str() << '\n';
+    if (entry.droppedBefore > 0) {
+        out += "# dropped ";
+        out += std::to_string(entry.droppedBefore);
+        out += " messages\n";
+    }
 
-    file_ << line.str();
-    file_.flush();
+    char elapsed[32];
+    snprintf(elapsed, sizeof(elapsed), "%.3f", entry.elapsedUs / 1e6);
+    out += elapsed;
+    out += '\t';
+    out += direction;
+    out += "\tch";
+    out += std::to_string(entry.channelId);
+    out += '/';
+    out += channelName(entry.channelId);
+    out += '\t';
+    out += messageName(entry.channelId, entry.messageId);
+    out += '\t';
+    out += std::to_string(payloadSize);
+    out += '\t';
+
+    if (digest) {
+        out += "fnv1a=";
+        appendDigest(out, fnv1a64(payload, payloadSize));
+    } else if (isAVMediaFrame(entry.channelId, entry.messageId)) {
+        out += '[';
+        out += (entry.channelId == ChannelId::Video
+                || entry.channelId == ChannelId::ClusterVideo) ? "video" : "audio";
+        out += " data]";
+    } else if (payloadSize > 0) {
+        // Hex preview of first 64 payload bytes
+        appendHex(out, payload, std::min(payloadSize, kPreviewMax), true);
+        if (payloadSize > kPreviewMax)
+            out += "...";
+    }
+    out += '\n';
 }
 
 std::string ProtocolLogger::channelName(uint8_t id)
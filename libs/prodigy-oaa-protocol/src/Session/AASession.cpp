@@ -39,6 +39,9 @@ AASession::AASession(ITransport* transport, const SessionConfig& config,
     , transport_(transport)
     , messenger_(new Messenger(transport, this))
     , controlChannel_(new ControlChannel(this))
+    , stateTimer_(this)
+    , pingTimer_(this)
+    , pongDeadlineTimer_(this)
 {
     const SessionConfig defaults;
     if (config_.pingInterval <= 0) {
@@ -650,23 +653,8 @@ void AASession::onMessage(uint8_t channelId, uint16_t messageId,
     IChannelHandler* handler = it.value();
 
     // AV media data — route to IAVChannelHandler if applicable
-    if (messageId == 0x0000 || messageId == 0x0001) {
-        auto* avHandler = qobject_cast<IAVChannelHandler*>(handler);
-        if (avHandler) {
-            const char* data = payload.constData() + dataOffset;
-            if (messageId == 0x0000 && dataSize >= 8) {
-                // AV_MEDIA_WITH_TIMESTAMP: first 8 bytes = uint64 BE timestamp
-                uint64_t timestamp = 0;
-                for (int i = 0; i < 8; ++i)
-                    timestamp = (timestamp << 8) | static_cast<uint8_t>(data[i]);
-                avHandler->onMediaData(payload.mid(dataOffset + 8), timestamp);
-            } else {
-                // AV_MEDIA_INDICATION: no timestamp
-                avHandler->onMediaData(payload.mid(dataOffset), 0);
-            }
-            return;
-        }
-    }
+    if (IAVChannelHandler::dispatchMedia(handler, messageId, payload, dataOffset))
+        return;
 
     // Regular message dispatch — pass full payload with offset
     handler->onMessage(messageId, payload, dataOffset);
@@ -0,0 +1,98 @@
+#include <oaa/Session/ProtocolThread.hpp>
+
+#include <QDebug>
+#include <QMetaObject>
+
+namespace oaa {
+
+ProtocolThread::ProtocolThread()
+{
+    thread_.setObjectName(QStringLiteral("oaa-protocol"));
+}
+
+ProtocolThread::~ProtocolThread()
+{
+    stop();
+}
+
+void ProtocolThread::start()
+{
+    if (thread_.isRunning())
+        return;
+
+    context_ = new QObject;
+    context_->moveToThread(&thread_);
+    thread_.start();
+}
+
+void ProtocolThread::stop()
+{
+    if (!thread_.isRunning())
+        return;
+
+    thread_.quit();
+    thread_.wait();
+    // The loop has exited, so nothing can still be dispatching to context_.
+    delete context_;
+    context_ = nullptr;
+}
+
+bool ProtocolThread::isRunning() const
+{
+    return thread_.isRunning();
+}
+
+bool ProtocolThread::isCurrentThread() const
+{
+    return QThread::currentThread() == &thread_;
+}
+
+bool ProtocolThread::attach(QObject* object)
+{
+    if (!object)
+        return false;
+    if (object->parent()) {
+        qWarning() << "[ProtocolThread] cannot attach parented object"
+                   << object->metaObject()->className();
+        return false;
+    }
+    Q_ASSERT(QThread::currentThread() == object->thread());
+    object->moveToThread(&thread_);
+    return true;
+}
+
+void ProtocolThread::detach(QObject* object, QThread* target)
+{
+    if (!object || !target)
+        return;
+    if (object->thread() != &thread_) {
+        Q_ASSERT(QThread::currentThread() == object->thread());
+        object->moveToThread(target);
+        return;
+    }
+    invokeBlocking([object, target]() { object->moveToThread(target); });
+}
+
+void ProtocolThread::invokeBlocking(const std::function<void()>& fn)
+{
+    if (!fn)
+        return;
+    if (!thread_.isRunning() || isCurrentThread()) {
+        fn();
+        return;
+    }
+    QMetaObject::invokeMethod(context_, fn, Qt::BlockingQueuedConnection);
+}
+
+void ProtocolThread::post(std::function<void()> fn)
+{
+    if (!fn)
+        return;
+    if (!thread_.isRunning()) {
+        fn();
+        return;
+    }
+    QMetaObject::invokeMethod(context_, std::move(fn), Qt::QueuedConnection);
+}
+
+} // namespace oaa
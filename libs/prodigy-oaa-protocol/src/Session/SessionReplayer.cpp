@@ -0,0 +1,182 @@
+#include <oaa/Session/SessionReplayer.hpp>
+#include <oaa/Channel/ChannelId.hpp>
+#include <oaa/Channel/IAVChannelHandler.hpp>
+#include <oaa/Channel/MessageIds.hpp>
+
+#include <QDebug>
+#include <algorithm>
+#include <limits>
+
+namespace oaa {
+
+SessionReplayer::SessionReplayer(QObject* parent)
+    : QObject(parent)
+    , pumpTimer_(this)
+{
+    pumpTimer_.setSingleShot(true);
+    pumpTimer_.setTimerType(Qt::PreciseTimer);
+    connect(&pumpTimer_, &QTimer::timeout, this, &SessionReplayer::pump);
+}
+
+SessionReplayer::~SessionReplayer() = default;
+
+void SessionReplayer::registerChannel(uint8_t channelId, IChannelHandler* handler)
+{
+    if (auto* previous = channels_.value(channelId, nullptr))
+        disconnect(previous, nullptr, this, nullptr);
+    channels_.insert(channelId, handler);
+    if (!handler)
+        return;
+    connect(handler, &IChannelHandler::sendRequested, this,
+            [this](uint8_t, uint16_t, const QByteArray&) { ++stats_.handlerSends; });
+}
+
+bool SessionReplayer::open(const std::string& path)
+{
+    stop();
+    hasPending_ = false;
+    haveBase_ = false;
+    stats_ = {};
+    error_.clear();
+    if (!reader_.open(path)) {
+        error_ = reader_.error();
+    } else if (reader_.fileFlags() & capture::PayloadDigests) {
+        reader_.close();
+        error_ = "capture holds payload digests only";
+    }
+    if (!error_.empty()) {
+        qWarning() << "[SessionReplayer]" << QString::fromStdString(error_);
+        return false;
+    }
+    return true;
+}
+
+void SessionReplayer::start()
+{
+    if (running_ || !reader_.isOpen())
+        return;
+    running_ = true;
+    clock_.start();
+    pumpTimer_.start(0);
+}
+
+void SessionReplayer::stop()
+{
+    pumpTimer_.stop();
+    running_ = false;
+    closeChannels();
+}
+
+bool SessionReplayer::step()
+{
+    if (!hasPending_ && !readAhead())
+        return false;
+    hasPending_ = false;
+    dispatch(pending_);
+    return true;
+}
+
+bool SessionReplayer::readAhead()
+{
+    if (!reader_.next(pending_)) {
+        if (!reader_.error().empty()) {
+            error_ = reader_.error();
+            qWarning() << "[SessionReplayer] capture ends early:"
+                       << QString::fromStdString(error_);
+        }
+        return false;
+    }
+    if (!haveBase_) {
+        haveBase_ = true;
+        baseTimestampUs_ = pending_.timestampUs;
+    }
+    stats_.captureUs = static_cast<int64_t>(pending_.timestampUs - baseTimestampUs_);
+    hasPending_ = true;
+    return true;
+}
+
+void SessionReplayer::pump()
+{
+    const int budget = pace_ == Pace::MaxSpeed ? kMaxSpeedBatch
+                                               : std::numeric_limits<int>::max();
+    for (int n = 0; n < budget && running_; ++n) {
+        if (!hasPending_ && !readAhead()) {
+            finish();
+            return;
+        }
+
+        if (pace_ == Pace::WallClock) {
+            const int64_t dueUs = static_cast<int64_t>(pending_.timestampUs - baseTimestampUs_);
+            const int64_t nowUs = clock_.nsecsElapsed() / 1000;
+            if (dueUs > nowUs) {
+                pumpTimer_.start(static_cast<int>((dueUs - nowUs + 999) / 1000));
+                return;
+            }
+            stats_.maxLagUs = std::max(stats_.maxLagUs, nowUs - dueUs);
+        }
+
+        hasPending_ = false;
+        dispatch(pending_);
+    }
+    if (running_)
+        pumpTimer_.start(0);
+}
+
+void SessionReplayer::dispatch(const CaptureRecord& record)
+{
+    ++stats_.records;
+    if (record.gapBefore)
+        ++stats_.gaps;
+    if (record.outbound) {
+        ++stats_.outboundSkipped;
+        return;
+    }
+
+    IChannelHandler* handler = channels_.value(record.channelId, nullptr);
+    if (record.channelId == ChannelId::Control || !handler) {
+        ++stats_.unhandled;
+        return;
+    }
+
+    if (record.messageId == SessionMessageId::CHANNEL_OPEN_REQUEST
+        && record.messageType == MessageType::Control) {
+        openChannel(record.channelId, handler);
+        return;
+    }
+    if (!openChannels_.contains(record.channelId))
+        openChannel(record.channelId, handler);
+
+    ++stats_.dispatched;
+    stats_.dispatchedBytes += record.payload.size();
+    if (IAVChannelHandler::dispatchMedia(handler, record.messageId, record.payload, 0))
+        return;
+    handler->onMessage(record.messageId, record.payload, 0);
+}
+
+void SessionReplayer::openChannel(uint8_t channelId, IChannelHandler* handler)
+{
+    if (openChannels_.contains(channelId))
+        return;
+    openChannels_.insert(channelId);
+    handler->onChannelOpened();
+}
+
+void SessionReplayer::closeChannels()
+{
+    const auto open = openChannels_;
+    openChannels_.clear();
+    for (uint8_t channelId : open) {
+        if (auto* handler = channels_.value(channelId, nullptr))
+            handler->onChannelClosed();
+    }
+}
+
+void SessionReplayer::finish()
+{
+    stats_.elapsedUs = clock_.nsecsElapsed() / 1000;
+    running_ = false;
+    closeChannels();
+    emit finished();
+}
+
+} // namespace oaa
@@ -0,0 +1,71 @@
+#pragma once
+
+// Heap allocation counting for tests and benchmarks. QByteArray storage
+// comes from malloc, so operator new alone would miss almost all of it.
+// Defines malloc/calloc/realloc: include from exactly one translation unit
+// per executable. OAA_COUNT_ALLOCATIONS is only defined where glibc's
+// __libc_* entry points make the interposition possible.
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+static std::atomic<bool> g_countAllocations{false};
+static std::atomic<quint64> g_allocations{0};
+
+void* malloc(size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed))
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed))
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed))
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+}
+#define OAA_COUNT_ALLOCATIONS 1
+#endif
+
+namespace {
+
+/// Reset the counter and start counting.
+inline void beginAllocationCount()
+{
+#ifdef OAA_COUNT_ALLOCATIONS
+    g_allocations = 0;
+    g_countAllocations = true;
+#endif
+}
+
+/// Stop counting and return the allocations since beginAllocationCount(),
+/// or 0 where counting is unavailable.
+inline quint64 endAllocationCount()
+{
+#ifdef OAA_COUNT_ALLOCATIONS
+    g_countAllocations = false;
+    return g_allocations.load();
+#else
+    return 0;
+#endif
+}
+
+} // namespace
@@ -0,0 +1,310 @@
+#include <QtTest/QtTest>
+#include <oaa/Channel/ChannelId.hpp>
+#include <oaa/Channel/MessageIds.hpp>
+#include <oaa/Messenger/Cryptor.hpp>
+#include <oaa/Messenger/EncryptionPolicy.hpp>
+#include <oaa/Messenger/FrameHeader.hpp>
+#include <oaa/Messenger/FrameSerializer.hpp>
+#include <oaa/Messenger/Messenger.hpp>
+#include <oaa/Transport/ReplayTransport.hpp>
+#include <QElapsedTimer>
+#include <QtEndian>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+
+// Receive-path benchmark: a synthetic phone session is pushed through
+// ReplayTransport -> FrameParser -> FrameAssembler -> Messenger exactly as
+// TCPTransport chunks would arrive, with TLS off and on.
+//
+// Reported per row: throughput (as the QtTest benchmark result), per-message
+// latency from the start of the transport chunk that completed the message
+// to messageReceived, and heap allocations per delivered message.
+//
+//   prodigy-oaa-protocol-bench                  full run
+//   prodigy-oaa-protocol-bench pipeline:tls     one row
+
+namespace {
+
+struct TraceMessage {
+    uint8_t channelId;
+    uint16_t messageId;
+    QByteArray body;  // everything after the message ID
+};
+
+// Deterministic stand-in for a phone session: 1080p60 H.264 on the video
+// channel (IDR every second, P-frames in between), 48 kHz stereo PCM in
+// 10 ms bursts on media audio, 16 kHz speech bursts, and a trickle of
+// control, navigation and media-status traffic.
+QList<TraceMessage> buildTrace(int seconds)
+{
+    QList<TraceMessage> trace;
+    quint32 lcg = 0x0a0a0a0a;
+    auto next = [&lcg]() {
+        lcg = lcg * 1664525u + 1013904223u;
+        return lcg >> 8;
+    };
+    auto media = [](uint64_t timestampUs, int size, char fill) {
+        QByteArray body(8 + size, fill);
+        qToBigEndian(timestampUs, body.data());
+        return body;
+    };
+
+    constexpr int kTickUs = 10000 / 6;  // 600 Hz scheduling grid
+    const int ticks = seconds * 600;
+    for (int tick = 0; tick < ticks; ++tick) {
+        const uint64_t nowUs = uint64_t(tick) * kTickUs;
+
+        if (tick % 10 == 0) {
+            const int frame = tick / 10;
+            // Annex B access unit: IDR ~120 KB once a second, P 18-45 KB.
+            const bool idr = frame % 60 == 0;
+            const int size = idr ? 120 * 1024 : 18 * 1024 + int(next() % (27 * 1024));
+            QByteArray body = media(nowUs, size, idr ? 'I' : 'P');
+            body[8] = 0; body[9] = 0; body[10] = 0; body[11] = 1;
+            body[12] = idr ? char(0x65) : char(0x41);
+            trace.append({oaa::ChannelId::Video,
+                          oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP, body});
+        }
+        if (tick % 6 == 0) {
+            // 10 ms of 48 kHz 16-bit stereo.
+            trace.append({oaa::ChannelId::MediaAudio,
+                          oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP,
+                          media(nowUs, 1920, 'a')});
+        }
+        if (tick % 12 == 3 && (tick / 600) % 2 == 1) {
+            // 20 ms of 16 kHz mono guidance every other second.
+            trace.append({oaa::ChannelId::SpeechAudio,
+                          oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP,
+                          media(nowUs, 640, 's')});
+        }
+        if (tick % 60 == 7) {
+            trace.append({oaa::ChannelId::MediaStatus,
+                          oaa::MediaStatusMessageId::PLAYBACK_STATUS,
+                          QByteArray(18 + int(next() % 24), 'm')});
+        }
+        if (tick % 300 == 11) {
+            trace.append({oaa::ChannelId::Navigation,
+                          oaa::NavigationMessageId::NAV_TURN_EVENT,
+                          QByteArray(40 + int(next() % 40), 'n')});
+        }
+        if (tick % 600 == 13) {
+            // Ping request: one of the control messages sent in the clear.
+            trace.append({oaa::ChannelId::Control, 0x000b, QByteArray(10, 'p')});
+        }
+    }
+    return trace;
+}
+
+// Serializes the trace phone-side. Encrypted frames are produced by the TLS
+// peer exactly as the Messenger's own send path builds them.
+QByteArray encodeTrace(const QList<TraceMessage>& trace, oaa::Cryptor* peer)
+{
+    const oaa::EncryptionPolicy policy;
+    QByteArray wire;
+    QByteArray plaintext;
+    for (const auto& message : trace) {
+        const bool encrypt = peer
+            && policy.shouldEncrypt(message.channelId, message.messageId, true);
+        if (!encrypt) {
+            oaa::FrameSerializer::appendMessage(wire, message.channelId,
+                                                oaa::MessageType::Specific,
+                                                message.messageId, message.body);
+            continue;
+        }
+
+        plaintext.resize(2 + message.body.size());
+        qToBigEndian(message.messageId, plaintext.data());
+        memcpy(plaintext.data() + 2, message.body.constData(), message.body.size());
+
+        const int count = oaa::FrameSerializer::frameCount(plaintext.size());
+        for (int i = 0; i < count; ++i) {
+            const int offset = i * oaa::FrameSerializer::FRAME_MAX_PAYLOAD;
+            const int chunk = std::min<int>(oaa::FrameSerializer::FRAME_MAX_PAYLOAD,
+                                            plaintext.size() - offset);
+            const auto type = oaa::FrameSerializer::frameTypeFor(i, count);
+            const int headerLen = oaa::FrameSerializer::headerLength(type);
+            const qsizetype headerAt = wire.size();
+            wire.resize(headerAt + headerLen);
+            if (!peer->encryptInto(plaintext.constData() + offset, chunk, wire)
+                     .isComplete())
+                return {};
+            oaa::FrameSerializer::writeHeader(
+                wire.data() + headerAt,
+                oaa::FrameHeader{message.channelId, type,
+                                 oaa::EncryptionType::Encrypted,
+                                 oaa::MessageType::Specific},
+                static_cast<uint16_t>(wire.size() - headerAt - headerLen),
+                static_cast<uint32_t>(plaintext.size()));
+        }
+    }
+    return wire;
+}
+
+QList<QByteArray> chunkWire(const QByteArray& wire, int chunkSize)
+{
+    QList<QByteArray> chunks;
+    for (qsizetype offset = 0; offset < wire.size(); offset += chunkSize)
+        chunks.append(wire.mid(offset, chunkSize));
+    return chunks;
+}
+
+qint64 monotonicNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+class BenchProtocolPipeline : public QObject {
+    Q_OBJECT
+
+private:
+    static constexpr int kTraceSeconds = 2;
+    static constexpr int kPasses = 5;
+    // Stand-in for one TCPTransport readyRead() chunk.
+    static constexpr int kChunkSize = 32 * 1024;
+
+    QList<TraceMessage> trace_;
+    qint64 traceBytes_ = 0;
+
+    bool driveHandshake(oaa::Messenger& messenger, oaa::ReplayTransport& transport,
+                        oaa::Cryptor& server)
+    {
+        if (!server.init(oaa::Cryptor::Role::Server))
+            return false;
+
+        int writeCursor = 0;
+        messenger.startHandshake();
+        for (int round = 0; round < 20; ++round) {
+            const auto written = transport.writtenData();
+            while (writeCursor < written.size()) {
+                // Handshake messages are single BULK frames: 4-byte header.
+                const QByteArray payload = written[writeCursor++].mid(4);
+                if (payload.size() < 2
+                    || !server.writeHandshakeBuffer(payload.mid(2)))
+                    return false;
+            }
+
+            server.doHandshake();
+            auto serverOut = server.readHandshakeBuffer();
+            if (!serverOut.isComplete())
+                return false;
+            if (!serverOut.data.isEmpty()) {
+                QByteArray frame;
+                oaa::FrameSerializer::appendMessage(frame, 0, oaa::MessageType::Specific,
+                                                    0x0003, serverOut.data);
+                transport.feedData(frame);
+            }
+
+            if (messenger.isEncrypted() && server.isActive())
+                return true;
+        }
+        return false;
+    }
+
+private slots:
+    void initTestCase() {
+        trace_ = buildTrace(kTraceSeconds);
+        for (const auto& message : trace_)
+            traceBytes_ += 2 + message.body.size();
+        qInfo().noquote() << QStringLiteral("[Bench] trace: %1 messages, %2 KiB over %3 s")
+                                 .arg(trace_.size()).arg(traceBytes_ / 1024)
+                                 .arg(kTraceSeconds);
+    }
+
+    void pipeline_data() {
+        QTest::addColumn<bool>("encrypted");
+        QTest::newRow("plain") << false;
+        QTest::newRow("tls") << true;
+    }
+
+    void pipeline() {
+        QFETCH(bool, encrypted);
+
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        oaa::Cryptor peer;
+        messenger.start();
+        if (encrypted)
+            QVERIFY(driveHandshake(messenger, transport, peer));
+
+        // Sized up front so the receive slot itself never allocates while
+        // allocations are being counted.
+        std::vector<qint64> latencies;
+        latencies.reserve(size_t(trace_.size()) * kPasses);
+        qint64 chunkStartNs = 0;
+        int delivered = 0;
+        QObject receiver;
+        connect(&messenger, &oaa::Messenger::messageReceived, &receiver,
+                [&](uint8_t, uint16_t, const QByteArray&, int, oaa::MessageType) {
+                    latencies.push_back(monotonicNs() - chunkStartNs);
+                    ++delivered;
+                });
+
+        // Warm-up pass: OpenSSL record mode, parser and assembler buffers.
+        for (const auto& chunk : chunkWire(encodeTrace(trace_, encrypted ? &peer : nullptr),
+                                           kChunkSize))
+            transport.feedData(chunk);
+        QCOMPARE(delivered, int(trace_.size()));
+        latencies.clear();
+        delivered = 0;
+
+        qint64 elapsedNs = 0;
+        quint64 allocations = 0;
+        for (int pass = 0; pass < kPasses; ++pass) {
+            // TLS records carry sequence numbers, so every pass is encoded
+            // fresh (outside the timed region).
+            const auto chunks = chunkWire(
+                encodeTrace(trace_, encrypted ? &peer : nullptr), kChunkSize);
+            QVERIFY(!chunks.isEmpty());
+
+            QElapsedTimer timer;
+            beginAllocationCount();
+            timer.start();
+            for (const auto& chunk : chunks) {
+                chunkStartNs = monotonicNs();
+                transport.feedData(chunk);
+            }
+            elapsedNs += timer.nsecsElapsed();
+            allocations += endAllocationCount();
+        }
+        QCOMPARE(delivered, int(trace_.size()) * kPasses);
+
+        std::sort(latencies.begin(), latencies.end());
+        auto percentileUs = [&latencies](double p) {
+            const size_t index = std::min(latencies.size() - 1,
+                                          size_t(p * (latencies.size() - 1)));
+            return latencies[index] / 1000.0;
+        };
+        const double seconds = elapsedNs / 1e9;
+        const double bytes = double(traceBytes_) * kPasses;
+#ifdef OAA_COUNT_ALLOCATIONS
+        const QString allocationsPerMessage =
+            QString::number(double(allocations) / delivered, 'f', 2);
+#else
+        Q_UNUSED(allocations)
+        const QString allocationsPerMessage = QStringLiteral("n/a");
+#endif
+
+        qInfo().noquote() << QStringLiteral(
+            "[Bench] %1: %2 MB/s, %3 msg/s, latency p50=%4 us p99=%5 us max=%6 us, "
+            "allocs/msg=%7")
+            .arg(QString::fromLatin1(QTest::currentDataTag()))
+            .arg(bytes / (1024.0 * 1024.0) / seconds, 0, 'f', 1)
+            .arg(delivered / seconds, 0, 'f', 0)
+            .arg(percentileUs(0.50), 0, 'f', 1)
+            .arg(percentileUs(0.99), 0, 'f', 1)
+            .arg(percentileUs(1.0), 0, 'f', 1)
+            .arg(allocationsPerMessage);
+
+        QTest::setBenchmarkResult(bytes / seconds, QTest::BytesPerSecond);
+    }
+};
+
+QTEST_MAIN(BenchProtocolPipeline)
+#include "bench_protocol_pipeline.moc"
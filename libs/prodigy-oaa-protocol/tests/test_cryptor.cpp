@@ -313,6 +313,44 @@ private slots:
         QVERIFY(!rejected.error.isEmpty());
     }
 
+    void testRecordIoTakesOverOnceHandshakeBuffersDrain() {
+        oaa::Cryptor client, server;
+        QVERIFY(client.init(oaa::Cryptor::Role::Client));
+        QVERIFY(server.init(oaa::Cryptor::Role::Server));
+        QVERIFY(driveHandshake(client, server));
+
+        // Post-handshake records still queued in a memory BIO (TLS 1.3
+        // session tickets) must be consumed before the switch, not dropped.
+        for (int round = 0; round < 3; ++round) {
+            const QByteArray down = QByteArray("down-") + QByteArray::number(round);
+            auto toClient = server.encrypt(down);
+            QVERIFY(toClient.isComplete());
+            auto atClient = client.decrypt(toClient.data, toClient.data.size());
+            QVERIFY2(atClient.isComplete(), qPrintable(atClient.error));
+            QCOMPARE(atClient.data, down);
+
+            const QByteArray up = QByteArray("up-") + QByteArray::number(round);
+            auto toServer = client.encrypt(up);
+            QVERIFY(toServer.isComplete());
+            auto atServer = server.decrypt(toServer.data, toServer.data.size());
+            QVERIFY2(atServer.isComplete(), qPrintable(atServer.error));
+            QCOMPARE(atServer.data, up);
+        }
+        QVERIFY(client.usesRecordIo());
+        QVERIFY(server.usesRecordIo());
+
+        oaa::Cryptor memoryClient, memoryServer;
+        QVERIFY(memoryClient.init(oaa::Cryptor::Role::Client));
+        QVERIFY(memoryServer.init(oaa::Cryptor::Role::Server));
+        memoryClient.setRecordIoEnabled(false);
+        QVERIFY(driveHandshake(memoryClient, memoryServer));
+        auto encrypted = memoryClient.encrypt(QByteArrayLiteral("memory"));
+        QVERIFY(encrypted.isComplete());
+        QCOMPARE(memoryServer.decrypt(encrypted.data, encrypted.data.size()).data,
+                 QByteArrayLiteral("memory"));
+        QVERIFY(!memoryClient.usesRecordIo());
+    }
+
     void testUninitializedRuntimeIoFailsClosed() {
         oaa::Cryptor cryptor;
         auto encrypted = cryptor.encrypt(QByteArrayLiteral("plaintext"));
@@ -0,0 +1,152 @@
+#include <QtTest/QtTest>
+#include <oaa/Messenger/Cryptor.hpp>
+
+#include <QElapsedTimer>
+
+// Compares the memory-BIO data path ("before") with record I/O over caller
+// buffers ("after") for full 16 KB AA frames. Throughput is reported, not
+// asserted: at this size AES-GCM dominates and the numbers depend on the CPU.
+class TestCryptorThroughput : public QObject {
+    Q_OBJECT
+
+private:
+    static constexpr int kFrameSize = 16 * 1024;
+    static constexpr int kFrames = 2000;
+
+    bool openPair(oaa::Cryptor& client, oaa::Cryptor& server, bool recordIo)
+    {
+        if (!client.init(oaa::Cryptor::Role::Client)
+            || !server.init(oaa::Cryptor::Role::Server))
+            return false;
+        client.setRecordIoEnabled(recordIo);
+        server.setRecordIoEnabled(recordIo);
+
+        for (int i = 0; i < 20; ++i) {
+            client.doHandshake();
+            auto clientOut = client.readHandshakeBuffer();
+            if (!clientOut.isComplete())
+                return false;
+            if (!clientOut.data.isEmpty()
+                && !server.writeHandshakeBuffer(clientOut.data))
+                return false;
+
+            server.doHandshake();
+            auto serverOut = server.readHandshakeBuffer();
+            if (!serverOut.isComplete())
+                return false;
+            if (!serverOut.data.isEmpty()
+                && !client.writeHandshakeBuffer(serverOut.data))
+                return false;
+
+            if (client.isActive() && server.isActive())
+                break;
+        }
+        if (!client.isActive() || !server.isActive())
+            return false;
+
+        // Drain post-handshake records (session tickets) so both ends can
+        // leave the memory BIOs before the measured loop.
+        auto ping = server.encrypt(QByteArrayLiteral("ping"));
+        if (!ping.isComplete()
+            || !client.decrypt(ping.data, ping.data.size()).isComplete())
+            return false;
+        auto pong = client.encrypt(QByteArrayLiteral("pong"));
+        return pong.isComplete()
+            && server.decrypt(pong.data, pong.data.size()).isComplete();
+    }
+
+    static double megabytesPerSecond(qint64 bytes, qint64 nsecs)
+    {
+        return nsecs > 0 ? (double(bytes) / (1024.0 * 1024.0)) / (nsecs / 1e9) : 0.0;
+    }
+
+    static void addModes()
+    {
+        QTest::addColumn<bool>("recordIo");
+        QTest::newRow("memory-bio") << false;
+        QTest::newRow("record-io") << true;
+    }
+
+private slots:
+    void testRoundTrip16k_data() { addModes(); }
+    void testRoundTrip16k() {
+        QFETCH(bool, recordIo);
+        oaa::Cryptor client, server;
+        QVERIFY(openPair(client, server, recordIo));
+        QCOMPARE(client.usesRecordIo(), recordIo);
+        QCOMPARE(server.usesRecordIo(), recordIo);
+
+        QByteArray frame(kFrameSize, Qt::Uninitialized);
+        for (int i = 0; i < frame.size(); ++i)
+            frame[i] = char(i * 31);
+
+        QByteArray wire;
+        for (int i = 0; i < 8; ++i) {
+            wire.resize(0);
+            auto encrypted = client.encryptInto(frame.constData(), frame.size(), wire);
+            QVERIFY2(encrypted.isComplete(), qPrintable(encrypted.error));
+            QVERIFY(wire.size() > frame.size());
+            QVERIFY(wire.size() <= frame.size() + oaa::TLS_OVERHEAD);
+
+            auto decrypted = server.decrypt(wire, wire.size());
+            QVERIFY2(decrypted.isComplete(), qPrintable(decrypted.error));
+            QCOMPARE(decrypted.data, frame);
+        }
+    }
+
+    void testThroughput16k() {
+        const QByteArray frame(kFrameSize, 'v');
+        const qint64 totalBytes = qint64(kFrames) * kFrameSize;
+        double encryptRate[2] = {};
+        double decryptRate[2] = {};
+
+        for (const bool recordIo : {false, true}) {
+            oaa::Cryptor client, server;
+            QVERIFY(openPair(client, server, recordIo));
+
+            // Reused output buffer, as the Messenger send path does.
+            QByteArray wire;
+            QElapsedTimer timer;
+            timer.start();
+            for (int i = 0; i < kFrames; ++i) {
+                wire.resize(0);
+                QVERIFY(client.encryptInto(frame.constData(), frame.size(),
+                                           wire).isComplete());
+            }
+            encryptRate[recordIo] = megabytesPerSecond(totalBytes, timer.nsecsElapsed());
+
+            QList<QByteArray> records;
+            records.reserve(kFrames);
+            for (int i = 0; i < kFrames; ++i)
+                records.append(client.encrypt(frame).data);
+
+            timer.restart();
+            for (const auto& record : records)
+                QVERIFY(server.decrypt(record, record.size()).isComplete());
+            decryptRate[recordIo] = megabytesPerSecond(totalBytes, timer.nsecsElapsed());
+        }
+
+        qInfo().noquote() << QStringLiteral(
+            "[Throughput] 16 KB frames: encrypt memory-bio=%1 MB/s record-io=%2 MB/s; "
+            "decrypt memory-bio=%3 MB/s record-io=%4 MB/s")
+            .arg(encryptRate[0], 0, 'f', 1).arg(encryptRate[1], 0, 'f', 1)
+            .arg(decryptRate[0], 0, 'f', 1).arg(decryptRate[1], 0, 'f', 1);
+    }
+
+    void benchmarkEncrypt16k_data() { addModes(); }
+    void benchmarkEncrypt16k() {
+        QFETCH(bool, recordIo);
+        oaa::Cryptor client, server;
+        QVERIFY(openPair(client, server, recordIo));
+
+        const QByteArray frame(kFrameSize, 'v');
+        QByteArray wire;
+        QBENCHMARK {
+            wire.resize(0);
+            client.encryptInto(frame.constData(), frame.size(), wire);
+        }
+    }
+};
+
+QTEST_MAIN(TestCryptorThroughput)
+#include "test_cryptor_throughput.moc"
@@ -121,6 +121,79 @@ private slots:
         QCOMPARE(lastHeader.totalMessageSize, uint32_t(0));
         QCOMPARE(spy[1][1].toByteArray().size(), 1); // 16385 - 16384 = 1
     }
+
+    void testWholeFramesShareTheChunk() {
+        oaa::FrameParser parser;
+        QSignalSpy spy(&parser, &oaa::FrameParser::frameParsed);
+
+        QByteArray payload1(1000, 'A');
+        QByteArray payload2(3000, 'B');
+        QByteArray frame1 = makeBulkFrame(1, payload1);
+        QByteArray chunk = frame1 + makeBulkFrame(2, payload2);
+        parser.onData(chunk);
+
+        QCOMPARE(spy.count(), 2);
+        QCOMPARE(spy[0][1].toByteArray(), payload1);
+        QCOMPARE(spy[1][1].toByteArray(), payload2);
+        QCOMPARE(parser.framesParsed(), quint64(2));
+        // Complete frames bypass the ring and alias the chunk: nothing moves.
+        QCOMPARE(parser.bytesCopied(), quint64(0));
+        const QByteArray second = spy[1][1].toByteArray();
+        QCOMPARE(second.constData(), chunk.constData() + frame1.size() + 4);
+
+        // The slices keep the storage alive after the chunk is gone.
+        chunk = QByteArray();
+        QCOMPARE(second, payload2);
+    }
+
+    void testRawDataChunkIsCopied() {
+        oaa::FrameParser parser;
+        QSignalSpy spy(&parser, &oaa::FrameParser::frameParsed);
+
+        QByteArray payload("borrowed");
+        const QByteArray frame = makeBulkFrame(1, payload);
+        parser.onData(QByteArray::fromRawData(frame.constData(), frame.size()));
+
+        QCOMPARE(spy.count(), 1);
+        QCOMPARE(spy[0][1].toByteArray(), payload);
+        QCOMPARE(parser.bytesCopied(), quint64(payload.size()));
+    }
+
+    void testPartialTailIsStagedThenResumed() {
+        oaa::FrameParser parser;
+        QSignalSpy spy(&parser, &oaa::FrameParser::frameParsed);
+
+        QByteArray payload1("first");
+        QByteArray payload2("second-frame");
+        QByteArray frame1 = makeBulkFrame(1, payload1);
+        QByteArray frame2 = makeBulkFrame(2, payload2);
+
+        parser.onData(frame1 + frame2.left(5));
+        QCOMPARE(spy.count(), 1);
+        parser.onData(frame2.mid(5));
+
+        QCOMPARE(spy.count(), 2);
+        QCOMPARE(spy[0][1].toByteArray(), payload1);
+        QCOMPARE(spy[1][1].toByteArray(), payload2);
+        // Only the staged tail and the payload decoded from it are copied.
+        QCOMPARE(parser.bytesCopied(), quint64(frame2.size() + payload2.size()));
+    }
+
+    void testResetFromReceiverDropsRestOfChunk() {
+        oaa::FrameParser parser;
+        int count = 0;
+        connect(&parser, &oaa::FrameParser::frameParsed, &parser,
+                [&](const oaa::FrameHeader&, const QByteArray&) {
+                    ++count;
+                    parser.reset();
+                });
+
+        parser.onData(makeBulkFrame(1, "one") + makeBulkFrame(2, "two"));
+        QCOMPARE(count, 1);
+
+        parser.onData(makeBulkFrame(3, "three"));
+        QCOMPARE(count, 2);
+    }
 };
 
 QTEST_MAIN(TestFrameParser)
@@ -43,6 +43,21 @@ private:
         return frame.mid(headerLen);
     }
 
+    // Helper to split one batched transport write back into frames
+    QList<QByteArray> splitFrames(const QByteArray& batch) {
+        QList<QByteArray> frames;
+        int offset = 0;
+        while (offset + 4 <= batch.size()) {
+            const auto header = oaa::FrameHeader::parse(batch.constData() + offset);
+            const int headerLen = 2 + oaa::FrameHeader::sizeFieldLength(header.frameType);
+            const int size = qFromBigEndian<uint16_t>(
+                reinterpret_cast<const uchar*>(batch.constData() + offset + 2));
+            frames.append(batch.mid(offset, headerLen + size));
+            offset += headerLen + size;
+        }
+        return frames;
+    }
+
     // Helper to build a hand-crafted frame for receive tests
     QByteArray buildFrame(uint8_t channelId, oaa::FrameType ft,
                           oaa::MessageType mt, oaa::EncryptionType et,
@@ -64,9 +79,13 @@ private:
         return frame;
     }
 
+    // With @p heldFlight, server output produced once the Messenger is
+    // already encrypted (TLS 1.3 session tickets) is returned there instead
+    // of being delivered.
     bool driveHandshake(oaa::Messenger& messenger,
                         oaa::ReplayTransport& transport,
-                        oaa::Cryptor& server)
+                        oaa::Cryptor& server,
+                        QByteArray* heldFlight = nullptr)
     {
         if (!server.init(oaa::Cryptor::Role::Server))
             return false;
@@ -92,7 +111,9 @@ private:
             auto serverOut = server.readHandshakeBuffer();
             if (!serverOut.isComplete())
                 return false;
-            if (!serverOut.data.isEmpty()) {
+            if (heldFlight && messenger.isEncrypted()) {
+                heldFlight->append(serverOut.data);
+            } else if (!serverOut.data.isEmpty()) {
                 QByteArray payload;
                 const uint16_t handshakeId = qToBigEndian(uint16_t(0x0003));
                 payload.append(reinterpret_cast<const char*>(&handshakeId), 2);
@@ -218,8 +239,10 @@ private slots:
         QByteArray payload(20000, 'X');
         messenger.sendMessage(1, 0x0100, payload);
 
-        auto written = transport.writtenData();
-        QVERIFY(written.size() >= 2);
+        // The whole frame batch is submitted with one transport write.
+        QCOMPARE(transport.writtenData().size(), 1);
+        auto written = splitFrames(transport.writtenData()[0]);
+        QCOMPARE(written.size(), 2);
 
         // First frame should be FIRST type
         auto hdr0 = parseHeader(written[0]);
@@ -443,13 +466,144 @@ private slots:
         oaa::Messenger messenger(&transport);
         messenger.start();
         transport.onWrite = [&messenger](int writeCount) {
-            if (writeCount == 1)
+            if (writeCount == 1) {
+                // Queued behind the in-flight batch; stop must drop it.
+                messenger.sendMessage(3, 0x5678, QByteArray("queued"));
                 messenger.stop();
+            }
         };
 
         messenger.sendMessage(3, 0x1234, QByteArray(20000, 'X'));
 
         QCOMPARE(transport.writtenData().size(), 1);
+        QCOMPARE(splitFrames(transport.writtenData()[0]).size(), 2);
+    }
+
+    void testEncryptedFragmentedSendRoundTrips() {
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        oaa::Cryptor server;
+
+        messenger.start();
+        QVERIFY(driveHandshake(messenger, transport, server));
+        transport.clearWritten();
+
+        QByteArray payload(40000, Qt::Uninitialized);
+        for (int i = 0; i < payload.size(); ++i)
+            payload[i] = char(i * 7);
+        messenger.sendMessage(3, 0x1234, payload);
+
+        QCOMPARE(transport.writtenData().size(), 1);
+        const auto frames = splitFrames(transport.writtenData()[0]);
+        QCOMPARE(frames.size(), 3);
+
+        QByteArray plaintext;
+        for (int i = 0; i < frames.size(); ++i) {
+            const auto header = parseHeader(frames[i]);
+            QCOMPARE(header.encryptionType, oaa::EncryptionType::Encrypted);
+            QCOMPARE(header.frameType, i == 0 ? oaa::FrameType::First
+                                       : i == 2 ? oaa::FrameType::Last
+                                                : oaa::FrameType::Middle);
+            if (i == 0) {
+                const uint32_t total = qFromBigEndian<uint32_t>(
+                    reinterpret_cast<const uchar*>(frames[i].constData() + 4));
+                QCOMPARE(total, uint32_t(2 + payload.size()));
+            }
+            const QByteArray cipher = extractPayload(frames[i], header.frameType);
+            QCOMPARE(int(parseFrameSize(frames[i])), cipher.size());
+            auto decrypted = server.decrypt(cipher, cipher.size());
+            QVERIFY(decrypted.isComplete());
+            plaintext.append(decrypted.data);
+        }
+
+        QCOMPARE(plaintext.size(), 2 + payload.size());
+        QCOMPARE(qFromBigEndian<uint16_t>(
+                     reinterpret_cast<const uchar*>(plaintext.constData())),
+                 uint16_t(0x1234));
+        QCOMPARE(plaintext.mid(2), payload);
+    }
+
+    void testPostHandshakeRecordsFeedTlsBeforeData() {
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        oaa::Cryptor server;
+        QSignalSpy messageSpy(&messenger, &oaa::Messenger::messageReceived);
+        QSignalSpy failureSpy(&messenger, &oaa::Messenger::tlsFailed);
+
+        messenger.start();
+        // The server's last flight (session tickets under TLS 1.3) reaches the
+        // Messenger as SSL_HANDSHAKE after its own side is already active.
+        QVERIFY(driveHandshake(messenger, transport, server));
+        QCOMPARE(messageSpy.count(), 0);
+
+        for (int i = 0; i < 3; ++i) {
+            QByteArray plaintext;
+            const uint16_t idBE = qToBigEndian(uint16_t(0x8001));
+            plaintext.append(reinterpret_cast<const char*>(&idBE), 2);
+            plaintext.append(QByteArray("status-") + QByteArray::number(i));
+            auto encrypted = server.encrypt(plaintext);
+            QVERIFY(encrypted.isComplete());
+            transport.feedData(buildFrame(
+                10, oaa::FrameType::Bulk, oaa::MessageType::Specific,
+                oaa::EncryptionType::Encrypted, encrypted.data));
+        }
+
+        QCOMPARE(failureSpy.count(), 0);
+        QCOMPARE(messageSpy.count(), 3);
+        for (int i = 0; i < 3; ++i) {
+            QCOMPARE(messageSpy[i][1].value<uint16_t>(), uint16_t(0x8001));
+            const QByteArray payload = messageSpy[i][2].toByteArray();
+            QCOMPARE(payload.mid(messageSpy[i][3].toInt()),
+                     QByteArray("status-") + QByteArray::number(i));
+        }
+    }
+
+    void testPostHandshakeRecordsAfterEncryptedTraffic() {
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        oaa::Cryptor server;
+        QSignalSpy messageSpy(&messenger, &oaa::Messenger::messageReceived);
+        QSignalSpy failureSpy(&messenger, &oaa::Messenger::tlsFailed);
+
+        messenger.start();
+        QByteArray tickets;
+        QVERIFY(driveHandshake(messenger, transport, server, &tickets));
+        QVERIFY(!tickets.isEmpty());
+
+        // Sending first moves the Messenger's TLS onto record IO, so the
+        // tickets land after the memory BIOs are gone.
+        transport.clearWritten();
+        messenger.sendMessage(10, 0x8001, QByteArrayLiteral("hello"));
+        const auto written = transport.writtenData();
+        QCOMPARE(written.size(), 1);
+        const QByteArray upstream = extractPayload(
+            written[0], parseHeader(written[0]).frameType);
+        auto atServer = server.decrypt(upstream, upstream.size());
+        QVERIFY2(atServer.isComplete(), qPrintable(atServer.error));
+
+        QByteArray ticketPayload;
+        const uint16_t handshakeId = qToBigEndian(uint16_t(0x0003));
+        ticketPayload.append(reinterpret_cast<const char*>(&handshakeId), 2);
+        ticketPayload.append(tickets);
+        transport.feedData(buildFrame(
+            0, oaa::FrameType::Bulk, oaa::MessageType::Specific,
+            oaa::EncryptionType::Plain, ticketPayload));
+        QCOMPARE(failureSpy.count(), 0);
+
+        QByteArray plaintext;
+        const uint16_t idBE = qToBigEndian(uint16_t(0x8001));
+        plaintext.append(reinterpret_cast<const char*>(&idBE), 2);
+        plaintext.append(QByteArrayLiteral("after-tickets"));
+        auto encrypted = server.encrypt(plaintext);
+        QVERIFY(encrypted.isComplete());
+        transport.feedData(buildFrame(
+            10, oaa::FrameType::Bulk, oaa::MessageType::Specific,
+            oaa::EncryptionType::Encrypted, encrypted.data));
+
+        QCOMPARE(failureSpy.count(), 0);
+        QCOMPARE(messageSpy.count(), 1);
+        const QByteArray payload = messageSpy[0][2].toByteArray();
+        QCOMPARE(payload.mid(messageSpy[0][3].toInt()), QByteArrayLiteral("after-tickets"));
     }
 
     void testFatalHandshakeEmitsOnceWithDiagnostic() {
@@ -1,5 +1,6 @@
 #include <QtTest/QtTest>
 #include <oaa/Messenger/ProtocolLogger.hpp>
+#include <oaa/Messenger/CaptureFile.hpp>
 #include <oaa/Channel/ChannelId.hpp>
 #include <oaa/Channel/MessageIds.hpp>
 #include <fstream>
@@ -203,6 +204,174 @@ private slots:
 
         std::remove(path.c_str());
     }
+
+    void testBinaryCaptureRoundTrip()
+    {
+        std::string path = "/tmp/test_protocol_logger.oacap";
+
+        oaa::ProtocolLogger logger;
+        logger.setFormat(oaa::ProtocolLogger::OutputFormat::Binary);
+        logger.setIncludeMedia(false);
+        logger.open(path);
+        QVERIFY(logger.isOpen());
+
+        const uint8_t open[] = {0x08, 0x03};
+        logger.record(false, oaa::ChannelId::Video, 0x0007, oaa::MessageType::Control,
+                      open, sizeof(open));
+        uint8_t frame[64] = {};
+        logger.record(false, oaa::ChannelId::Video, oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP,
+                      oaa::MessageType::Specific, frame, sizeof(frame));
+        logger.log("HU->Phone", oaa::ChannelId::Video, oaa::AVMessageId::ACK_INDICATION,
+                   nullptr, 0);
+        logger.close();
+
+        oaa::CaptureReader reader;
+        QVERIFY(reader.open(path));
+        QCOMPARE(reader.fileFlags(), 0u);
+
+        oaa::CaptureRecord record;
+        QVERIFY(reader.next(record));
+        QCOMPARE(record.channelId, uint8_t(oaa::ChannelId::Video));
+        QCOMPARE(record.messageId, uint16_t(0x0007));
+        QVERIFY(record.messageType == oaa::MessageType::Control);
+        QVERIFY(!record.outbound);
+        QCOMPARE(record.payload, QByteArray("\x08\x03", 2));
+        const uint64_t firstUs = record.timestampUs;
+
+        // Media was excluded; the outbound ACK follows directly.
+        QVERIFY(reader.next(record));
+        QVERIFY(record.outbound);
+        QCOMPARE(record.messageId, uint16_t(oaa::AVMessageId::ACK_INDICATION));
+        QVERIFY(record.payload.isEmpty());
+        QVERIFY(record.timestampUs >= firstUs);
+
+        QVERIFY(!reader.next(record));
+        QVERIFY(reader.error().empty());
+
+        std::remove(path.c_str());
+    }
+
+    void testBinaryCaptureReaderStopsAtTruncatedRecord()
+    {
+        std::string path = "/tmp/test_protocol_logger_truncated.oacap";
+
+        oaa::ProtocolLogger logger;
+        logger.setFormat(oaa::ProtocolLogger::OutputFormat::Binary);
+        logger.open(path);
+        const uint8_t payload[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        logger.log("Phone->HU", oaa::ChannelId::MediaStatus, 0x8001, payload, sizeof(payload));
+        logger.log("Phone->HU", oaa::ChannelId::MediaStatus, 0x8001, payload, sizeof(payload));
+        logger.close();
+
+        // Cut the second record short, as a crash mid-write would.
+        QFile file(QString::fromStdString(path));
+        QVERIFY(file.resize(file.size() - 3));
+
+        oaa::CaptureReader reader;
+        QVERIFY(reader.open(path));
+        QCOMPARE(reader.fileFlags(), uint32_t(oaa::capture::IncludesMedia));
+        oaa::CaptureRecord record;
+        QVERIFY(reader.next(record));
+        QCOMPARE(record.payload.size(), qsizetype(sizeof(payload)));
+        QVERIFY(!reader.next(record));
+        QCOMPARE(reader.error(), std::string("truncated record payload"));
+
+        oaa::CaptureReader notCapture;
+        QVERIFY(!notCapture.open("/nonexistent/capture.oacap"));
+        QVERIFY(!notCapture.error().empty());
+
+        std::remove(path.c_str());
+    }
+
+    void testDigestPayloadMode()
+    {
+        std::string path = "/tmp/test_protocol_logger_digest.jsonl";
+
+        oaa::ProtocolLogger logger;
+        logger.setFormat(oaa::ProtocolLogger::OutputFormat::Jsonl);
+        logger.setPayloadMode(oaa::ProtocolLogger::PayloadMode::Digest);
+        logger.open(path);
+        const uint8_t payload[] = {'a'};
+        logger.log("Phone->HU", oaa::ChannelId::Control, 0x000B, payload, sizeof(payload));
+        logger.close();
+        QCOMPARE(logger.writtenCount(), uint64_t(1));
+
+        std::ifstream f(path);
+        std::string line;
+        QVERIFY(std::getline(f, line));
+        QVERIFY(line.find("\"payload_size\":1") != std::string::npos);
+        QVERIFY(line.find("\"payload_fnv1a\":\"af63dc4c8601ec8c\"") != std::string::npos);
+        QVERIFY(line.find("payload_hex") == std::string::npos);
+
+        std::remove(path.c_str());
+    }
+
+    void testFullQueueDropsAndMarksGap()
+    {
+        std::string path = "/tmp/test_protocol_logger_drops.jsonl";
+
+        // A zero byte budget rejects every non-empty payload, so the drops
+        // do not depend on how fast the writer thread runs.
+        oaa::ProtocolLogger logger;
+        logger.setFormat(oaa::ProtocolLogger::OutputFormat::Jsonl);
+        logger.setQueueLimits(8, 0);
+        logger.open(path);
+        const uint8_t payload[] = {0x01, 0x02};
+        for (int i = 0; i < 3; ++i)
+            logger.log("Phone->HU", oaa::ChannelId::Sensor, 0x8003, payload, sizeof(payload));
+        logger.log("HU->Phone", oaa::ChannelId::Control, 0x000C, nullptr, 0);
+        logger.close();
+
+        QCOMPARE(logger.droppedCount(), uint64_t(3));
+        QCOMPARE(logger.writtenCount(), uint64_t(1));
+
+        std::ifstream f(path);
+        std::string line;
+        QVERIFY(std::getline(f, line));
+        QVERIFY(line.find("\"message_name\":\"PING_RESPONSE\"") != std::string::npos);
+        QVERIFY(line.find("\"dropped_before\":3") != std::string::npos);
+        std::string extra;
+        QVERIFY(!std::getline(f, extra));
+
+        std::remove(path.c_str());
+    }
+
+    void testBinaryCaptureSurvivesBurst()
+    {
+        std::string path = "/tmp/test_protocol_logger_burst.oacap";
+
+        oaa::ProtocolLogger logger;
+        logger.setFormat(oaa::ProtocolLogger::OutputFormat::Binary);
+        logger.setQueueLimits(64, 1024 * 1024);
+        logger.open(path);
+        const QByteArray frame(16 * 1024, 'v');
+        constexpr int kMessages = 5000;
+        for (int i = 0; i < kMessages; ++i) {
+            logger.record(false, oaa::ChannelId::Video, oaa::AVMessageId::AV_MEDIA_INDICATION,
+                          oaa::MessageType::Specific, frame, 2);
+        }
+        logger.close();
+        QCOMPARE(logger.writtenCount() + logger.droppedCount(), uint64_t(kMessages));
+
+        oaa::CaptureReader reader;
+        QVERIFY(reader.open(path));
+        oaa::CaptureRecord record;
+        uint64_t records = 0;
+        uint64_t gaps = 0;
+        uint64_t lastUs = 0;
+        while (reader.next(record)) {
+            ++records;
+            gaps += record.gapBefore;
+            QCOMPARE(record.payload.size(), frame.size() - 2);
+            QVERIFY(record.timestampUs >= lastUs);
+            lastUs = record.timestampUs;
+        }
+        QVERIFY(reader.error().empty());
+        QCOMPARE(records, logger.writtenCount());
+        QCOMPARE(gaps > 0, logger.droppedCount() > 0);
+
+        std::remove(path.c_str());
+    }
 };
 
 QTEST_MAIN(TestProtocolLogger)
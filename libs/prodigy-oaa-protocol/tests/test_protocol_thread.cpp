@@ -0,0 +1,219 @@
+#include <QtTest/QtTest>
+#include <oaa/Session/ProtocolThread.hpp>
+#include <oaa/Messenger/Messenger.hpp>
+#include <oaa/Messenger/FrameHeader.hpp>
+#include <oaa/Transport/ReplayTransport.hpp>
+#include <QtEndian>
+#include <functional>
+
+class ReentrantReplayTransport : public oaa::ReplayTransport {
+public:
+    using ReplayTransport::ReplayTransport;
+
+    void write(const QByteArray& data) override {
+        ReplayTransport::write(data);
+        ++writeCount;
+        if (onWrite)
+            onWrite(writeCount);
+    }
+
+    int writeCount = 0;
+    std::function<void(int)> onWrite;
+};
+
+// Owner-thread stand-in for a channel handler's send edge.
+class SendEmitter : public QObject {
+    Q_OBJECT
+signals:
+    void sendRequested(uint8_t channelId, uint16_t messageId, const QByteArray& payload);
+};
+
+class TestProtocolThread : public QObject {
+    Q_OBJECT
+
+private:
+    QByteArray buildFrame(uint8_t channelId, uint16_t messageId, const QByteArray& body)
+    {
+        QByteArray payload;
+        const uint16_t idBE = qToBigEndian(messageId);
+        payload.append(reinterpret_cast<const char*>(&idBE), 2);
+        payload.append(body);
+
+        oaa::FrameHeader hdr{channelId, oaa::FrameType::Bulk,
+                             oaa::EncryptionType::Plain, oaa::MessageType::Specific};
+        QByteArray frame = hdr.serialize();
+        const uint16_t sizeBE = qToBigEndian(static_cast<uint16_t>(payload.size()));
+        frame.append(reinterpret_cast<const char*>(&sizeBE), 2);
+        frame.append(payload);
+        return frame;
+    }
+
+    static uint16_t sentMessageId(const QByteArray& frame)
+    {
+        // Bulk frame: 2-byte header, 2-byte size, then the BE message id.
+        return qFromBigEndian<uint16_t>(
+            reinterpret_cast<const uchar*>(frame.constData() + 4));
+    }
+
+    QList<QByteArray> written(oaa::ProtocolThread& thread, oaa::ReplayTransport& transport)
+    {
+        QList<QByteArray> out;
+        thread.invokeBlocking([&]() { out = transport.writtenData(); });
+        return out;
+    }
+
+private slots:
+    void testAttachRejectsParentedObject() {
+        oaa::ProtocolThread thread;
+        thread.start();
+
+        QObject parent;
+        auto* child = new QObject(&parent);
+        QVERIFY(!thread.attach(child));
+        QCOMPARE(child->thread(), QThread::currentThread());
+
+        QObject loose;
+        QVERIFY(thread.attach(&loose));
+        QCOMPARE(loose.thread(), thread.eventThread());
+        thread.detach(&loose, QThread::currentThread());
+        QCOMPARE(loose.thread(), QThread::currentThread());
+    }
+
+    void testNotRunningRunsInline() {
+        oaa::ProtocolThread thread;
+        int calls = 0;
+        thread.post([&]() { ++calls; });
+        thread.invokeBlocking([&]() { ++calls; });
+        QCOMPARE(calls, 2);
+    }
+
+    void testReceiveOrderPreservedAcrossHandOff() {
+        oaa::ProtocolThread thread;
+        thread.start();
+
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        QVERIFY(thread.attach(&transport));
+        QVERIFY(thread.attach(&messenger));
+
+        QObject receiver;
+        QList<uint16_t> ids;
+        bool allOnOwnerThread = true;
+        connect(&messenger, &oaa::Messenger::messageReceived, &receiver,
+                [&](uint8_t, uint16_t messageId, const QByteArray& payload,
+                    int dataOffset, oaa::MessageType) {
+                    allOnOwnerThread = allOnOwnerThread
+                        && QThread::currentThread() == receiver.thread();
+                    QCOMPARE(payload.mid(dataOffset), QByteArray::number(messageId));
+                    ids.append(messageId);
+                });
+
+        constexpr int kMessages = 300;
+        QByteArray burst;
+        for (int i = 0; i < kMessages / 2; ++i)
+            burst.append(buildFrame(3, uint16_t(i), QByteArray::number(i)));
+
+        thread.post([&]() { messenger.start(); });
+        // One coalesced chunk followed by single-frame chunks: both paths must
+        // surface in wire order on the owner thread.
+        thread.post([&, burst]() { transport.feedData(burst); });
+        for (int i = kMessages / 2; i < kMessages; ++i) {
+            const QByteArray frame = buildFrame(3, uint16_t(i), QByteArray::number(i));
+            thread.post([&, frame]() { transport.feedData(frame); });
+        }
+
+        QTRY_COMPARE(ids.size(), kMessages);
+        QVERIFY(allOnOwnerThread);
+        for (int i = 0; i < kMessages; ++i)
+            QCOMPARE(ids[i], uint16_t(i));
+
+        thread.invokeBlocking([&]() { messenger.stop(); });
+        thread.detach(&messenger, QThread::currentThread());
+        thread.detach(&transport, QThread::currentThread());
+    }
+
+    void testQueuedSendsRespectLifecycleGeneration() {
+        oaa::ProtocolThread thread;
+        thread.start();
+
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        SendEmitter emitter;
+        connect(&emitter, &SendEmitter::sendRequested,
+                &messenger, &oaa::Messenger::sendMessage);
+        QVERIFY(thread.attach(&transport));
+        QVERIFY(thread.attach(&messenger));
+
+        thread.invokeBlocking([&]() { messenger.start(); });
+        emit emitter.sendRequested(3, 0x0101, QByteArray("a"));
+        emit emitter.sendRequested(3, 0x0102, QByteArray("b"));
+        emit emitter.sendRequested(3, 0x0103, QByteArray("c"));
+        // Queued behind the three sends: they reach the wire, later ones do not.
+        thread.post([&]() { messenger.stop(); });
+        emit emitter.sendRequested(3, 0x0201, QByteArray("stale"));
+        emit emitter.sendRequested(3, 0x0202, QByteArray("stale"));
+        thread.post([&]() { messenger.start(); });
+        emit emitter.sendRequested(3, 0x0301, QByteArray("fresh"));
+        thread.invokeBlocking([]() {});
+
+        const auto frames = written(thread, transport);
+        QCOMPARE(frames.size(), 4);
+        QCOMPARE(sentMessageId(frames[0]), uint16_t(0x0101));
+        QCOMPARE(sentMessageId(frames[1]), uint16_t(0x0102));
+        QCOMPARE(sentMessageId(frames[2]), uint16_t(0x0103));
+        QCOMPARE(sentMessageId(frames[3]), uint16_t(0x0301));
+
+        thread.invokeBlocking([&]() { messenger.stop(); });
+        thread.detach(&messenger, QThread::currentThread());
+        thread.detach(&transport, QThread::currentThread());
+    }
+
+    void testStopFromMessageSentCancelsPendingWriteOnThread() {
+        oaa::ProtocolThread thread;
+        thread.start();
+
+        oaa::ReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        QVERIFY(thread.attach(&transport));
+        QVERIFY(thread.attach(&messenger));
+
+        thread.invokeBlocking([&]() {
+            messenger.start();
+            connect(&messenger, &oaa::Messenger::messageSent,
+                    &messenger, &oaa::Messenger::stop, Qt::DirectConnection);
+            messenger.sendMessage(3, 0x1234, QByteArray("cancel"));
+        });
+
+        QCOMPARE(written(thread, transport).size(), 0);
+
+        thread.detach(&messenger, QThread::currentThread());
+        thread.detach(&transport, QThread::currentThread());
+    }
+
+    void testStopDuringFirstWriteCancelsRemainingFramesOnThread() {
+        oaa::ProtocolThread thread;
+        thread.start();
+
+        ReentrantReplayTransport transport;
+        oaa::Messenger messenger(&transport);
+        QVERIFY(thread.attach(&transport));
+        QVERIFY(thread.attach(&messenger));
+
+        thread.invokeBlocking([&]() {
+            messenger.start();
+            transport.onWrite = [&messenger](int writeCount) {
+                if (writeCount == 1)
+                    messenger.stop();
+            };
+            messenger.sendMessage(3, 0x1234, QByteArray(20000, 'X'));
+        });
+
+        QCOMPARE(written(thread, transport).size(), 1);
+
+        thread.detach(&messenger, QThread::currentThread());
+        thread.detach(&transport, QThread::currentThread());
+    }
+};
+
+QTEST_MAIN(TestProtocolThread)
+#include "test_protocol_thread.moc"
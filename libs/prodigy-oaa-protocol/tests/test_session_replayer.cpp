@@ -0,0 +1,234 @@
+#include <QtTest/QtTest>
+#include <QSignalSpy>
+#include <oaa/Session/SessionReplayer.hpp>
+#include <oaa/Channel/IAVChannelHandler.hpp>
+#include <oaa/Channel/ChannelId.hpp>
+#include <oaa/Channel/MessageIds.hpp>
+#include <oaa/Messenger/CaptureFile.hpp>
+#include <oaa/Messenger/ProtocolLogger.hpp>
+#include <QElapsedTimer>
+#include <QtEndian>
+#include <fstream>
+
+namespace {
+
+class RecordingAVHandler : public oaa::IAVChannelHandler {
+    Q_OBJECT
+public:
+    explicit RecordingAVHandler(uint8_t channelId) : channelId_(channelId) {}
+
+    uint8_t channelId() const override { return channelId_; }
+    void onChannelOpened() override {
+        ++opened;
+        emit sendRequested(channelId_, oaa::AVMessageId::ACK_INDICATION, QByteArray());
+    }
+    void onChannelClosed() override { ++closed; }
+    void onMessage(uint16_t messageId, const QByteArray& payload, int dataOffset) override {
+        messages.append({messageId, payload.mid(dataOffset)});
+    }
+    void onMediaData(const QByteArray& data, uint64_t timestamp) override {
+        media.append({timestamp, data});
+    }
+    bool canAcceptMedia() const override { return true; }
+
+    int opened = 0;
+    int closed = 0;
+    QList<QPair<uint16_t, QByteArray>> messages;
+    QList<QPair<uint64_t, QByteArray>> media;
+
+private:
+    uint8_t channelId_;
+};
+
+QByteArray timestamped(uint64_t timestamp, const QByteArray& data)
+{
+    QByteArray body(8, Qt::Uninitialized);
+    qToBigEndian(timestamp, body.data());
+    return body + data;
+}
+
+void writeCapture(const std::string& path, bool withOpenRequest)
+{
+    oaa::ProtocolLogger logger;
+    logger.setFormat(oaa::ProtocolLogger::OutputFormat::Binary);
+    logger.open(path);
+
+    auto in = [&logger](uint8_t ch, uint16_t id, oaa::MessageType type, const QByteArray& body) {
+        logger.record(false, ch, id, type,
+                      reinterpret_cast<const uint8_t*>(body.constData()), body.size());
+    };
+
+    in(oaa::ChannelId::Control, 0x000b, oaa::MessageType::Specific, QByteArray("ping"));
+    if (withOpenRequest) {
+        in(oaa::ChannelId::Video, oaa::SessionMessageId::CHANNEL_OPEN_REQUEST,
+           oaa::MessageType::Control, QByteArray("\x08\x03", 2));
+    }
+    in(oaa::ChannelId::Video, oaa::AVMessageId::SETUP_REQUEST,
+       oaa::MessageType::Specific, QByteArray("setup"));
+    in(oaa::ChannelId::Video, oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP,
+       oaa::MessageType::Specific, timestamped(0x0102030405060708ull, "idr"));
+    logger.log("HU->Phone", oaa::ChannelId::Video, oaa::AVMessageId::ACK_INDICATION,
+               nullptr, 0);
+    in(oaa::ChannelId::Video, oaa::AVMessageId::AV_MEDIA_INDICATION,
+       oaa::MessageType::Specific, QByteArray("p-frame"));
+    in(oaa::ChannelId::Navigation, 0x8006, oaa::MessageType::Specific, QByteArray("nav"));
+    logger.close();
+}
+
+} // namespace
+
+class TestSessionReplayer : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testStepRoutesLikeSession() {
+        const std::string path = "/tmp/test_session_replayer_step.oacap";
+        writeCapture(path, true);
+
+        RecordingAVHandler video(oaa::ChannelId::Video);
+        oaa::SessionReplayer replayer;
+        replayer.registerChannel(oaa::ChannelId::Video, &video);
+        QVERIFY(replayer.open(path));
+
+        QVERIFY(replayer.step());  // control ping: not replayed
+        QCOMPARE(video.opened, 0);
+        QVERIFY(replayer.step());  // channel open request
+        QCOMPARE(video.opened, 1);
+        QVERIFY(video.messages.isEmpty());
+        while (replayer.step()) {}
+
+        QCOMPARE(video.messages.size(), 1);
+        QCOMPARE(video.messages[0].first, uint16_t(oaa::AVMessageId::SETUP_REQUEST));
+        QCOMPARE(video.messages[0].second, QByteArray("setup"));
+        QCOMPARE(video.media.size(), 2);
+        QCOMPARE(video.media[0].first, 0x0102030405060708ull);
+        QCOMPARE(video.media[0].second, QByteArray("idr"));
+        QCOMPARE(video.media[1].first, 0ull);
+        QCOMPARE(video.media[1].second, QByteArray("p-frame"));
+
+        const auto& stats = replayer.stats();
+        QCOMPARE(stats.records, 7ull);
+        QCOMPARE(stats.dispatched, 3ull);
+        QCOMPARE(stats.outboundSkipped, 1ull);
+        QCOMPARE(stats.unhandled, 2ull);  // control ping + unregistered nav
+        QCOMPARE(stats.handlerSends, 1ull);
+
+        QCOMPARE(video.closed, 0);
+        replayer.stop();
+        QCOMPARE(video.closed, 1);
+
+        std::remove(path.c_str());
+    }
+
+    void testMidSessionCaptureOpensOnFirstTraffic() {
+        const std::string path = "/tmp/test_session_replayer_mid.oacap";
+        writeCapture(path, false);
+
+        RecordingAVHandler video(oaa::ChannelId::Video);
+        oaa::SessionReplayer replayer;
+        replayer.registerChannel(oaa::ChannelId::Video, &video);
+        QVERIFY(replayer.open(path));
+        while (replayer.step()) {}
+
+        QCOMPARE(video.opened, 1);
+        QCOMPARE(video.messages.size(), 1);
+        QCOMPARE(video.media.size(), 2);
+        replayer.stop();
+        QCOMPARE(video.closed, 1);
+
+        std::remove(path.c_str());
+    }
+
+    void testRunFinishesAndClosesChannels() {
+        const std::string path = "/tmp/test_session_replayer_run.oacap";
+        writeCapture(path, true);
+
+        RecordingAVHandler video(oaa::ChannelId::Video);
+        oaa::SessionReplayer replayer;
+        replayer.registerChannel(oaa::ChannelId::Video, &video);
+        replayer.setPace(oaa::SessionReplayer::Pace::MaxSpeed);
+        QVERIFY(replayer.open(path));
+
+        QSignalSpy finished(&replayer, &oaa::SessionReplayer::finished);
+        replayer.start();
+        QVERIFY(replayer.isRunning());
+        QVERIFY(finished.wait(5000));
+        QVERIFY(!replayer.isRunning());
+        QCOMPARE(replayer.stats().records, 7ull);
+        QCOMPARE(video.media.size(), 2);
+        QCOMPARE(video.closed, 1);
+
+        std::remove(path.c_str());
+    }
+
+    void testWallClockFollowsCapturedTimeline() {
+        const std::string path = "/tmp/test_session_replayer_pace.oacap";
+        {
+            // Three media frames 60 ms apart, written directly so the
+            // timeline does not depend on how fast this test runs.
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            oaa::capture::writeFileHeader(out, oaa::capture::IncludesMedia);
+            const QByteArray body = timestamped(1, "frame");
+            for (int i = 0; i < 3; ++i) {
+                oaa::capture::writeRecord(
+                    out, 5000 + uint64_t(i) * 60000, oaa::ChannelId::Video,
+                    oaa::AVMessageId::AV_MEDIA_WITH_TIMESTAMP, 0,
+                    reinterpret_cast<const uint8_t*>(body.constData()), body.size());
+            }
+        }
+
+        auto replay = [&path](oaa::SessionReplayer::Pace pace) {
+            RecordingAVHandler video(oaa::ChannelId::Video);
+            oaa::SessionReplayer replayer;
+            replayer.registerChannel(oaa::ChannelId::Video, &video);
+            replayer.setPace(pace);
+            if (!replayer.open(path))
+                return qint64(-1);
+            QSignalSpy finished(&replayer, &oaa::SessionReplayer::finished);
+            QElapsedTimer timer;
+            timer.start();
+            replayer.start();
+            if (!finished.wait(5000) || video.media.size() != 3)
+                return qint64(-1);
+            return timer.elapsed();
+        };
+
+        const qint64 wallClockMs = replay(oaa::SessionReplayer::Pace::WallClock);
+        const qint64 maxSpeedMs = replay(oaa::SessionReplayer::Pace::MaxSpeed);
+        QVERIFY2(wallClockMs >= 115, qPrintable(QString::number(wallClockMs)));
+        QVERIFY(maxSpeedMs >= 0);
+        QVERIFY2(maxSpeedMs < wallClockMs, qPrintable(QString::number(maxSpeedMs)));
+
+        std::remove(path.c_str());
+    }
+
+    void testDigestCaptureIsRejected() {
+        const std::string path = "/tmp/test_session_replayer_digest.oacap";
+        {
+            oaa::ProtocolLogger logger;
+            logger.setFormat(oaa::ProtocolLogger::OutputFormat::Binary);
+            logger.setPayloadMode(oaa::ProtocolLogger::PayloadMode::Digest);
+            logger.open(path);
+            logger.log("Phone->HU", oaa::ChannelId::Video, oaa::AVMessageId::SETUP_REQUEST,
+                       reinterpret_cast<const uint8_t*>("setup"), 5);
+            logger.close();
+        }
+
+        oaa::CaptureReader reader;
+        QVERIFY(reader.open(path));
+        QVERIFY(reader.fileFlags() & oaa::capture::PayloadDigests);
+        oaa::CaptureRecord record;
+        QVERIFY(reader.next(record));
+        QVERIFY(record.digestOnly);
+        QCOMPARE(record.payload.size(), qsizetype(oaa::capture::kDigestPayloadSize));
+
+        oaa::SessionReplayer replayer;
+        QVERIFY(!replayer.open(path));
+        QVERIFY(!replayer.error().empty());
+
+        std::remove(path.c_str());
+    }
+};
+
+QTEST_MAIN(TestSessionReplayer)
+#include "test_session_replayer.moc"
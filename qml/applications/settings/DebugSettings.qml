@@ -253,8 +253,8 @@ Flickable {
             SegmentedButton {
                 label: "Format"
                 configPath: "connection.protocol_capture.format"
-                options: ["JSONL", "TSV"]
-                values: ["jsonl", "tsv"]
+                options: ["JSONL", "TSV", "Binary"]
+                values: ["jsonl", "tsv", "binary"]
             }
         }
 
@@ -6421,6 +6421,8 @@
                      * @property {prodigy.api.v1.IWatchDataCatalogRequest|null} [watchDataCatalogRequest] ApiMessage watchDataCatalogRequest
                      * @property {prodigy.api.v1.IDataCatalogEvent|null} [dataCatalogEvent] ApiMessage dataCatalogEvent
                      * @property {prodigy.api.v1.IDataChannelAvailabilityEvent|null} [dataChannelAvailabilityEvent] ApiMessage dataChannelAvailabilityEvent
+                     * @property {prodigy.api.v1.IQueryDataHistoryRequest|null} [queryDataHistoryRequest] ApiMessage queryDataHistoryRequest
+                     * @property {prodigy.api.v1.IQueryDataHistoryResponse|null} [queryDataHistoryResponse] ApiMessage queryDataHistoryResponse
                      */
 
                     /**
@@ -6894,17 +6896,33 @@
                      */
                     ApiMessage.prototype.dataChannelAvailabilityEvent = null;
 
+                    /**
+                     * ApiMessage queryDataHistoryRequest.
+                     * @member {prodigy.api.v1.IQueryDataHistoryRequest|null|undefined} queryDataHistoryRequest
+                     * @memberof prodigy.api.v1.ApiMessage
+                     * @instance
+                     */
+                    ApiMessage.prototype.queryDataHistoryRequest = null;
+
+                    /**
+                     * ApiMessage queryDataHistoryResponse.
+                     * @member {prodigy.api.v1.IQueryDataHistoryResponse|null|undefined} queryDataHistoryResponse
+                     * @memberof prodigy.api.v1.ApiMessage
+                     * @instance
+                     */
+                    ApiMessage.prototype.queryDataHistoryResponse = null;
+
                     // OneOf field names bound to virtual getters and setters
                     var $oneOfFields;
 
                     /**
                      * ApiMessage payload.
-                     * @member {"error"|"ack"|"ping"|"pong"|"clientHello"|"serverHello"|"authRequired"|"authResponse"|"authReject"|"pairingChallenge"|"pairingResponse"|"subscribeRequest"|"subscribeResponse"|"unsubscribeRequest"|"getCapabilitiesRequest"|"capabilitiesResponse"|"mediaStatus"|"navigationStatus"|"projectionStatus"|"phoneStatus"|"systemStatus"|"listActionsRequest"|"listActionsResponse"|"dispatchActionRequest"|"dispatchActionResponse"|"registerActionsRequest"|"registerActionsResponse"|"unregisterActionsRequest"|"actionInvoked"|"postNotificationRequest"|"postNotificationResponse"|"dismissNotificationRequest"|"dialRequest"|"answerCallRequest"|"hangupRequest"|"sendDtmfRequest"|"phoneCommandResponse"|"gpsReport"|"batteryReport"|"connectivityReport"|"timeReport"|"registerDataProviderRequest"|"registerDataProviderResponse"|"declareDataChannelsRequest"|"declareDataChannelsResponse"|"removeDataChannelsRequest"|"publishDataValues"|"listDataCatalogRequest"|"listDataCatalogResponse"|"subscribeDataChannelsRequest"|"subscribeDataChannelsResponse"|"unsubscribeDataChannelsRequest"|"dataValuesEvent"|"watchDataCatalogRequest"|"dataCatalogEvent"|"dataChannelAvailabilityEvent"|undefined} payload
+                     * @member {"error"|"ack"|"ping"|"pong"|"clientHello"|"serverHello"|"authRequired"|"authResponse"|"authReject"|"pairingChallenge"|"pairingResponse"|"subscribeRequest"|"subscribeResponse"|"unsubscribeRequest"|"getCapabilitiesRequest"|"capabilitiesResponse"|"mediaStatus"|"navigationStatus"|"projectionStatus"|"phoneStatus"|"systemStatus"|"listActionsRequest"|"listActionsResponse"|"dispatchActionRequest"|"dispatchActionResponse"|"registerActionsRequest"|"registerActionsResponse"|"unregisterActionsRequest"|"actionInvoked"|"postNotificationRequest"|"postNotificationResponse"|"dismissNotificationRequest"|"dialRequest"|"answerCallRequest"|"hangupRequest"|"sendDtmfRequest"|"phoneCommandResponse"|"gpsReport"|"batteryReport"|"connectivityReport"|"timeReport"|"registerDataProviderRequest"|"registerDataProviderResponse"|"declareDataChannelsRequest"|"declareDataChannelsResponse"|"removeDataChannelsRequest"|"publishDataValues"|"listDataCatalogRequest"|"listDataCatalogResponse"|"subscribeDataChannelsRequest"|"subscribeDataChannelsResponse"|"unsubscribeDataChannelsRequest"|"dataValuesEvent"|"watchDataCatalogRequest"|"dataCatalogEvent"|"dataChannelAvailabilityEvent"|"queryDataHistoryRequest"|"queryDataHistoryResponse"|undefined} payload
                      * @memberof prodigy.api.v1.ApiMessage
                      * @instance
                      */
                     Object.defineProperty(ApiMessage.prototype, "payload", {
-                        get: $util.oneOfGetter($oneOfFields = ["error", "ack", "ping", "pong", "clientHello", "serverHello", "authRequired", "authResponse", "authReject", "pairingChallenge", "pairingResponse", "subscribeRequest", "subscribeResponse", "unsubscribeRequest", "getCapabilitiesRequest", "capabilitiesResponse", "mediaStatus", "navigationStatus", "projectionStatus", "phoneStatus", "systemStatus", "listActionsRequest", "listActionsResponse", "dispatchActionRequest", "dispatchActionResponse", "registerActionsRequest", "registerActionsResponse", "unregisterActionsRequest", "actionInvoked", "postNotificationRequest", "postNotificationResponse", "dismissNotificationRequest", "dialRequest", "answerCallRequest", "hangupRequest", "sendDtmfRequest", "phoneCommandResponse", "gpsReport", "batteryReport", "connectivityReport", "timeReport", "registerDataProviderRequest", "registerDataProviderResponse", "declareDataChannelsRequest", "declareDataChannelsResponse", "removeDataChannelsRequest", "publishDataValues", "listDataCatalogRequest", "listDataCatalogResponse", "subscribeDataChannelsRequest", "subscribeDataChannelsResponse", "unsubscribeDataChannelsRequest", "dataValuesEvent", "watchDataCatalogRequest", "dataCatalogEvent", "dataChannelAvailabilityEvent"]),
+                        get: $util.oneOfGetter($oneOfFields = ["error", "ack", "ping", "pong", "clientHello", "serverHello", "authRequired", "authResponse", "authReject", "pairingChallenge", "pairingResponse", "subscribeRequest", "subscribeResponse", "unsubscribeRequest", "getCapabilitiesRequest", "capabilitiesResponse", "mediaStatus", "navigationStatus", "projectionStatus", "phoneStatus", "systemStatus", "listActionsRequest", "listActionsResponse", "dispatchActionRequest", "dispatchActionResponse", "registerActionsRequest", "registerActionsResponse", "unregisterActionsRequest", "actionInvoked", "postNotificationRequest", "postNotificationResponse", "dismissNotificationRequest", "dialRequest", "answerCallRequest", "hangupRequest", "sendDtmfRequest", "phoneCommandResponse", "gpsReport", "batteryReport", "connectivityReport", "timeReport", "registerDataProviderRequest", "registerDataProviderResponse", "declareDataChannelsRequest", "declareDataChannelsResponse", "removeDataChannelsRequest", "publishDataValues", "listDataCatalogRequest", "listDataCatalogResponse", "subscribeDataChannelsRequest", "subscribeDataChannelsResponse", "unsubscribeDataChannelsRequest", "dataValuesEvent", "watchDataCatalogRequest", "dataCatalogEvent", "dataChannelAvailabilityEvent", "queryDataHistoryRequest", "queryDataHistoryResponse"]),
                         set: $util.oneOfSetter($oneOfFields)
                     });
 
@@ -7050,6 +7068,10 @@
                             $root.prodigy.api.v1.DataCatalogEvent.encode(message.dataCatalogEvent, writer.uint32(/* id 93, wireType 2 =*/746).fork(), q + 1).ldelim();
                         if (message.dataChannelAvailabilityEvent != null && Object.hasOwnProperty.call(message, "dataChannelAvailabilityEvent"))
                             $root.prodigy.api.v1.DataChannelAvailabilityEvent.encode(message.dataChannelAvailabilityEvent, writer.uint32(/* id 94, wireType 2 =*/754).fork(), q + 1).ldelim();
+                        if (message.queryDataHistoryRequest != null && Object.hasOwnProperty.call(message, "queryDataHistoryRequest"))
+                            $root.prodigy.api.v1.QueryDataHistoryRequest.encode(message.queryDataHistoryRequest, writer.uint32(/* id 95, wireType 2 =*/762).fork(), q + 1).ldelim();
+                        if (message.queryDataHistoryResponse != null && Object.hasOwnProperty.call(message, "queryDataHistoryResponse"))
+                            $root.prodigy.api.v1.QueryDataHistoryResponse.encode(message.queryDataHistoryResponse, writer.uint32(/* id 96, wireType 2 =*/770).fork(), q + 1).ldelim();
                         return writer;
                     };
 
@@ -7305,6 +7327,14 @@
                                     message.dataChannelAvailabilityEvent = $root.prodigy.api.v1.DataChannelAvailabilityEvent.decode(reader, reader.uint32(), undefined, long + 1);
                                     break;
                                 }
+                            case 95: {
+                                    message.queryDataHistoryRequest = $root.prodigy.api.v1.QueryDataHistoryRequest.decode(reader, reader.uint32(), undefined, long + 1);
+                                    break;
+                                }
+                            case 96: {
+                                    message.queryDataHistoryResponse = $root.prodigy.api.v1.QueryDataHistoryResponse.decode(reader, reader.uint32(), undefined, long + 1);
+                                    break;
+                                }
                             default:
                                 reader.skipType(tag & 7, long);
                                 break;
@@ -7890,6 +7920,26 @@
                                     return "dataChannelAvailabilityEvent." + error;
                             }
                         }
+                        if (message.queryDataHistoryRequest != null && Object.hasOwnProperty.call(message, "queryDataHistoryRequest")) {
+                            if (properties.payload === 1)
+                                return "payload: multiple values";
+                            properties.payload = 1;
+                            {
+                                var error = $root.prodigy.api.v1.QueryDataHistoryRequest.verify(message.queryDataHistoryRequest, long + 1);
+                                if (error)
+                                    return "queryDataHistoryRequest." + error;
+                            }
+                        }
+                        if (message.queryDataHistoryResponse != null && Object.hasOwnProperty.call(message, "queryDataHistoryResponse")) {
+                            if (properties.payload === 1)
+                                return "payload: multiple values";
+                            properties.payload = 1;
+                            {
+                                var error = $root.prodigy.api.v1.QueryDataHistoryResponse.verify(message.queryDataHistoryResponse, long + 1);
+                                if (error)
+                                    return "queryDataHistoryResponse." + error;
+                            }
+                        }
                         return null;
                     };
 
@@ -8200,6 +8250,16 @@
                                 throw TypeError(".prodigy.api.v1.ApiMessage.dataChannelAvailabilityEvent: object expected");
                             message.dataChannelAvailabilityEvent = $root.prodigy.api.v1.DataChannelAvailabilityEvent.fromObject(object.dataChannelAvailabilityEvent, long + 1);
                         }
+                        if (object.queryDataHistoryRequest != null) {
+                            if (!$util.isObject(object.queryDataHistoryRequest))
+                                throw TypeError(".prodigy.api.v1.ApiMessage.queryDataHistoryRequest: object expected");
+                            message.queryDataHistoryRequest = $root.prodigy.api.v1.QueryDataHistoryRequest.fromObject(object.queryDataHistoryRequest, long + 1);
+                        }
+                        if (object.queryDataHistoryResponse != null) {
+                            if (!$util.isObject(object.queryDataHistoryResponse))
+                                throw TypeError(".prodigy.api.v1.ApiMessage.queryDataHistoryResponse: object expected");
+                            message.queryDataHistoryResponse = $root.prodigy.api.v1.QueryDataHistoryResponse.fromObject(object.queryDataHistoryResponse, long + 1);
+                        }
                         return message;
                     };
 
@@ -8513,6 +8573,16 @@
                             if (options.oneofs)
                                 object.payload = "dataChannelAvailabilityEvent";
                         }
+                        if (message.queryDataHistoryRequest != null && Object.hasOwnProperty.call(message, "queryDataHistoryRequest")) {
+                            object.queryDataHistoryRequest = $root.prodigy.api.v1.QueryDataHistoryRequest.toObject(message.queryDataHistoryRequest, options, q + 1);
+                            if (options.oneofs)
+                                object.payload = "queryDataHistoryRequest";
+                        }
+                        if (message.queryDataHistoryResponse != null && Object.hasOwnProperty.call(message, "queryDataHistoryResponse")) {
+                            object.queryDataHistoryResponse = $root.prodigy.api.v1.QueryDataHistoryResponse.toObject(message.queryDataHistoryResponse, options, q + 1);
+                            if (options.oneofs)
+                                object.payload = "queryDataHistoryResponse";
+                        }
                         return object;
                     };
 
@@ -9643,6 +9713,7 @@
                      * @property {number|null} [suggestedMinimum] DataChannelDefinition suggestedMinimum
                      * @property {number|null} [suggestedMaximum] DataChannelDefinition suggestedMaximum
                      * @property {Array.<prodigy.api.v1.IDataEnumOption>|null} [enumOptions] DataChannelDefinition enumOptions
+                     * @property {number|null} [historyRetentionMs] DataChannelDefinition historyRetentionMs
                      */
 
                     /**
@@ -9741,6 +9812,14 @@
                      */
                     DataChannelDefinition.prototype.enumOptions = $util.emptyArray;
 
+                    /**
+                     * DataChannelDefinition historyRetentionMs.
+                     * @member {number|null|undefined} historyRetentionMs
+                     * @memberof prodigy.api.v1.DataChannelDefinition
+                     * @instance
+                     */
+                    DataChannelDefinition.prototype.historyRetentionMs = null;
+
                     // OneOf field names bound to virtual getters and setters
                     var $oneOfFields;
 
@@ -9780,6 +9859,12 @@
                         set: $util.oneOfSetter($oneOfFields)
                     });
 
+                    // Virtual OneOf for proto3 optional field
+                    Object.defineProperty(DataChannelDefinition.prototype, "_historyRetentionMs", {
+                        get: $util.oneOfGetter($oneOfFields = ["historyRetentionMs"]),
+                        set: $util.oneOfSetter($oneOfFields)
+                    });
+
                     /**
                      * Creates a new DataChannelDefinition instance using the specified properties.
                      * @function create
@@ -9829,6 +9914,8 @@
                         if (message.enumOptions != null && message.enumOptions.length)
                             for (var i = 0; i < message.enumOptions.length; ++i)
                                 $root.prodigy.api.v1.DataEnumOption.encode(message.enumOptions[i], writer.uint32(/* id 10, wireType 2 =*/82).fork(), q + 1).ldelim();
+                        if (message.historyRetentionMs != null && Object.hasOwnProperty.call(message, "historyRetentionMs"))
+                            writer.uint32(/* id 11, wireType 0 =*/88).uint32(message.historyRetentionMs);
                         return writer;
                     };
 
@@ -9898,6 +9985,10 @@
                                     message.enumOptions.push($root.prodigy.api.v1.DataEnumOption.decode(reader, reader.uint32(), undefined, long + 1));
                                     break;
                                 }
+                            case 11: {
+                                    message.historyRetentionMs = reader.uint32();
+                                    break;
+                                }
                             default:
                                 reader.skipType(tag & 7, long);
                                 break;
@@ -9980,6 +10071,11 @@
                                     return "enumOptions." + error;
                             }
                         }
+                        if (message.historyRetentionMs != null && Object.hasOwnProperty.call(message, "historyRetentionMs")) {
+                            properties._historyRetentionMs = 1;
+                            if (!$util.isInteger(message.historyRetentionMs))
+                                return "historyRetentionMs: integer expected";
+                        }
                         return null;
                     };
 
@@ -10063,6 +10159,8 @@
                                 message.enumOptions[i] = $root.prodigy.api.v1.DataEnumOption.fromObject(object.enumOptions[i], long + 1);
                             }
                         }
+                        if (object.historyRetentionMs != null)
+                            message.historyRetentionMs = object.historyRetentionMs >>> 0;
                         return message;
                     };
 
@@ -10131,6 +10229,11 @@
                             for (var j = 0; j < message.enumOptions.length; ++j)
                                 object.enumOptions[j] = $root.prodigy.api.v1.DataEnumOption.toObject(message.enumOptions[j], options, q + 1);
                         }
+                        if (message.historyRetentionMs != null && Object.hasOwnProperty.call(message, "historyRetentionMs")) {
+                            object.historyRetentionMs = message.historyRetentionMs;
+                            if (options.oneofs)
+                                object._historyRetentionMs = "historyRetentionMs";
+                        }
                         return object;
                     };
 
@@ -12924,6 +13027,251 @@
                     return DataChannelRef;
                 })();
 
+                v1.DataSubscriptionOptions = (function() {
+
+                    /**
+                     * Properties of a DataSubscriptionOptions.
+                     * @memberof prodigy.api.v1
+                     * @interface IDataSubscriptionOptions
+                     * @property {number|null} [minIntervalMs] DataSubscriptionOptions minIntervalMs
+                     * @property {number|null} [minDelta] DataSubscriptionOptions minDelta
+                     * @property {boolean|null} [latestOnly] DataSubscriptionOptions latestOnly
+                     */
+
+                    /**
+                     * Constructs a new DataSubscriptionOptions.
+                     * @memberof prodigy.api.v1
+                     * @classdesc Represents a DataSubscriptionOptions.
+                     * @implements IDataSubscriptionOptions
+                     * @constructor
+                     * @param {prodigy.api.v1.IDataSubscriptionOptions=} [properties] Properties to set
+                     */
+                    function DataSubscriptionOptions(properties) {
+                        if (properties)
+                            for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                                if (properties[keys[i]] != null && keys[i] !== "__proto__")
+                                    this[keys[i]] = properties[keys[i]];
+                    }
+
+                    /**
+                     * DataSubscriptionOptions minIntervalMs.
+                     * @member {number} minIntervalMs
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @instance
+                     */
+                    DataSubscriptionOptions.prototype.minIntervalMs = 0;
+
+                    /**
+                     * DataSubscriptionOptions minDelta.
+                     * @member {number} minDelta
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @instance
+                     */
+                    DataSubscriptionOptions.prototype.minDelta = 0;
+
+                    /**
+                     * DataSubscriptionOptions latestOnly.
+                     * @member {boolean} latestOnly
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @instance
+                     */
+                    DataSubscriptionOptions.prototype.latestOnly = false;
+
+                    /**
+                     * Creates a new DataSubscriptionOptions instance using the specified properties.
+                     * @function create
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {prodigy.api.v1.IDataSubscriptionOptions=} [properties] Properties to set
+                     * @returns {prodigy.api.v1.DataSubscriptionOptions} DataSubscriptionOptions instance
+                     */
+                    DataSubscriptionOptions.create = function create(properties) {
+                        return new DataSubscriptionOptions(properties);
+                    };
+
+                    /**
+                     * Encodes the specified DataSubscriptionOptions message. Does not implicitly {@link prodigy.api.v1.DataSubscriptionOptions.verify|verify} messages.
+                     * @function encode
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {prodigy.api.v1.IDataSubscriptionOptions} message DataSubscriptionOptions message or plain object to encode
+                     * @param {$protobuf.Writer} [writer] Writer to encode to
+                     * @returns {$protobuf.Writer} Writer
+                     */
+                    DataSubscriptionOptions.encode = function encode(message, writer, q) {
+                        if (!writer)
+                            writer = $Writer.create();
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        if (message.minIntervalMs != null && Object.hasOwnProperty.call(message, "minIntervalMs"))
+                            writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.minIntervalMs);
+                        if (message.minDelta != null && Object.hasOwnProperty.call(message, "minDelta"))
+                            writer.uint32(/* id 2, wireType 1 =*/17).double(message.minDelta);
+                        if (message.latestOnly != null && Object.hasOwnProperty.call(message, "latestOnly"))
+                            writer.uint32(/* id 3, wireType 0 =*/24).bool(message.latestOnly);
+                        return writer;
+                    };
+
+                    /**
+                     * Decodes a DataSubscriptionOptions message from the specified reader or buffer.
+                     * @function decode
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                     * @param {number} [length] Message length if known beforehand
+                     * @returns {prodigy.api.v1.DataSubscriptionOptions} DataSubscriptionOptions
+                     * @throws {Error} If the payload is not a reader or valid buffer
+                     * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                     */
+                    DataSubscriptionOptions.decode = function decode(reader, length, error, long) {
+                        if (!(reader instanceof $Reader))
+                            reader = $Reader.create(reader);
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $Reader.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var end = length === undefined ? reader.len : reader.pos + length, message = new $root.prodigy.api.v1.DataSubscriptionOptions();
+                        while (reader.pos < end) {
+                            var tag = reader.uint32();
+                            if (tag === error)
+                                break;
+                            switch (tag >>> 3) {
+                            case 1: {
+                                    message.minIntervalMs = reader.uint32();
+                                    break;
+                                }
+                            case 2: {
+                                    message.minDelta = reader.double();
+                                    break;
+                                }
+                            case 3: {
+                                    message.latestOnly = reader.bool();
+                                    break;
+                                }
+                            default:
+                                reader.skipType(tag & 7, long);
+                                break;
+                            }
+                        }
+                        return message;
+                    };
+
+                    /**
+                     * Verifies a DataSubscriptionOptions message.
+                     * @function verify
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {Object.<string,*>} message Plain object to verify
+                     * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                     */
+                    DataSubscriptionOptions.verify = function verify(message, long) {
+                        if (typeof message !== "object" || message === null)
+                            return "object expected";
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            return "maximum nesting depth exceeded";
+                        if (message.minIntervalMs != null && Object.hasOwnProperty.call(message, "minIntervalMs"))
+                            if (!$util.isInteger(message.minIntervalMs))
+                                return "minIntervalMs: integer expected";
+                        if (message.minDelta != null && Object.hasOwnProperty.call(message, "minDelta"))
+                            if (typeof message.minDelta !== "number")
+                                return "minDelta: number expected";
+                        if (message.latestOnly != null && Object.hasOwnProperty.call(message, "latestOnly"))
+                            if (typeof message.latestOnly !== "boolean")
+                                return "latestOnly: boolean expected";
+                        return null;
+                    };
+
+                    /**
+                     * Creates a DataSubscriptionOptions message from a plain object. Also converts values to their respective internal types.
+                     * @function fromObject
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {Object.<string,*>} object Plain object
+                     * @returns {prodigy.api.v1.DataSubscriptionOptions} DataSubscriptionOptions
+                     */
+                    DataSubscriptionOptions.fromObject = function fromObject(object, long) {
+                        if (object instanceof $root.prodigy.api.v1.DataSubscriptionOptions)
+                            return object;
+                        if (!$util.isObject(object))
+                            throw TypeError(".prodigy.api.v1.DataSubscriptionOptions: object expected");
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var message = new $root.prodigy.api.v1.DataSubscriptionOptions();
+                        if (object.minIntervalMs != null)
+                            message.minIntervalMs = object.minIntervalMs >>> 0;
+                        if (object.minDelta != null)
+                            message.minDelta = Number(object.minDelta);
+                        if (object.latestOnly != null)
+                            message.latestOnly = Boolean(object.latestOnly);
+                        return message;
+                    };
+
+                    /**
+                     * Creates a plain object from a DataSubscriptionOptions message. Also converts values to other types if specified.
+                     * @function toObject
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {prodigy.api.v1.DataSubscriptionOptions} message DataSubscriptionOptions
+                     * @param {$protobuf.IConversionOptions} [options] Conversion options
+                     * @returns {Object.<string,*>} Plain object
+                     */
+                    DataSubscriptionOptions.toObject = function toObject(message, options, q) {
+                        if (!options)
+                            options = {};
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        var object = {};
+                        if (options.defaults) {
+                            object.minIntervalMs = 0;
+                            object.minDelta = 0;
+                            object.latestOnly = false;
+                        }
+                        if (message.minIntervalMs != null && Object.hasOwnProperty.call(message, "minIntervalMs"))
+                            object.minIntervalMs = message.minIntervalMs;
+                        if (message.minDelta != null && Object.hasOwnProperty.call(message, "minDelta"))
+                            object.minDelta = options.json && !isFinite(message.minDelta) ? String(message.minDelta) : message.minDelta;
+                        if (message.latestOnly != null && Object.hasOwnProperty.call(message, "latestOnly"))
+                            object.latestOnly = message.latestOnly;
+                        return object;
+                    };
+
+                    /**
+                     * Converts this DataSubscriptionOptions to JSON.
+                     * @function toJSON
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @instance
+                     * @returns {Object.<string,*>} JSON object
+                     */
+                    DataSubscriptionOptions.prototype.toJSON = function toJSON() {
+                        return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                    };
+
+                    /**
+                     * Gets the default type url for DataSubscriptionOptions
+                     * @function getTypeUrl
+                     * @memberof prodigy.api.v1.DataSubscriptionOptions
+                     * @static
+                     * @param {string} [typeUrlPrefix] your custom typeUrlPrefix(default "type.googleapis.com")
+                     * @returns {string} The default type url
+                     */
+                    DataSubscriptionOptions.getTypeUrl = function getTypeUrl(typeUrlPrefix) {
+                        if (typeUrlPrefix === undefined) {
+                            typeUrlPrefix = "type.googleapis.com";
+                        }
+                        return typeUrlPrefix + "/prodigy.api.v1.DataSubscriptionOptions";
+                    };
+
+                    return DataSubscriptionOptions;
+                })();
+
                 v1.SubscribeDataChannelsRequest = (function() {
 
                     /**
@@ -12931,6 +13279,7 @@
                      * @memberof prodigy.api.v1
                      * @interface ISubscribeDataChannelsRequest
                      * @property {Array.<prodigy.api.v1.IDataChannelRef>|null} [channels] SubscribeDataChannelsRequest channels
+                     * @property {prodigy.api.v1.IDataSubscriptionOptions|null} [options] SubscribeDataChannelsRequest options
                      */
 
                     /**
@@ -12957,6 +13306,14 @@
                      */
                     SubscribeDataChannelsRequest.prototype.channels = $util.emptyArray;
 
+                    /**
+                     * SubscribeDataChannelsRequest options.
+                     * @member {prodigy.api.v1.IDataSubscriptionOptions|null|undefined} options
+                     * @memberof prodigy.api.v1.SubscribeDataChannelsRequest
+                     * @instance
+                     */
+                    SubscribeDataChannelsRequest.prototype.options = null;
+
                     /**
                      * Creates a new SubscribeDataChannelsRequest instance using the specified properties.
                      * @function create
@@ -12988,6 +13345,8 @@
                         if (message.channels != null && message.channels.length)
                             for (var i = 0; i < message.channels.length; ++i)
                                 $root.prodigy.api.v1.DataChannelRef.encode(message.channels[i], writer.uint32(/* id 1, wireType 2 =*/10).fork(), q + 1).ldelim();
+                        if (message.options != null && Object.hasOwnProperty.call(message, "options"))
+                            $root.prodigy.api.v1.DataSubscriptionOptions.encode(message.options, writer.uint32(/* id 2, wireType 2 =*/18).fork(), q + 1).ldelim();
                         return writer;
                     };
 
@@ -13021,6 +13380,10 @@
                                     message.channels.push($root.prodigy.api.v1.DataChannelRef.decode(reader, reader.uint32(), undefined, long + 1));
                                     break;
                                 }
+                            case 2: {
+                                    message.options = $root.prodigy.api.v1.DataSubscriptionOptions.decode(reader, reader.uint32(), undefined, long + 1);
+                                    break;
+                                }
                             default:
                                 reader.skipType(tag & 7, long);
                                 break;
@@ -13053,6 +13416,11 @@
                                     return "channels." + error;
                             }
                         }
+                        if (message.options != null && Object.hasOwnProperty.call(message, "options")) {
+                            var error = $root.prodigy.api.v1.DataSubscriptionOptions.verify(message.options, long + 1);
+                            if (error)
+                                return "options." + error;
+                        }
                         return null;
                     };
 
@@ -13084,6 +13452,11 @@
                                 message.channels[i] = $root.prodigy.api.v1.DataChannelRef.fromObject(object.channels[i], long + 1);
                             }
                         }
+                        if (object.options != null) {
+                            if (!$util.isObject(object.options))
+                                throw TypeError(".prodigy.api.v1.SubscribeDataChannelsRequest.options: object expected");
+                            message.options = $root.prodigy.api.v1.DataSubscriptionOptions.fromObject(object.options, long + 1);
+                        }
                         return message;
                     };
 
@@ -13106,11 +13479,15 @@
                         var object = {};
                         if (options.arrays || options.defaults)
                             object.channels = [];
+                        if (options.defaults)
+                            object.options = null;
                         if (message.channels && message.channels.length) {
                             object.channels = [];
                             for (var j = 0; j < message.channels.length; ++j)
                                 object.channels[j] = $root.prodigy.api.v1.DataChannelRef.toObject(message.channels[j], options, q + 1);
                         }
+                        if (message.options != null && Object.hasOwnProperty.call(message, "options"))
+                            object.options = $root.prodigy.api.v1.DataSubscriptionOptions.toObject(message.options, options, q + 1);
                         return object;
                     };
 
@@ -14485,6 +14862,1345 @@
                     return DataValuesEvent;
                 })();
 
+                /**
+                 * DataHistoryMode enum.
+                 * @name prodigy.api.v1.DataHistoryMode
+                 * @enum {number}
+                 * @property {number} DATA_HISTORY_MODE_RAW=0 DATA_HISTORY_MODE_RAW value
+                 * @property {number} DATA_HISTORY_MODE_DECIMATED=1 DATA_HISTORY_MODE_DECIMATED value
+                 * @property {number} DATA_HISTORY_MODE_MIN_MAX=2 DATA_HISTORY_MODE_MIN_MAX value
+                 */
+                v1.DataHistoryMode = (function() {
+                    var valuesById = {}, values = Object.create(valuesById);
+                    values[valuesById[0] = "DATA_HISTORY_MODE_RAW"] = 0;
+                    values[valuesById[1] = "DATA_HISTORY_MODE_DECIMATED"] = 1;
+                    values[valuesById[2] = "DATA_HISTORY_MODE_MIN_MAX"] = 2;
+                    return values;
+                })();
+
+                v1.QueryDataHistoryRequest = (function() {
+
+                    /**
+                     * Properties of a QueryDataHistoryRequest.
+                     * @memberof prodigy.api.v1
+                     * @interface IQueryDataHistoryRequest
+                     * @property {prodigy.api.v1.IDataChannelRef|null} [channel] QueryDataHistoryRequest channel
+                     * @property {number|Long|null} [fromUnixMs] QueryDataHistoryRequest fromUnixMs
+                     * @property {number|Long|null} [toUnixMs] QueryDataHistoryRequest toUnixMs
+                     * @property {prodigy.api.v1.DataHistoryMode|null} [mode] QueryDataHistoryRequest mode
+                     * @property {number|null} [maxPoints] QueryDataHistoryRequest maxPoints
+                     */
+
+                    /**
+                     * Constructs a new QueryDataHistoryRequest.
+                     * @memberof prodigy.api.v1
+                     * @classdesc Represents a QueryDataHistoryRequest.
+                     * @implements IQueryDataHistoryRequest
+                     * @constructor
+                     * @param {prodigy.api.v1.IQueryDataHistoryRequest=} [properties] Properties to set
+                     */
+                    function QueryDataHistoryRequest(properties) {
+                        if (properties)
+                            for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                                if (properties[keys[i]] != null && keys[i] !== "__proto__")
+                                    this[keys[i]] = properties[keys[i]];
+                    }
+
+                    /**
+                     * QueryDataHistoryRequest channel.
+                     * @member {prodigy.api.v1.IDataChannelRef|null|undefined} channel
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     */
+                    QueryDataHistoryRequest.prototype.channel = null;
+
+                    /**
+                     * QueryDataHistoryRequest fromUnixMs.
+                     * @member {number|Long|null|undefined} fromUnixMs
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     */
+                    QueryDataHistoryRequest.prototype.fromUnixMs = null;
+
+                    /**
+                     * QueryDataHistoryRequest toUnixMs.
+                     * @member {number|Long|null|undefined} toUnixMs
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     */
+                    QueryDataHistoryRequest.prototype.toUnixMs = null;
+
+                    /**
+                     * QueryDataHistoryRequest mode.
+                     * @member {prodigy.api.v1.DataHistoryMode} mode
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     */
+                    QueryDataHistoryRequest.prototype.mode = 0;
+
+                    /**
+                     * QueryDataHistoryRequest maxPoints.
+                     * @member {number} maxPoints
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     */
+                    QueryDataHistoryRequest.prototype.maxPoints = 0;
+
+                    // OneOf field names bound to virtual getters and setters
+                    var $oneOfFields;
+
+                    // Virtual OneOf for proto3 optional field
+                    Object.defineProperty(QueryDataHistoryRequest.prototype, "_fromUnixMs", {
+                        get: $util.oneOfGetter($oneOfFields = ["fromUnixMs"]),
+                        set: $util.oneOfSetter($oneOfFields)
+                    });
+
+                    // Virtual OneOf for proto3 optional field
+                    Object.defineProperty(QueryDataHistoryRequest.prototype, "_toUnixMs", {
+                        get: $util.oneOfGetter($oneOfFields = ["toUnixMs"]),
+                        set: $util.oneOfSetter($oneOfFields)
+                    });
+
+                    /**
+                     * Creates a new QueryDataHistoryRequest instance using the specified properties.
+                     * @function create
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {prodigy.api.v1.IQueryDataHistoryRequest=} [properties] Properties to set
+                     * @returns {prodigy.api.v1.QueryDataHistoryRequest} QueryDataHistoryRequest instance
+                     */
+                    QueryDataHistoryRequest.create = function create(properties) {
+                        return new QueryDataHistoryRequest(properties);
+                    };
+
+                    /**
+                     * Encodes the specified QueryDataHistoryRequest message. Does not implicitly {@link prodigy.api.v1.QueryDataHistoryRequest.verify|verify} messages.
+                     * @function encode
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {prodigy.api.v1.IQueryDataHistoryRequest} message QueryDataHistoryRequest message or plain object to encode
+                     * @param {$protobuf.Writer} [writer] Writer to encode to
+                     * @returns {$protobuf.Writer} Writer
+                     */
+                    QueryDataHistoryRequest.encode = function encode(message, writer, q) {
+                        if (!writer)
+                            writer = $Writer.create();
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        if (message.channel != null && Object.hasOwnProperty.call(message, "channel"))
+                            $root.prodigy.api.v1.DataChannelRef.encode(message.channel, writer.uint32(/* id 1, wireType 2 =*/10).fork(), q + 1).ldelim();
+                        if (message.fromUnixMs != null && Object.hasOwnProperty.call(message, "fromUnixMs"))
+                            writer.uint32(/* id 2, wireType 0 =*/16).int64(message.fromUnixMs);
+                        if (message.toUnixMs != null && Object.hasOwnProperty.call(message, "toUnixMs"))
+                            writer.uint32(/* id 3, wireType 0 =*/24).int64(message.toUnixMs);
+                        if (message.mode != null && Object.hasOwnProperty.call(message, "mode"))
+                            writer.uint32(/* id 4, wireType 0 =*/32).int32(message.mode);
+                        if (message.maxPoints != null && Object.hasOwnProperty.call(message, "maxPoints"))
+                            writer.uint32(/* id 5, wireType 0 =*/40).uint32(message.maxPoints);
+                        return writer;
+                    };
+
+                    /**
+                     * Decodes a QueryDataHistoryRequest message from the specified reader or buffer.
+                     * @function decode
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                     * @param {number} [length] Message length if known beforehand
+                     * @returns {prodigy.api.v1.QueryDataHistoryRequest} QueryDataHistoryRequest
+                     * @throws {Error} If the payload is not a reader or valid buffer
+                     * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                     */
+                    QueryDataHistoryRequest.decode = function decode(reader, length, error, long) {
+                        if (!(reader instanceof $Reader))
+                            reader = $Reader.create(reader);
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $Reader.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var end = length === undefined ? reader.len : reader.pos + length, message = new $root.prodigy.api.v1.QueryDataHistoryRequest();
+                        while (reader.pos < end) {
+                            var tag = reader.uint32();
+                            if (tag === error)
+                                break;
+                            switch (tag >>> 3) {
+                            case 1: {
+                                    message.channel = $root.prodigy.api.v1.DataChannelRef.decode(reader, reader.uint32(), undefined, long + 1);
+                                    break;
+                                }
+                            case 2: {
+                                    message.fromUnixMs = reader.int64();
+                                    break;
+                                }
+                            case 3: {
+                                    message.toUnixMs = reader.int64();
+                                    break;
+                                }
+                            case 4: {
+                                    message.mode = reader.int32();
+                                    break;
+                                }
+                            case 5: {
+                                    message.maxPoints = reader.uint32();
+                                    break;
+                                }
+                            default:
+                                reader.skipType(tag & 7, long);
+                                break;
+                            }
+                        }
+                        return message;
+                    };
+
+                    /**
+                     * Verifies a QueryDataHistoryRequest message.
+                     * @function verify
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {Object.<string,*>} message Plain object to verify
+                     * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                     */
+                    QueryDataHistoryRequest.verify = function verify(message, long) {
+                        if (typeof message !== "object" || message === null)
+                            return "object expected";
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            return "maximum nesting depth exceeded";
+                        var properties = {};
+                        if (message.channel != null && Object.hasOwnProperty.call(message, "channel")) {
+                            var error = $root.prodigy.api.v1.DataChannelRef.verify(message.channel, long + 1);
+                            if (error)
+                                return "channel." + error;
+                        }
+                        if (message.fromUnixMs != null && Object.hasOwnProperty.call(message, "fromUnixMs")) {
+                            properties._fromUnixMs = 1;
+                            if (!$util.isInteger(message.fromUnixMs) && !(message.fromUnixMs && $util.isInteger(message.fromUnixMs.low) && $util.isInteger(message.fromUnixMs.high)))
+                                return "fromUnixMs: integer|Long expected";
+                        }
+                        if (message.toUnixMs != null && Object.hasOwnProperty.call(message, "toUnixMs")) {
+                            properties._toUnixMs = 1;
+                            if (!$util.isInteger(message.toUnixMs) && !(message.toUnixMs && $util.isInteger(message.toUnixMs.low) && $util.isInteger(message.toUnixMs.high)))
+                                return "toUnixMs: integer|Long expected";
+                        }
+                        if (message.mode != null && Object.hasOwnProperty.call(message, "mode"))
+                            switch (message.mode) {
+                            default:
+                                return "mode: enum value expected";
+                            case 0:
+                            case 1:
+                            case 2:
+                                break;
+                            }
+                        if (message.maxPoints != null && Object.hasOwnProperty.call(message, "maxPoints"))
+                            if (!$util.isInteger(message.maxPoints))
+                                return "maxPoints: integer expected";
+                        return null;
+                    };
+
+                    /**
+                     * Creates a QueryDataHistoryRequest message from a plain object. Also converts values to their respective internal types.
+                     * @function fromObject
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {Object.<string,*>} object Plain object
+                     * @returns {prodigy.api.v1.QueryDataHistoryRequest} QueryDataHistoryRequest
+                     */
+                    QueryDataHistoryRequest.fromObject = function fromObject(object, long) {
+                        if (object instanceof $root.prodigy.api.v1.QueryDataHistoryRequest)
+                            return object;
+                        if (!$util.isObject(object))
+                            throw TypeError(".prodigy.api.v1.QueryDataHistoryRequest: object expected");
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var message = new $root.prodigy.api.v1.QueryDataHistoryRequest();
+                        if (object.channel != null) {
+                            if (!$util.isObject(object.channel))
+                                throw TypeError(".prodigy.api.v1.QueryDataHistoryRequest.channel: object expected");
+                            message.channel = $root.prodigy.api.v1.DataChannelRef.fromObject(object.channel, long + 1);
+                        }
+                        if (object.fromUnixMs != null)
+                            if ($util.Long)
+                                message.fromUnixMs = $util.Long.fromValue(object.fromUnixMs, false);
+                            else if (typeof object.fromUnixMs === "string")
+                                message.fromUnixMs = parseInt(object.fromUnixMs, 10);
+                            else if (typeof object.fromUnixMs === "number")
+                                message.fromUnixMs = object.fromUnixMs;
+                            else if (typeof object.fromUnixMs === "object")
+                                message.fromUnixMs = new $util.LongBits(object.fromUnixMs.low >>> 0, object.fromUnixMs.high >>> 0).toNumber();
+                        if (object.toUnixMs != null)
+                            if ($util.Long)
+                                message.toUnixMs = $util.Long.fromValue(object.toUnixMs, false);
+                            else if (typeof object.toUnixMs === "string")
+                                message.toUnixMs = parseInt(object.toUnixMs, 10);
+                            else if (typeof object.toUnixMs === "number")
+                                message.toUnixMs = object.toUnixMs;
+                            else if (typeof object.toUnixMs === "object")
+                                message.toUnixMs = new $util.LongBits(object.toUnixMs.low >>> 0, object.toUnixMs.high >>> 0).toNumber();
+                        switch (object.mode) {
+                        default:
+                            if (typeof object.mode === "number") {
+                                message.mode = object.mode;
+                                break;
+                            }
+                            break;
+                        case "DATA_HISTORY_MODE_RAW":
+                        case 0:
+                            message.mode = 0;
+                            break;
+                        case "DATA_HISTORY_MODE_DECIMATED":
+                        case 1:
+                            message.mode = 1;
+                            break;
+                        case "DATA_HISTORY_MODE_MIN_MAX":
+                        case 2:
+                            message.mode = 2;
+                            break;
+                        }
+                        if (object.maxPoints != null)
+                            message.maxPoints = object.maxPoints >>> 0;
+                        return message;
+                    };
+
+                    /**
+                     * Creates a plain object from a QueryDataHistoryRequest message. Also converts values to other types if specified.
+                     * @function toObject
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {prodigy.api.v1.QueryDataHistoryRequest} message QueryDataHistoryRequest
+                     * @param {$protobuf.IConversionOptions} [options] Conversion options
+                     * @returns {Object.<string,*>} Plain object
+                     */
+                    QueryDataHistoryRequest.toObject = function toObject(message, options, q) {
+                        if (!options)
+                            options = {};
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        var object = {};
+                        if (options.defaults) {
+                            object.channel = null;
+                            object.mode = options.enums === String ? "DATA_HISTORY_MODE_RAW" : 0;
+                            object.maxPoints = 0;
+                        }
+                        if (message.channel != null && Object.hasOwnProperty.call(message, "channel"))
+                            object.channel = $root.prodigy.api.v1.DataChannelRef.toObject(message.channel, options, q + 1);
+                        if (message.fromUnixMs != null && Object.hasOwnProperty.call(message, "fromUnixMs")) {
+                            if (typeof BigInt !== "undefined" && options.longs === BigInt)
+                                object.fromUnixMs = typeof message.fromUnixMs === "number" ? BigInt(message.fromUnixMs) : $util.Long.fromBits(message.fromUnixMs.low >>> 0, message.fromUnixMs.high >>> 0, false).toBigInt();
+                            else if (typeof message.fromUnixMs === "number")
+                                object.fromUnixMs = options.longs === String ? String(message.fromUnixMs) : message.fromUnixMs;
+                            else
+                                object.fromUnixMs = options.longs === String ? $util.Long.prototype.toString.call(message.fromUnixMs) : options.longs === Number ? new $util.LongBits(message.fromUnixMs.low >>> 0, message.fromUnixMs.high >>> 0).toNumber() : message.fromUnixMs;
+                            if (options.oneofs)
+                                object._fromUnixMs = "fromUnixMs";
+                        }
+                        if (message.toUnixMs != null && Object.hasOwnProperty.call(message, "toUnixMs")) {
+                            if (typeof BigInt !== "undefined" && options.longs === BigInt)
+                                object.toUnixMs = typeof message.toUnixMs === "number" ? BigInt(message.toUnixMs) : $util.Long.fromBits(message.toUnixMs.low >>> 0, message.toUnixMs.high >>> 0, false).toBigInt();
+                            else if (typeof message.toUnixMs === "number")
+                                object.toUnixMs = options.longs === String ? String(message.toUnixMs) : message.toUnixMs;
+                            else
+                                object.toUnixMs = options.longs === String ? $util.Long.prototype.toString.call(message.toUnixMs) : options.longs === Number ? new $util.LongBits(message.toUnixMs.low >>> 0, message.toUnixMs.high >>> 0).toNumber() : message.toUnixMs;
+                            if (options.oneofs)
+                                object._toUnixMs = "toUnixMs";
+                        }
+                        if (message.mode != null && Object.hasOwnProperty.call(message, "mode"))
+                            object.mode = options.enums === String ? $root.prodigy.api.v1.DataHistoryMode[message.mode] === undefined ? message.mode : $root.prodigy.api.v1.DataHistoryMode[message.mode] : message.mode;
+                        if (message.maxPoints != null && Object.hasOwnProperty.call(message, "maxPoints"))
+                            object.maxPoints = message.maxPoints;
+                        return object;
+                    };
+
+                    /**
+                     * Converts this QueryDataHistoryRequest to JSON.
+                     * @function toJSON
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @instance
+                     * @returns {Object.<string,*>} JSON object
+                     */
+                    QueryDataHistoryRequest.prototype.toJSON = function toJSON() {
+                        return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                    };
+
+                    /**
+                     * Gets the default type url for QueryDataHistoryRequest
+                     * @function getTypeUrl
+                     * @memberof prodigy.api.v1.QueryDataHistoryRequest
+                     * @static
+                     * @param {string} [typeUrlPrefix] your custom typeUrlPrefix(default "type.googleapis.com")
+                     * @returns {string} The default type url
+                     */
+                    QueryDataHistoryRequest.getTypeUrl = function getTypeUrl(typeUrlPrefix) {
+                        if (typeUrlPrefix === undefined) {
+                            typeUrlPrefix = "type.googleapis.com";
+                        }
+                        return typeUrlPrefix + "/prodigy.api.v1.QueryDataHistoryRequest";
+                    };
+
+                    return QueryDataHistoryRequest;
+                })();
+
+                v1.DataHistoryPoint = (function() {
+
+                    /**
+                     * Properties of a DataHistoryPoint.
+                     * @memberof prodigy.api.v1
+                     * @interface IDataHistoryPoint
+                     * @property {number|Long|null} [observedAtUnixMs] DataHistoryPoint observedAtUnixMs
+                     * @property {number|null} [value] DataHistoryPoint value
+                     */
+
+                    /**
+                     * Constructs a new DataHistoryPoint.
+                     * @memberof prodigy.api.v1
+                     * @classdesc Represents a DataHistoryPoint.
+                     * @implements IDataHistoryPoint
+                     * @constructor
+                     * @param {prodigy.api.v1.IDataHistoryPoint=} [properties] Properties to set
+                     */
+                    function DataHistoryPoint(properties) {
+                        if (properties)
+                            for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                                if (properties[keys[i]] != null && keys[i] !== "__proto__")
+                                    this[keys[i]] = properties[keys[i]];
+                    }
+
+                    /**
+                     * DataHistoryPoint observedAtUnixMs.
+                     * @member {number|Long} observedAtUnixMs
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @instance
+                     */
+                    DataHistoryPoint.prototype.observedAtUnixMs = $util.Long ? $util.Long.fromBits(0,0,false) : 0;
+
+                    /**
+                     * DataHistoryPoint value.
+                     * @member {number|null|undefined} value
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @instance
+                     */
+                    DataHistoryPoint.prototype.value = null;
+
+                    // OneOf field names bound to virtual getters and setters
+                    var $oneOfFields;
+
+                    // Virtual OneOf for proto3 optional field
+                    Object.defineProperty(DataHistoryPoint.prototype, "_value", {
+                        get: $util.oneOfGetter($oneOfFields = ["value"]),
+                        set: $util.oneOfSetter($oneOfFields)
+                    });
+
+                    /**
+                     * Creates a new DataHistoryPoint instance using the specified properties.
+                     * @function create
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {prodigy.api.v1.IDataHistoryPoint=} [properties] Properties to set
+                     * @returns {prodigy.api.v1.DataHistoryPoint} DataHistoryPoint instance
+                     */
+                    DataHistoryPoint.create = function create(properties) {
+                        return new DataHistoryPoint(properties);
+                    };
+
+                    /**
+                     * Encodes the specified DataHistoryPoint message. Does not implicitly {@link prodigy.api.v1.DataHistoryPoint.verify|verify} messages.
+                     * @function encode
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {prodigy.api.v1.IDataHistoryPoint} message DataHistoryPoint message or plain object to encode
+                     * @param {$protobuf.Writer} [writer] Writer to encode to
+                     * @returns {$protobuf.Writer} Writer
+                     */
+                    DataHistoryPoint.encode = function encode(message, writer, q) {
+                        if (!writer)
+                            writer = $Writer.create();
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        if (message.observedAtUnixMs != null && Object.hasOwnProperty.call(message, "observedAtUnixMs"))
+                            writer.uint32(/* id 1, wireType 0 =*/8).int64(message.observedAtUnixMs);
+                        if (message.value != null && Object.hasOwnProperty.call(message, "value"))
+                            writer.uint32(/* id 2, wireType 1 =*/17).double(message.value);
+                        return writer;
+                    };
+
+                    /**
+                     * Decodes a DataHistoryPoint message from the specified reader or buffer.
+                     * @function decode
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                     * @param {number} [length] Message length if known beforehand
+                     * @returns {prodigy.api.v1.DataHistoryPoint} DataHistoryPoint
+                     * @throws {Error} If the payload is not a reader or valid buffer
+                     * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                     */
+                    DataHistoryPoint.decode = function decode(reader, length, error, long) {
+                        if (!(reader instanceof $Reader))
+                            reader = $Reader.create(reader);
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $Reader.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var end = length === undefined ? reader.len : reader.pos + length, message = new $root.prodigy.api.v1.DataHistoryPoint();
+                        while (reader.pos < end) {
+                            var tag = reader.uint32();
+                            if (tag === error)
+                                break;
+                            switch (tag >>> 3) {
+                            case 1: {
+                                    message.observedAtUnixMs = reader.int64();
+                                    break;
+                                }
+                            case 2: {
+                                    message.value = reader.double();
+                                    break;
+                                }
+                            default:
+                                reader.skipType(tag & 7, long);
+                                break;
+                            }
+                        }
+                        return message;
+                    };
+
+                    /**
+                     * Verifies a DataHistoryPoint message.
+                     * @function verify
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {Object.<string,*>} message Plain object to verify
+                     * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                     */
+                    DataHistoryPoint.verify = function verify(message, long) {
+                        if (typeof message !== "object" || message === null)
+                            return "object expected";
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            return "maximum nesting depth exceeded";
+                        var properties = {};
+                        if (message.observedAtUnixMs != null && Object.hasOwnProperty.call(message, "observedAtUnixMs"))
+                            if (!$util.isInteger(message.observedAtUnixMs) && !(message.observedAtUnixMs && $util.isInteger(message.observedAtUnixMs.low) && $util.isInteger(message.observedAtUnixMs.high)))
+                                return "observedAtUnixMs: integer|Long expected";
+                        if (message.value != null && Object.hasOwnProperty.call(message, "value")) {
+                            properties._value = 1;
+                            if (typeof message.value !== "number")
+                                return "value: number expected";
+                        }
+                        return null;
+                    };
+
+                    /**
+                     * Creates a DataHistoryPoint message from a plain object. Also converts values to their respective internal types.
+                     * @function fromObject
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {Object.<string,*>} object Plain object
+                     * @returns {prodigy.api.v1.DataHistoryPoint} DataHistoryPoint
+                     */
+                    DataHistoryPoint.fromObject = function fromObject(object, long) {
+                        if (object instanceof $root.prodigy.api.v1.DataHistoryPoint)
+                            return object;
+                        if (!$util.isObject(object))
+                            throw TypeError(".prodigy.api.v1.DataHistoryPoint: object expected");
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var message = new $root.prodigy.api.v1.DataHistoryPoint();
+                        if (object.observedAtUnixMs != null)
+                            if ($util.Long)
+                                message.observedAtUnixMs = $util.Long.fromValue(object.observedAtUnixMs, false);
+                            else if (typeof object.observedAtUnixMs === "string")
+                                message.observedAtUnixMs = parseInt(object.observedAtUnixMs, 10);
+                            else if (typeof object.observedAtUnixMs === "number")
+                                message.observedAtUnixMs = object.observedAtUnixMs;
+                            else if (typeof object.observedAtUnixMs === "object")
+                                message.observedAtUnixMs = new $util.LongBits(object.observedAtUnixMs.low >>> 0, object.observedAtUnixMs.high >>> 0).toNumber();
+                        if (object.value != null)
+                            message.value = Number(object.value);
+                        return message;
+                    };
+
+                    /**
+                     * Creates a plain object from a DataHistoryPoint message. Also converts values to other types if specified.
+                     * @function toObject
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {prodigy.api.v1.DataHistoryPoint} message DataHistoryPoint
+                     * @param {$protobuf.IConversionOptions} [options] Conversion options
+                     * @returns {Object.<string,*>} Plain object
+                     */
+                    DataHistoryPoint.toObject = function toObject(message, options, q) {
+                        if (!options)
+                            options = {};
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        var object = {};
+                        if (options.defaults)
+                            if ($util.Long) {
+                                var long = new $util.Long(0, 0, false);
+                                object.observedAtUnixMs = options.longs === String ? long.toString() : options.longs === Number ? long.toNumber() : typeof BigInt !== "undefined" && options.longs === BigInt ? long.toBigInt() : long;
+                            } else
+                                object.observedAtUnixMs = options.longs === String ? "0" : typeof BigInt !== "undefined" && options.longs === BigInt ? BigInt("0") : 0;
+                        if (message.observedAtUnixMs != null && Object.hasOwnProperty.call(message, "observedAtUnixMs"))
+                            if (typeof BigInt !== "undefined" && options.longs === BigInt)
+                                object.observedAtUnixMs = typeof message.observedAtUnixMs === "number" ? BigInt(message.observedAtUnixMs) : $util.Long.fromBits(message.observedAtUnixMs.low >>> 0, message.observedAtUnixMs.high >>> 0, false).toBigInt();
+                            else if (typeof message.observedAtUnixMs === "number")
+                                object.observedAtUnixMs = options.longs === String ? String(message.observedAtUnixMs) : message.observedAtUnixMs;
+                            else
+                                object.observedAtUnixMs = options.longs === String ? $util.Long.prototype.toString.call(message.observedAtUnixMs) : options.longs === Number ? new $util.LongBits(message.observedAtUnixMs.low >>> 0, message.observedAtUnixMs.high >>> 0).toNumber() : message.observedAtUnixMs;
+                        if (message.value != null && Object.hasOwnProperty.call(message, "value")) {
+                            object.value = options.json && !isFinite(message.value) ? String(message.value) : message.value;
+                            if (options.oneofs)
+                                object._value = "value";
+                        }
+                        return object;
+                    };
+
+                    /**
+                     * Converts this DataHistoryPoint to JSON.
+                     * @function toJSON
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @instance
+                     * @returns {Object.<string,*>} JSON object
+                     */
+                    DataHistoryPoint.prototype.toJSON = function toJSON() {
+                        return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                    };
+
+                    /**
+                     * Gets the default type url for DataHistoryPoint
+                     * @function getTypeUrl
+                     * @memberof prodigy.api.v1.DataHistoryPoint
+                     * @static
+                     * @param {string} [typeUrlPrefix] your custom typeUrlPrefix(default "type.googleapis.com")
+                     * @returns {string} The default type url
+                     */
+                    DataHistoryPoint.getTypeUrl = function getTypeUrl(typeUrlPrefix) {
+                        if (typeUrlPrefix === undefined) {
+                            typeUrlPrefix = "type.googleapis.com";
+                        }
+                        return typeUrlPrefix + "/prodigy.api.v1.DataHistoryPoint";
+                    };
+
+                    return DataHistoryPoint;
+                })();
+
+                v1.DataHistoryBucket = (function() {
+
+                    /**
+                     * Properties of a DataHistoryBucket.
+                     * @memberof prodigy.api.v1
+                     * @interface IDataHistoryBucket
+                     * @property {number|Long|null} [startUnixMs] DataHistoryBucket startUnixMs
+                     * @property {number|Long|null} [endUnixMs] DataHistoryBucket endUnixMs
+                     * @property {number|null} [minimum] DataHistoryBucket minimum
+                     * @property {number|null} [maximum] DataHistoryBucket maximum
+                     * @property {number|null} [last] DataHistoryBucket last
+                     * @property {number|null} [count] DataHistoryBucket count
+                     */
+
+                    /**
+                     * Constructs a new DataHistoryBucket.
+                     * @memberof prodigy.api.v1
+                     * @classdesc Represents a DataHistoryBucket.
+                     * @implements IDataHistoryBucket
+                     * @constructor
+                     * @param {prodigy.api.v1.IDataHistoryBucket=} [properties] Properties to set
+                     */
+                    function DataHistoryBucket(properties) {
+                        if (properties)
+                            for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                                if (properties[keys[i]] != null && keys[i] !== "__proto__")
+                                    this[keys[i]] = properties[keys[i]];
+                    }
+
+                    /**
+                     * DataHistoryBucket startUnixMs.
+                     * @member {number|Long} startUnixMs
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.startUnixMs = $util.Long ? $util.Long.fromBits(0,0,false) : 0;
+
+                    /**
+                     * DataHistoryBucket endUnixMs.
+                     * @member {number|Long} endUnixMs
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.endUnixMs = $util.Long ? $util.Long.fromBits(0,0,false) : 0;
+
+                    /**
+                     * DataHistoryBucket minimum.
+                     * @member {number} minimum
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.minimum = 0;
+
+                    /**
+                     * DataHistoryBucket maximum.
+                     * @member {number} maximum
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.maximum = 0;
+
+                    /**
+                     * DataHistoryBucket last.
+                     * @member {number} last
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.last = 0;
+
+                    /**
+                     * DataHistoryBucket count.
+                     * @member {number} count
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     */
+                    DataHistoryBucket.prototype.count = 0;
+
+                    /**
+                     * Creates a new DataHistoryBucket instance using the specified properties.
+                     * @function create
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {prodigy.api.v1.IDataHistoryBucket=} [properties] Properties to set
+                     * @returns {prodigy.api.v1.DataHistoryBucket} DataHistoryBucket instance
+                     */
+                    DataHistoryBucket.create = function create(properties) {
+                        return new DataHistoryBucket(properties);
+                    };
+
+                    /**
+                     * Encodes the specified DataHistoryBucket message. Does not implicitly {@link prodigy.api.v1.DataHistoryBucket.verify|verify} messages.
+                     * @function encode
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {prodigy.api.v1.IDataHistoryBucket} message DataHistoryBucket message or plain object to encode
+                     * @param {$protobuf.Writer} [writer] Writer to encode to
+                     * @returns {$protobuf.Writer} Writer
+                     */
+                    DataHistoryBucket.encode = function encode(message, writer, q) {
+                        if (!writer)
+                            writer = $Writer.create();
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        if (message.startUnixMs != null && Object.hasOwnProperty.call(message, "startUnixMs"))
+                            writer.uint32(/* id 1, wireType 0 =*/8).int64(message.startUnixMs);
+                        if (message.endUnixMs != null && Object.hasOwnProperty.call(message, "endUnixMs"))
+                            writer.uint32(/* id 2, wireType 0 =*/16).int64(message.endUnixMs);
+                        if (message.minimum != null && Object.hasOwnProperty.call(message, "minimum"))
+                            writer.uint32(/* id 3, wireType 1 =*/25).double(message.minimum);
+                        if (message.maximum != null && Object.hasOwnProperty.call(message, "maximum"))
+                            writer.uint32(/* id 4, wireType 1 =*/33).double(message.maximum);
+                        if (message.last != null && Object.hasOwnProperty.call(message, "last"))
+                            writer.uint32(/* id 5, wireType 1 =*/41).double(message.last);
+                        if (message.count != null && Object.hasOwnProperty.call(message, "count"))
+                            writer.uint32(/* id 6, wireType 0 =*/48).uint32(message.count);
+                        return writer;
+                    };
+
+                    /**
+                     * Decodes a DataHistoryBucket message from the specified reader or buffer.
+                     * @function decode
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                     * @param {number} [length] Message length if known beforehand
+                     * @returns {prodigy.api.v1.DataHistoryBucket} DataHistoryBucket
+                     * @throws {Error} If the payload is not a reader or valid buffer
+                     * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                     */
+                    DataHistoryBucket.decode = function decode(reader, length, error, long) {
+                        if (!(reader instanceof $Reader))
+                            reader = $Reader.create(reader);
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $Reader.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var end = length === undefined ? reader.len : reader.pos + length, message = new $root.prodigy.api.v1.DataHistoryBucket();
+                        while (reader.pos < end) {
+                            var tag = reader.uint32();
+                            if (tag === error)
+                                break;
+                            switch (tag >>> 3) {
+                            case 1: {
+                                    message.startUnixMs = reader.int64();
+                                    break;
+                                }
+                            case 2: {
+                                    message.endUnixMs = reader.int64();
+                                    break;
+                                }
+                            case 3: {
+                                    message.minimum = reader.double();
+                                    break;
+                                }
+                            case 4: {
+                                    message.maximum = reader.double();
+                                    break;
+                                }
+                            case 5: {
+                                    message.last = reader.double();
+                                    break;
+                                }
+                            case 6: {
+                                    message.count = reader.uint32();
+                                    break;
+                                }
+                            default:
+                                reader.skipType(tag & 7, long);
+                                break;
+                            }
+                        }
+                        return message;
+                    };
+
+                    /**
+                     * Verifies a DataHistoryBucket message.
+                     * @function verify
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {Object.<string,*>} message Plain object to verify
+                     * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                     */
+                    DataHistoryBucket.verify = function verify(message, long) {
+                        if (typeof message !== "object" || message === null)
+                            return "object expected";
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            return "maximum nesting depth exceeded";
+                        if (message.startUnixMs != null && Object.hasOwnProperty.call(message, "startUnixMs"))
+                            if (!$util.isInteger(message.startUnixMs) && !(message.startUnixMs && $util.isInteger(message.startUnixMs.low) && $util.isInteger(message.startUnixMs.high)))
+                                return "startUnixMs: integer|Long expected";
+                        if (message.endUnixMs != null && Object.hasOwnProperty.call(message, "endUnixMs"))
+                            if (!$util.isInteger(message.endUnixMs) && !(message.endUnixMs && $util.isInteger(message.endUnixMs.low) && $util.isInteger(message.endUnixMs.high)))
+                                return "endUnixMs: integer|Long expected";
+                        if (message.minimum != null && Object.hasOwnProperty.call(message, "minimum"))
+                            if (typeof message.minimum !== "number")
+                                return "minimum: number expected";
+                        if (message.maximum != null && Object.hasOwnProperty.call(message, "maximum"))
+                            if (typeof message.maximum !== "number")
+                                return "maximum: number expected";
+                        if (message.last != null && Object.hasOwnProperty.call(message, "last"))
+                            if (typeof message.last !== "number")
+                                return "last: number expected";
+                        if (message.count != null && Object.hasOwnProperty.call(message, "count"))
+                            if (!$util.isInteger(message.count))
+                                return "count: integer expected";
+                        return null;
+                    };
+
+                    /**
+                     * Creates a DataHistoryBucket message from a plain object. Also converts values to their respective internal types.
+                     * @function fromObject
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {Object.<string,*>} object Plain object
+                     * @returns {prodigy.api.v1.DataHistoryBucket} DataHistoryBucket
+                     */
+                    DataHistoryBucket.fromObject = function fromObject(object, long) {
+                        if (object instanceof $root.prodigy.api.v1.DataHistoryBucket)
+                            return object;
+                        if (!$util.isObject(object))
+                            throw TypeError(".prodigy.api.v1.DataHistoryBucket: object expected");
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var message = new $root.prodigy.api.v1.DataHistoryBucket();
+                        if (object.startUnixMs != null)
+                            if ($util.Long)
+                                message.startUnixMs = $util.Long.fromValue(object.startUnixMs, false);
+                            else if (typeof object.startUnixMs === "string")
+                                message.startUnixMs = parseInt(object.startUnixMs, 10);
+                            else if (typeof object.startUnixMs === "number")
+                                message.startUnixMs = object.startUnixMs;
+                            else if (typeof object.startUnixMs === "object")
+                                message.startUnixMs = new $util.LongBits(object.startUnixMs.low >>> 0, object.startUnixMs.high >>> 0).toNumber();
+                        if (object.endUnixMs != null)
+                            if ($util.Long)
+                                message.endUnixMs = $util.Long.fromValue(object.endUnixMs, false);
+                            else if (typeof object.endUnixMs === "string")
+                                message.endUnixMs = parseInt(object.endUnixMs, 10);
+                            else if (typeof object.endUnixMs === "number")
+                                message.endUnixMs = object.endUnixMs;
+                            else if (typeof object.endUnixMs === "object")
+                                message.endUnixMs = new $util.LongBits(object.endUnixMs.low >>> 0, object.endUnixMs.high >>> 0).toNumber();
+                        if (object.minimum != null)
+                            message.minimum = Number(object.minimum);
+                        if (object.maximum != null)
+                            message.maximum = Number(object.maximum);
+                        if (object.last != null)
+                            message.last = Number(object.last);
+                        if (object.count != null)
+                            message.count = object.count >>> 0;
+                        return message;
+                    };
+
+                    /**
+                     * Creates a plain object from a DataHistoryBucket message. Also converts values to other types if specified.
+                     * @function toObject
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {prodigy.api.v1.DataHistoryBucket} message DataHistoryBucket
+                     * @param {$protobuf.IConversionOptions} [options] Conversion options
+                     * @returns {Object.<string,*>} Plain object
+                     */
+                    DataHistoryBucket.toObject = function toObject(message, options, q) {
+                        if (!options)
+                            options = {};
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        var object = {};
+                        if (options.defaults) {
+                            if ($util.Long) {
+                                var long = new $util.Long(0, 0, false);
+                                object.startUnixMs = options.longs === String ? long.toString() : options.longs === Number ? long.toNumber() : typeof BigInt !== "undefined" && options.longs === BigInt ? long.toBigInt() : long;
+                            } else
+                                object.startUnixMs = options.longs === String ? "0" : typeof BigInt !== "undefined" && options.longs === BigInt ? BigInt("0") : 0;
+                            if ($util.Long) {
+                                var long = new $util.Long(0, 0, false);
+                                object.endUnixMs = options.longs === String ? long.toString() : options.longs === Number ? long.toNumber() : typeof BigInt !== "undefined" && options.longs === BigInt ? long.toBigInt() : long;
+                            } else
+                                object.endUnixMs = options.longs === String ? "0" : typeof BigInt !== "undefined" && options.longs === BigInt ? BigInt("0") : 0;
+                            object.minimum = 0;
+                            object.maximum = 0;
+                            object.last = 0;
+                            object.count = 0;
+                        }
+                        if (message.startUnixMs != null && Object.hasOwnProperty.call(message, "startUnixMs"))
+                            if (typeof BigInt !== "undefined" && options.longs === BigInt)
+                                object.startUnixMs = typeof message.startUnixMs === "number" ? BigInt(message.startUnixMs) : $util.Long.fromBits(message.startUnixMs.low >>> 0, message.startUnixMs.high >>> 0, false).toBigInt();
+                            else if (typeof message.startUnixMs === "number")
+                                object.startUnixMs = options.longs === String ? String(message.startUnixMs) : message.startUnixMs;
+                            else
+                                object.startUnixMs = options.longs === String ? $util.Long.prototype.toString.call(message.startUnixMs) : options.longs === Number ? new $util.LongBits(message.startUnixMs.low >>> 0, message.startUnixMs.high >>> 0).toNumber() : message.startUnixMs;
+                        if (message.endUnixMs != null && Object.hasOwnProperty.call(message, "endUnixMs"))
+                            if (typeof BigInt !== "undefined" && options.longs === BigInt)
+                                object.endUnixMs = typeof message.endUnixMs === "number" ? BigInt(message.endUnixMs) : $util.Long.fromBits(message.endUnixMs.low >>> 0, message.endUnixMs.high >>> 0, false).toBigInt();
+                            else if (typeof message.endUnixMs === "number")
+                                object.endUnixMs = options.longs === String ? String(message.endUnixMs) : message.endUnixMs;
+                            else
+                                object.endUnixMs = options.longs === String ? $util.Long.prototype.toString.call(message.endUnixMs) : options.longs === Number ? new $util.LongBits(message.endUnixMs.low >>> 0, message.endUnixMs.high >>> 0).toNumber() : message.endUnixMs;
+                        if (message.minimum != null && Object.hasOwnProperty.call(message, "minimum"))
+                            object.minimum = options.json && !isFinite(message.minimum) ? String(message.minimum) : message.minimum;
+                        if (message.maximum != null && Object.hasOwnProperty.call(message, "maximum"))
+                            object.maximum = options.json && !isFinite(message.maximum) ? String(message.maximum) : message.maximum;
+                        if (message.last != null && Object.hasOwnProperty.call(message, "last"))
+                            object.last = options.json && !isFinite(message.last) ? String(message.last) : message.last;
+                        if (message.count != null && Object.hasOwnProperty.call(message, "count"))
+                            object.count = message.count;
+                        return object;
+                    };
+
+                    /**
+                     * Converts this DataHistoryBucket to JSON.
+                     * @function toJSON
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @instance
+                     * @returns {Object.<string,*>} JSON object
+                     */
+                    DataHistoryBucket.prototype.toJSON = function toJSON() {
+                        return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                    };
+
+                    /**
+                     * Gets the default type url for DataHistoryBucket
+                     * @function getTypeUrl
+                     * @memberof prodigy.api.v1.DataHistoryBucket
+                     * @static
+                     * @param {string} [typeUrlPrefix] your custom typeUrlPrefix(default "type.googleapis.com")
+                     * @returns {string} The default type url
+                     */
+                    DataHistoryBucket.getTypeUrl = function getTypeUrl(typeUrlPrefix) {
+                        if (typeUrlPrefix === undefined) {
+                            typeUrlPrefix = "type.googleapis.com";
+                        }
+                        return typeUrlPrefix + "/prodigy.api.v1.DataHistoryBucket";
+                    };
+
+                    return DataHistoryBucket;
+                })();
+
+                v1.QueryDataHistoryResponse = (function() {
+
+                    /**
+                     * Properties of a QueryDataHistoryResponse.
+                     * @memberof prodigy.api.v1
+                     * @interface IQueryDataHistoryResponse
+                     * @property {boolean|null} [accepted] QueryDataHistoryResponse accepted
+                     * @property {string|null} [reason] QueryDataHistoryResponse reason
+                     * @property {Array.<prodigy.api.v1.IDataHistoryPoint>|null} [points] QueryDataHistoryResponse points
+                     * @property {Array.<prodigy.api.v1.IDataHistoryBucket>|null} [buckets] QueryDataHistoryResponse buckets
+                     * @property {number|null} [capacity] QueryDataHistoryResponse capacity
+                     * @property {boolean|null} [truncated] QueryDataHistoryResponse truncated
+                     */
+
+                    /**
+                     * Constructs a new QueryDataHistoryResponse.
+                     * @memberof prodigy.api.v1
+                     * @classdesc Represents a QueryDataHistoryResponse.
+                     * @implements IQueryDataHistoryResponse
+                     * @constructor
+                     * @param {prodigy.api.v1.IQueryDataHistoryResponse=} [properties] Properties to set
+                     */
+                    function QueryDataHistoryResponse(properties) {
+                        this.points = [];
+                        this.buckets = [];
+                        if (properties)
+                            for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                                if (properties[keys[i]] != null && keys[i] !== "__proto__")
+                                    this[keys[i]] = properties[keys[i]];
+                    }
+
+                    /**
+                     * QueryDataHistoryResponse accepted.
+                     * @member {boolean} accepted
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.accepted = false;
+
+                    /**
+                     * QueryDataHistoryResponse reason.
+                     * @member {string} reason
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.reason = "";
+
+                    /**
+                     * QueryDataHistoryResponse points.
+                     * @member {Array.<prodigy.api.v1.IDataHistoryPoint>} points
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.points = $util.emptyArray;
+
+                    /**
+                     * QueryDataHistoryResponse buckets.
+                     * @member {Array.<prodigy.api.v1.IDataHistoryBucket>} buckets
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.buckets = $util.emptyArray;
+
+                    /**
+                     * QueryDataHistoryResponse capacity.
+                     * @member {number} capacity
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.capacity = 0;
+
+                    /**
+                     * QueryDataHistoryResponse truncated.
+                     * @member {boolean} truncated
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     */
+                    QueryDataHistoryResponse.prototype.truncated = false;
+
+                    /**
+                     * Creates a new QueryDataHistoryResponse instance using the specified properties.
+                     * @function create
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {prodigy.api.v1.IQueryDataHistoryResponse=} [properties] Properties to set
+                     * @returns {prodigy.api.v1.QueryDataHistoryResponse} QueryDataHistoryResponse instance
+                     */
+                    QueryDataHistoryResponse.create = function create(properties) {
+                        return new QueryDataHistoryResponse(properties);
+                    };
+
+                    /**
+                     * Encodes the specified QueryDataHistoryResponse message. Does not implicitly {@link prodigy.api.v1.QueryDataHistoryResponse.verify|verify} messages.
+                     * @function encode
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {prodigy.api.v1.IQueryDataHistoryResponse} message QueryDataHistoryResponse message or plain object to encode
+                     * @param {$protobuf.Writer} [writer] Writer to encode to
+                     * @returns {$protobuf.Writer} Writer
+                     */
+                    QueryDataHistoryResponse.encode = function encode(message, writer, q) {
+                        if (!writer)
+                            writer = $Writer.create();
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        if (message.accepted != null && Object.hasOwnProperty.call(message, "accepted"))
+                            writer.uint32(/* id 1, wireType 0 =*/8).bool(message.accepted);
+                        if (message.reason != null && Object.hasOwnProperty.call(message, "reason"))
+                            writer.uint32(/* id 2, wireType 2 =*/18).string(message.reason);
+                        if (message.points != null && message.points.length)
+                            for (var i = 0; i < message.points.length; ++i)
+                                $root.prodigy.api.v1.DataHistoryPoint.encode(message.points[i], writer.uint32(/* id 3, wireType 2 =*/26).fork(), q + 1).ldelim();
+                        if (message.buckets != null && message.buckets.length)
+                            for (var i = 0; i < message.buckets.length; ++i)
+                                $root.prodigy.api.v1.DataHistoryBucket.encode(message.buckets[i], writer.uint32(/* id 4, wireType 2 =*/34).fork(), q + 1).ldelim();
+                        if (message.capacity != null && Object.hasOwnProperty.call(message, "capacity"))
+                            writer.uint32(/* id 5, wireType 0 =*/40).uint32(message.capacity);
+                        if (message.truncated != null && Object.hasOwnProperty.call(message, "truncated"))
+                            writer.uint32(/* id 6, wireType 0 =*/48).bool(message.truncated);
+                        return writer;
+                    };
+
+                    /**
+                     * Decodes a QueryDataHistoryResponse message from the specified reader or buffer.
+                     * @function decode
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                     * @param {number} [length] Message length if known beforehand
+                     * @returns {prodigy.api.v1.QueryDataHistoryResponse} QueryDataHistoryResponse
+                     * @throws {Error} If the payload is not a reader or valid buffer
+                     * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                     */
+                    QueryDataHistoryResponse.decode = function decode(reader, length, error, long) {
+                        if (!(reader instanceof $Reader))
+                            reader = $Reader.create(reader);
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $Reader.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var end = length === undefined ? reader.len : reader.pos + length, message = new $root.prodigy.api.v1.QueryDataHistoryResponse();
+                        while (reader.pos < end) {
+                            var tag = reader.uint32();
+                            if (tag === error)
+                                break;
+                            switch (tag >>> 3) {
+                            case 1: {
+                                    message.accepted = reader.bool();
+                                    break;
+                                }
+                            case 2: {
+                                    message.reason = reader.string();
+                                    break;
+                                }
+                            case 3: {
+                                    if (!(message.points && message.points.length))
+                                        message.points = [];
+                                    message.points.push($root.prodigy.api.v1.DataHistoryPoint.decode(reader, reader.uint32(), undefined, long + 1));
+                                    break;
+                                }
+                            case 4: {
+                                    if (!(message.buckets && message.buckets.length))
+                                        message.buckets = [];
+                                    message.buckets.push($root.prodigy.api.v1.DataHistoryBucket.decode(reader, reader.uint32(), undefined, long + 1));
+                                    break;
+                                }
+                            case 5: {
+                                    message.capacity = reader.uint32();
+                                    break;
+                                }
+                            case 6: {
+                                    message.truncated = reader.bool();
+                                    break;
+                                }
+                            default:
+                                reader.skipType(tag & 7, long);
+                                break;
+                            }
+                        }
+                        return message;
+                    };
+
+                    /**
+                     * Verifies a QueryDataHistoryResponse message.
+                     * @function verify
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {Object.<string,*>} message Plain object to verify
+                     * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                     */
+                    QueryDataHistoryResponse.verify = function verify(message, long) {
+                        if (typeof message !== "object" || message === null)
+                            return "object expected";
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            return "maximum nesting depth exceeded";
+                        if (message.accepted != null && Object.hasOwnProperty.call(message, "accepted"))
+                            if (typeof message.accepted !== "boolean")
+                                return "accepted: boolean expected";
+                        if (message.reason != null && Object.hasOwnProperty.call(message, "reason"))
+                            if (!$util.isString(message.reason))
+                                return "reason: string expected";
+                        if (message.points != null && Object.hasOwnProperty.call(message, "points")) {
+                            if (!Array.isArray(message.points))
+                                return "points: array expected";
+                            for (var i = 0; i < message.points.length; ++i) {
+                                var error = $root.prodigy.api.v1.DataHistoryPoint.verify(message.points[i], long + 1);
+                                if (error)
+                                    return "points." + error;
+                            }
+                        }
+                        if (message.buckets != null && Object.hasOwnProperty.call(message, "buckets")) {
+                            if (!Array.isArray(message.buckets))
+                                return "buckets: array expected";
+                            for (var i = 0; i < message.buckets.length; ++i) {
+                                var error = $root.prodigy.api.v1.DataHistoryBucket.verify(message.buckets[i], long + 1);
+                                if (error)
+                                    return "buckets." + error;
+                            }
+                        }
+                        if (message.capacity != null && Object.hasOwnProperty.call(message, "capacity"))
+                            if (!$util.isInteger(message.capacity))
+                                return "capacity: integer expected";
+                        if (message.truncated != null && Object.hasOwnProperty.call(message, "truncated"))
+                            if (typeof message.truncated !== "boolean")
+                                return "truncated: boolean expected";
+                        return null;
+                    };
+
+                    /**
+                     * Creates a QueryDataHistoryResponse message from a plain object. Also converts values to their respective internal types.
+                     * @function fromObject
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {Object.<string,*>} object Plain object
+                     * @returns {prodigy.api.v1.QueryDataHistoryResponse} QueryDataHistoryResponse
+                     */
+                    QueryDataHistoryResponse.fromObject = function fromObject(object, long) {
+                        if (object instanceof $root.prodigy.api.v1.QueryDataHistoryResponse)
+                            return object;
+                        if (!$util.isObject(object))
+                            throw TypeError(".prodigy.api.v1.QueryDataHistoryResponse: object expected");
+                        if (long === undefined)
+                            long = 0;
+                        if (long > $util.recursionLimit)
+                            throw Error("maximum nesting depth exceeded");
+                        var message = new $root.prodigy.api.v1.QueryDataHistoryResponse();
+                        if (object.accepted != null)
+                            message.accepted = Boolean(object.accepted);
+                        if (object.reason != null)
+                            message.reason = String(object.reason);
+                        if (object.points) {
+                            if (!Array.isArray(object.points))
+                                throw TypeError(".prodigy.api.v1.QueryDataHistoryResponse.points: array expected");
+                            message.points = [];
+                            for (var i = 0; i < object.points.length; ++i) {
+                                if (!$util.isObject(object.points[i]))
+                                    throw TypeError(".prodigy.api.v1.QueryDataHistoryResponse.points: object expected");
+                                message.points[i] = $root.prodigy.api.v1.DataHistoryPoint.fromObject(object.points[i], long + 1);
+                            }
+                        }
+                        if (object.buckets) {
+                            if (!Array.isArray(object.buckets))
+                                throw TypeError(".prodigy.api.v1.QueryDataHistoryResponse.buckets: array expected");
+                            message.buckets = [];
+                            for (var i = 0; i < object.buckets.length; ++i) {
+                                if (!$util.isObject(object.buckets[i]))
+                                    throw TypeError(".prodigy.api.v1.QueryDataHistoryResponse.buckets: object expected");
+                                message.buckets[i] = $root.prodigy.api.v1.DataHistoryBucket.fromObject(object.buckets[i], long + 1);
+                            }
+                        }
+                        if (object.capacity != null)
+                            message.capacity = object.capacity >>> 0;
+                        if (object.truncated != null)
+                            message.truncated = Boolean(object.truncated);
+                        return message;
+                    };
+
+                    /**
+                     * Creates a plain object from a QueryDataHistoryResponse message. Also converts values to other types if specified.
+                     * @function toObject
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {prodigy.api.v1.QueryDataHistoryResponse} message QueryDataHistoryResponse
+                     * @param {$protobuf.IConversionOptions} [options] Conversion options
+                     * @returns {Object.<string,*>} Plain object
+                     */
+                    QueryDataHistoryResponse.toObject = function toObject(message, options, q) {
+                        if (!options)
+                            options = {};
+                        if (q === undefined)
+                            q = 0;
+                        if (q > $util.recursionLimit)
+                            throw Error("max depth exceeded");
+                        var object = {};
+                        if (options.arrays || options.defaults) {
+                            object.points = [];
+                            object.buckets = [];
+                        }
+                        if (options.defaults) {
+                            object.accepted = false;
+                            object.reason = "";
+                            object.capacity = 0;
+                            object.truncated = false;
+                        }
+                        if (message.accepted != null && Object.hasOwnProperty.call(message, "accepted"))
+                            object.accepted = message.accepted;
+                        if (message.reason != null && Object.hasOwnProperty.call(message, "reason"))
+                            object.reason = message.reason;
+                        if (message.points && message.points.length) {
+                            object.points = [];
+                            for (var j = 0; j < message.points.length; ++j)
+                                object.points[j] = $root.prodigy.api.v1.DataHistoryPoint.toObject(message.points[j], options, q + 1);
+                        }
+                        if (message.buckets && message.buckets.length) {
+                            object.buckets = [];
+                            for (var j = 0; j < message.buckets.length; ++j)
+                                object.buckets[j] = $root.prodigy.api.v1.DataHistoryBucket.toObject(message.buckets[j], options, q + 1);
+                        }
+                        if (message.capacity != null && Object.hasOwnProperty.call(message, "capacity"))
+                            object.capacity = message.capacity;
+                        if (message.truncated != null && Object.hasOwnProperty.call(message, "truncated"))
+                            object.truncated = message.truncated;
+                        return object;
+                    };
+
+                    /**
+                     * Converts this QueryDataHistoryResponse to JSON.
+                     * @function toJSON
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @instance
+                     * @returns {Object.<string,*>} JSON object
+                     */
+                    QueryDataHistoryResponse.prototype.toJSON = function toJSON() {
+                        return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                    };
+
+                    /**
+                     * Gets the default type url for QueryDataHistoryResponse
+                     * @function getTypeUrl
+                     * @memberof prodigy.api.v1.QueryDataHistoryResponse
+                     * @static
+                     * @param {string} [typeUrlPrefix] your custom typeUrlPrefix(default "type.googleapis.com")
+                     * @returns {string} The default type url
+                     */
+                    QueryDataHistoryResponse.getTypeUrl = function getTypeUrl(typeUrlPrefix) {
+                        if (typeUrlPrefix === undefined) {
+                            typeUrlPrefix = "type.googleapis.com";
+                        }
+                        return typeUrlPrefix + "/prodigy.api.v1.QueryDataHistoryResponse";
+                    };
+
+                    return QueryDataHistoryResponse;
+                })();
+
                 v1.RegisterDataProviderRequest = (function() {
 
                     /**
@@ -174,6 +174,7 @@
     }
 
     var QUALITY = ['unknown', 'good', 'degraded', 'stale', 'invalid', 'unavailable'];
+    var HISTORY_MODE = { raw: 0, decimated: 1, minMax: 2 };
     var UNAVAILABLE_REASON = [
         'unspecified', 'provider_absent', 'channel_absent',
         'provider_disconnected', 'channel_removed'
@@ -210,13 +211,134 @@
         return result;
     }
 
+    // Delivery shaping per subscriber, as the server applies it per session
+    // (DataSubscriptionOptions in data.proto). The server shapes a shared
+    // binding to its least restrictive listener; each listener's gate then
+    // narrows that to what it asked for.
+    function deliveryOptions(options) {
+        options = options || {};
+        return {
+            minIntervalMs: Math.max(0, Math.floor(Number(options.minIntervalMs) || 0)),
+            minDelta: Math.max(0, Number(options.minDelta) || 0),
+            latestOnly: options.latestOnly === true
+        };
+    }
+
+    function shapes(options) {
+        return options.minIntervalMs > 0 || options.minDelta > 0 || options.latestOnly;
+    }
+
+    function serverOptions(binding) {
+        var merged = null;
+        for (var i = 0; i < binding.listeners.length; ++i) {
+            var options = binding.listeners[i].options;
+            if (!shapes(options)) return null;
+            if (!merged) {
+                merged = Object.assign({}, options);
+                continue;
+            }
+            merged.minIntervalMs = Math.min(merged.minIntervalMs, options.minIntervalMs);
+            merged.minDelta = Math.min(merged.minDelta, options.minDelta);
+            merged.latestOnly = merged.latestOnly || options.latestOnly;
+        }
+        return merged && shapes(merged) ? merged : null;
+    }
+
+    function makeGate(options, definition) {
+        var intervalMs = options.minIntervalMs;
+        var refreshMs = 0;
+        if (definition) {
+            var nominalMs = Number(definition.nominalIntervalMs || 0);
+            var staleMs = Number(definition.staleAfterMs || 0);
+            if (!intervalMs && options.latestOnly) intervalMs = nominalMs;
+            if (staleMs > 0) {
+                refreshMs = Math.max(1, Math.floor(staleMs / 2));
+                intervalMs = Math.min(intervalMs, refreshMs);
+            }
+        }
+        return {
+            intervalMs: intervalMs, minDelta: options.minDelta,
+            latestOnly: options.latestOnly, refreshMs: refreshMs,
+            last: null, lastMs: -1, held: null, timer: null
+        };
+    }
+
+    function dropHeld(gate) {
+        gate.held = null;
+        if (gate.timer !== null) clearTimeout(gate.timer);
+        gate.timer = null;
+    }
+
+    function markDelivered(gate, sample, now) {
+        gate.last = sample;
+        gate.lastMs = now;
+        dropHeld(gate);
+    }
+
+    function withinDelta(gate, sample, now) {
+        if (!(gate.minDelta > 0) || !gate.last) return false;
+        if (sample.quality !== gate.last.quality) return false;
+        if (gate.refreshMs > 0 && now - gate.lastMs >= gate.refreshMs) return false;
+        var numeric = { double: true, signed_integer: true, unsigned_integer: true };
+        if (!numeric[sample.scalarType] || !numeric[gate.last.scalarType]) return false;
+        return Math.abs(Number(sample.value) - Number(gate.last.value)) < gate.minDelta;
+    }
+
+    function notifyListener(listener, event) {
+        try { listener.cb(event); }
+        catch (e) { console.error('prodigy: data subscriber error', e); }
+    }
+
+    function offerToListener(listener, event) {
+        var gate = listener.gate;
+        var now = performance.now();
+        if (withinDelta(gate, event.sample, now)) {
+            dropHeld(gate);
+            return;
+        }
+        // A quality change is news the subscriber must not wait an interval for.
+        var qualityChanged = gate.last && event.sample.quality !== gate.last.quality;
+        if (!qualityChanged && gate.intervalMs > 0 && gate.lastMs >= 0
+            && now - gate.lastMs < gate.intervalMs) {
+            if (!gate.latestOnly) return;
+            gate.held = event;
+            if (gate.timer === null) {
+                gate.timer = setTimeout(function () {
+                    gate.timer = null;
+                    var held = gate.held;
+                    if (!held) return;
+                    markDelivered(gate, held.sample, performance.now());
+                    notifyListener(listener, held);
+                }, gate.lastMs + gate.intervalMs - now);
+            }
+            return;
+        }
+        markDelivered(gate, event.sample, now);
+        notifyListener(listener, event);
+    }
+
     function notifyBinding(binding, event) {
-        binding.callbacks.slice().forEach(function (cb) {
-            try { cb(event); }
-            catch (e) { console.error('prodigy: data subscriber error', e); }
+        binding.listeners.slice().forEach(function (listener) {
+            if (event.sample && listener.gate) {
+                offerToListener(listener, event);
+                return;
+            }
+            if (!event.sample && shapes(listener.options)) {
+                // An availability boundary: restart shaping on the new
+                // definition's hints.
+                if (listener.gate) dropHeld(listener.gate);
+                listener.gate = makeGate(listener.options, event.definition);
+            }
+            notifyListener(listener, event);
         });
     }
 
+    function subscribeRequest(channels, options) {
+        var request = { channels: channels };
+        if (options) request.options = options;
+        return { subscribeDataChannelsRequest: request };
+    }
+
     function availabilityEvent(binding, available, reason, definition) {
         return {
             providerNamespace: binding.ref.providerNamespace,
@@ -277,14 +399,33 @@
     }
 
     function sendDataSubscriptions() {
-        var channels = Object.keys(dataBindings).map(function (key) {
-            return dataBindings[key].ref;
-        }).filter(function (ref) {
-            return dataBindings[dataKey(ref)].callbacks.length > 0;
+        if (!dataCapable || !ws || ws.readyState !== 1) return;
+        // Options apply per request: one request per distinct shaping.
+        var groups = {};
+        var order = [];
+        Object.keys(dataBindings).forEach(function (key) {
+            var binding = dataBindings[key];
+            if (!binding.listeners.length) return;
+            var group = JSON.stringify(binding.serverOptions);
+            if (!groups[group]) {
+                groups[group] = { options: binding.serverOptions, channels: [] };
+                order.push(group);
+            }
+            groups[group].channels.push(binding.ref);
+        });
+        order.forEach(function (group) {
+            var fields = subscribeRequest(groups[group].channels, groups[group].options);
+            fields.requestId = nextRequestId++;
+            ws.send(encode(fields));
         });
-        if (!dataCapable || !channels.length || !ws || ws.readyState !== 1) return;
-        ws.send(encode({ requestId: nextRequestId++,
-                         subscribeDataChannelsRequest: { channels: channels } }));
+    }
+
+    function updateServerOptions(binding) {
+        var options = serverOptions(binding);
+        if (JSON.stringify(options) === JSON.stringify(binding.serverOptions)) return;
+        binding.serverOptions = options;
+        request(subscribeRequest([binding.ref], options))
+            .catch(function () { /* reconnect restores active bindings */ });
     }
 
     function markDataDisconnected() {
@@ -297,6 +438,29 @@
         });
     }
 
+    function historyFromProto(response) {
+        return {
+            points: (response.points || []).map(function (point) {
+                return {
+                    timestampMs: Number(point.observedAtUnixMs.toString()),
+                    value: point.value == null ? undefined : point.value
+                };
+            }),
+            buckets: (response.buckets || []).map(function (bucket) {
+                return {
+                    startMs: Number(bucket.startUnixMs.toString()),
+                    endMs: Number(bucket.endUnixMs.toString()),
+                    min: bucket.minimum,
+                    max: bucket.maximum,
+                    last: bucket.last,
+                    count: bucket.count
+                };
+            }),
+            capacity: response.capacity,
+            truncated: response.truncated
+        };
+    }
+
     var dataApi = {
         listCatalog: function () {
             return request({ listDataCatalogRequest: {} }).then(function (msg) {
@@ -305,7 +469,31 @@
                 return msg.listDataCatalogResponse.catalog;
             });
         },
-        subscribe: function (ref, cb) {
+        // options: { fromUnixMs, toUnixMs, mode, maxPoints }, all optional;
+        // mode is 'raw' (default), 'decimated' or 'minMax'.
+        queryHistory: function (ref, options) {
+            options = options || {};
+            var mode = HISTORY_MODE[options.mode || 'raw'];
+            if (mode === undefined)
+                return Promise.reject(new Error('prodigy: unknown history mode ' + options.mode));
+            var query = {
+                channel: normalizedRef(ref),
+                mode: mode,
+                maxPoints: Math.max(0, Math.floor(Number(options.maxPoints) || 0))
+            };
+            if (options.fromUnixMs != null) query.fromUnixMs = Number(options.fromUnixMs);
+            if (options.toUnixMs != null) query.toUnixMs = Number(options.toUnixMs);
+            return request({ queryDataHistoryRequest: query }).then(function (msg) {
+                var response = msg.queryDataHistoryResponse;
+                if (!response)
+                    throw new Error('prodigy: missing history response');
+                if (!response.accepted)
+                    throw new Error('prodigy: history query rejected: ' + response.reason);
+                return historyFromProto(response);
+            });
+        },
+        // options: { minIntervalMs, minDelta, latestOnly }, all optional.
+        subscribe: function (ref, cb, options) {
             if (typeof cb !== 'function')
                 throw new Error('prodigy: data subscription callback required');
             ref = normalizedRef(ref);
@@ -313,22 +501,33 @@
             var binding = dataBindings[key];
             if (!binding) {
                 binding = dataBindings[key] = {
-                    ref: ref, callbacks: [], definition: null, available: false
+                    ref: ref, listeners: [], definition: null, available: false,
+                    serverOptions: null
                 };
             }
-            var first = binding.callbacks.length === 0;
-            binding.callbacks.push(cb);
+            var listener = { cb: cb, options: deliveryOptions(options), gate: null };
+            if (shapes(listener.options))
+                listener.gate = makeGate(listener.options, binding.definition);
+            var first = binding.listeners.length === 0;
+            binding.listeners.push(listener);
             if (first) {
-                request({ subscribeDataChannelsRequest: { channels: [ref] } })
+                binding.serverOptions = serverOptions(binding);
+                request(subscribeRequest([ref], binding.serverOptions))
                     .catch(function () { /* reconnect restores active bindings */ });
+            } else {
+                updateServerOptions(binding);
             }
             var removed = false;
             return function unsubscribeData() {
                 if (removed) return;
                 removed = true;
-                var index = binding.callbacks.indexOf(cb);
-                if (index >= 0) binding.callbacks.splice(index, 1);
-                if (binding.callbacks.length) return;
+                var index = binding.listeners.indexOf(listener);
+                if (index >= 0) binding.listeners.splice(index, 1);
+                if (listener.gate) dropHeld(listener.gate);
+                if (binding.listeners.length) {
+                    updateServerOptions(binding);
+                    return;
+                }
                 delete dataBindings[key];
                 request({ unsubscribeDataChannelsRequest: { channels: [ref] } })
                     .catch(function () { /* already locally removed */ });
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace oap {
+
+/// Log-linear bucket layout shared by LatencyHistogram and its snapshots.
+/// Each power of two is split into kSubBuckets linear buckets, so a bucket's
+/// width is at most 1/kSubBuckets (~3%) of its values; values below
+/// 2 * kSubBuckets get a bucket each. Values above kMaxValue are clamped.
+struct LatencyBuckets {
+    static constexpr int kSubBucketBits = 6;
+    static constexpr uint64_t kSubBuckets = uint64_t(1) << (kSubBucketBits - 1);
+    /// ~19 hours in microseconds.
+    static constexpr uint64_t kMaxValue = (uint64_t(1) << 36) - 1;
+
+    static constexpr int index(uint64_t value)
+    {
+        if (value > kMaxValue)
+            value = kMaxValue;
+        const int msb = 63 - __builtin_clzll(value | 1);
+        const int shift = msb > kSubBucketBits - 1 ? msb - (kSubBucketBits - 1) : 0;
+        return static_cast<int>(uint64_t(shift) * kSubBuckets + (value >> shift));
+    }
+
+    static constexpr uint64_t lowerBound(int index)
+    {
+        const uint64_t i = static_cast<uint64_t>(index);
+        const uint64_t shift = i < 2 * kSubBuckets ? 0 : i / kSubBuckets - 1;
+        return (i - shift * kSubBuckets) << shift;
+    }
+
+    static constexpr uint64_t upperBound(int index)
+    {
+        const uint64_t i = static_cast<uint64_t>(index);
+        const uint64_t shift = i < 2 * kSubBuckets ? 0 : i / kSubBuckets - 1;
+        return lowerBound(index) + (uint64_t(1) << shift) - 1;
+    }
+};
+
+/// Fixed-memory log-linear histogram (HdrHistogram-style bucketing, see
+/// LatencyBuckets) for latency and other non-negative integer samples.
+///
+/// record() is RT-safe: two relaxed atomic increments, no allocation, no
+/// locks. Any thread may call snapshot() concurrently; the copy is per-bucket
+/// consistent, which is all percentile reporting needs. The histogram never
+/// resets: interval reports subtract an earlier snapshot instead, so several
+/// readers (the [Perf] log, the IPC metrics dump) can each keep their own
+/// window without disturbing the writer.
+class LatencyHistogram {
+public:
+    static constexpr int kBucketCount = LatencyBuckets::index(LatencyBuckets::kMaxValue) + 1;
+
+    struct Snapshot {
+        std::array<uint64_t, kBucketCount> counts{};
+        uint64_t count = 0;
+        uint64_t sum = 0;
+
+        double mean() const { return count > 0 ? double(sum) / double(count) : 0.0; }
+
+        /// Highest value equivalent to the sample at percentile @p p (0-100),
+        /// or 0 when empty.
+        uint64_t percentile(double p) const
+        {
+            if (count == 0)
+                return 0;
+            uint64_t target = static_cast<uint64_t>(std::ceil(p / 100.0 * double(count)));
+            if (target < 1)
+                target = 1;
+            uint64_t seen = 0;
+            for (int i = 0; i < kBucketCount; ++i) {
+                seen += counts[i];
+                if (seen >= target)
+                    return LatencyBuckets::upperBound(i);
+            }
+            return LatencyBuckets::upperBound(kBucketCount - 1);
+        }
+
+        uint64_t min() const
+        {
+            for (int i = 0; i < kBucketCount; ++i) {
+                if (counts[i])
+                    return LatencyBuckets::lowerBound(i);
+            }
+            return 0;
+        }
+
+        uint64_t max() const
+        {
+            for (int i = kBucketCount - 1; i >= 0; --i) {
+                if (counts[i])
+                    return LatencyBuckets::upperBound(i);
+            }
+            return 0;
+        }
+
+        /// Turn a cumulative snapshot into the interval since @p earlier.
+        Snapshot& operator-=(const Snapshot& earlier)
+        {
+            count = 0;
+            for (int i = 0; i < kBucketCount; ++i) {
+                counts[i] = counts[i] >= earlier.counts[i] ? counts[i] - earlier.counts[i] : 0;
+                count += counts[i];
+            }
+            sum = sum >= earlier.sum ? sum - earlier.sum : 0;
+            return *this;
+        }
+    };
+
+    LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t value) noexcept
+    {
+        counts_[LatencyBuckets::index(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value > LatencyBuckets::kMaxValue ? LatencyBuckets::kMaxValue : value, std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot() const
+    {
+        Snapshot snap;
+        snap.sum = sum_.load(std::memory_order_relaxed);
+        for (int i = 0; i < kBucketCount; ++i) {
+            snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            snap.count += snap.counts[i];
+        }
+        return snap;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+    std::atomic<uint64_t> sum_{0};
+};
+
+/// Interval view over a LatencyHistogram for periodic reports: each take()
+/// returns the samples recorded since the previous take() (or reset()).
+/// Owned and used by a single reader thread.
+class LatencyWindow {
+public:
+    explicit LatencyWindow(const LatencyHistogram& histogram)
+        : histogram_(histogram)
+        , last_(histogram.snapshot())
+    {
+    }
+
+    LatencyHistogram::Snapshot take()
+    {
+        LatencyHistogram::Snapshot now = histogram_.snapshot();
+        LatencyHistogram::Snapshot interval = now;
+        interval -= last_;
+        last_ = now;
+        return interval;
+    }
+
+    void reset() { last_ = histogram_.snapshot(); }
+
+private:
+    const LatencyHistogram& histogram_;
+    LatencyHistogram::Snapshot last_;
+};
+
+} // namespace oap
@@ -1,9 +1,21 @@
 #include "core/Logging.hpp"
 
-#include <QDateTime>
 #include <QThread>
+#include <oaa/Messenger/SpscQueue.hpp>
+
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
 #include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 // --- Category definitions (quiet by default: QtInfoMsg threshold) ---
 Q_LOGGING_CATEGORY(lcAA,     "oap.aa",     QtInfoMsg)
@@ -18,8 +30,8 @@ namespace {
 
 static std::atomic<bool> g_verbose{false};
 static std::atomic<bool> g_libraryOutputEnabled{false};
-static bool g_logToFile{false};
-static FILE* g_logFile{nullptr};
+static bool g_logToFile{false};     // guarded by LogSink::outputMutex_
+static FILE* g_logFile{nullptr};    // guarded by LogSink::outputMutex_
 
 // Known bracket tags from prodigy-oaa-protocol library (verified from source)
 static const char* const g_libraryTags[] = {
@@ -93,6 +105,440 @@ bool containsLifecycleKeyword(const QString& message)
     return false;
 }
 
+// --- Async sink ---
+//
+// Logging threads include the decode worker, the evdev reader and PipeWire
+// callbacks, so the handler must not format timestamps or touch the
+// terminal/file. Each thread pushes onto its own bounded SPSC ring; one writer
+// thread merges the rings by monotonic timestamp, formats wall-clock time and
+// writes each batch with a single write per output. A full ring drops the
+// message and counts it; the writer reports drops as a warning line.
+//
+// Before the writer starts, after it stops (atexit), and on threads that are
+// already tearing down their thread-locals, messages are written synchronously.
+
+constexpr size_t kThreadBufferEntries = 1024;
+constexpr auto kIdleWait = std::chrono::milliseconds(50);
+
+qint64 steadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct LogEntry {
+    qint64 steadyNs = 0;
+    QString message;        // implicitly shared; converted to UTF-8 by the writer
+    QByteArray thread;      // verbose mode only
+    const char* tag = "App";
+    QtMsgType type = QtDebugMsg;
+};
+
+struct ThreadBuffer {
+    ThreadBuffer() : queue(kThreadBufferEntries) {}
+
+    oaa::SpscQueue<LogEntry> queue;
+    std::atomic<bool> retired{false};
+    // Producer-only cache for the verbose thread column.
+    QString threadName;
+    QByteArray threadLabel;
+};
+
+QByteArray threadLabel(ThreadBuffer* buffer)
+{
+    QString name = QThread::currentThread()->objectName();
+    if (name.isEmpty()) {
+        name = QStringLiteral("0x%1").arg(
+            reinterpret_cast<quintptr>(QThread::currentThreadId()), 0, 16);
+    }
+    if (!buffer)
+        return name.toUtf8();
+    if (buffer->threadLabel.isEmpty() || name != buffer->threadName) {
+        buffer->threadName = name;
+        buffer->threadLabel = name.toUtf8();
+    }
+    return buffer->threadLabel;
+}
+
+void appendLine(std::string& out, const char* timestamp, const LogEntry& entry)
+{
+    const QByteArray msgUtf8 = entry.message.toUtf8();
+    out += '[';
+    out += timestamp;
+    out += "] [";
+    out += levelTag(entry.type);
+    out += "] [";
+    out += entry.tag;
+    out += "] ";
+    if (!entry.thread.isEmpty()) {
+        out += '[';
+        out.append(entry.thread.constData(), entry.thread.size());
+        out += "] ";
+    }
+    out.append(msgUtf8.constData(), msgUtf8.size());
+    out += '\n';
+}
+
+/// Formats "HH:mm:ss.zzz" local time, calling localtime_r once per second.
+class TimestampFormatter {
+public:
+    const char* format(qint64 wallMs)
+    {
+        const time_t secs = static_cast<time_t>(wallMs / 1000);
+        if (secs != cachedSecs_) {
+            struct tm local {};
+            localtime_r(&secs, &local);
+            std::snprintf(prefix_, sizeof(prefix_), "%02d:%02d:%02d",
+                          local.tm_hour, local.tm_min, local.tm_sec);
+            cachedSecs_ = secs;
+        }
+        std::snprintf(text_, sizeof(text_), "%s.%03d", prefix_, int(wallMs % 1000));
+        return text_;
+    }
+
+private:
+    time_t cachedSecs_ = -1;
+    char prefix_[16] = {};
+    char text_[20] = {};
+};
+
+class LogSink {
+public:
+    static LogSink& instance()
+    {
+        // Leaked on purpose: messages can arrive during static destruction.
+        static LogSink* sink = new LogSink;
+        return *sink;
+    }
+
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(lifecycleMutex_);
+        if (writer_.joinable())
+            return;
+        {
+            std::lock_guard<std::mutex> wakeLock(wakeMutex_);
+            stopRequested_ = false;
+            writerExited_ = false;
+        }
+        writer_ = std::thread([this]() { writerLoop(); });
+        running_.store(true, std::memory_order_release);
+    }
+
+    /// Drain everything and join the writer; later messages are synchronous.
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(lifecycleMutex_);
+        if (!writer_.joinable())
+            return;
+        running_.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> wakeLock(wakeMutex_);
+            stopRequested_ = true;
+        }
+        wake_.notify_all();
+        writer_.join();
+    }
+
+    void submit(LogEntry&& entry, bool verbose)
+    {
+        ThreadBuffer* buffer = running_.load(std::memory_order_acquire) ? threadBuffer() : nullptr;
+        if (!buffer) {
+            if (verbose)
+                entry.thread = threadLabel(nullptr);
+            writeNow(entry);
+            return;
+        }
+        if (verbose)
+            entry.thread = threadLabel(buffer);
+        if (!buffer->queue.tryPush(std::move(entry))) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (writerIdle_.exchange(false)) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wake_.notify_one();
+        }
+    }
+
+    /// Synchronous write, used when the entry cannot be queued.
+    void writeNow(const LogEntry& entry)
+    {
+        std::lock_guard<std::mutex> lock(outputMutex_);
+        const qint64 offsetNs = wallOffsetNs();
+        std::string line;
+        appendLine(line, timestamps_.format((entry.steadyNs + offsetNs) / 1000000), entry);
+        writeOut(line);
+    }
+
+    void flush()
+    {
+        if (running_.load(std::memory_order_acquire)
+            && std::this_thread::get_id() != writerId_.load(std::memory_order_relaxed)) {
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            if (!writerExited_) {
+                const uint64_t target = ++flushRequested_;
+                writerIdle_.store(false);
+                wake_.notify_one();
+                flushed_.wait(lock, [this, target]() {
+                    return flushDone_ >= target || writerExited_;
+                });
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(outputMutex_);
+        fflush(stderr);
+        if (g_logToFile && g_logFile)
+            fflush(g_logFile);
+    }
+
+    /// Best-effort drain from a fatal signal handler. Skipped if the writer
+    /// holds the output lock (or crashed while holding it).
+    void emergencyDrain()
+    {
+        std::unique_lock<std::mutex> lock(outputMutex_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return;
+        drainLocked();
+        fflush(stderr);
+        if (g_logToFile && g_logFile)
+            fflush(g_logFile);
+    }
+
+    void setLogFile(const QString& path)
+    {
+        std::lock_guard<std::mutex> lock(outputMutex_);
+        if (g_logFile) {
+            fclose(g_logFile);
+            g_logFile = nullptr;
+        }
+
+        if (path.isEmpty()) {
+            g_logToFile = false;
+            return;
+        }
+
+        g_logFile = fopen(path.toUtf8().constData(), "a");
+        g_logToFile = (g_logFile != nullptr);
+    }
+
+    quint64 droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    enum class ThreadState { Unset, Active, Exited };
+
+    // The shared_ptr holder is a non-trivial thread_local; the state flag is
+    // trivial, so it stays readable while the holder is being destroyed.
+    struct ThreadBufferHolder {
+        std::shared_ptr<ThreadBuffer> buffer;
+        ~ThreadBufferHolder();
+    };
+    static thread_local ThreadState t_state;
+    static thread_local ThreadBufferHolder t_holder;
+
+    ThreadBuffer* threadBuffer()
+    {
+        if (t_state == ThreadState::Exited)
+            return nullptr;
+        if (t_state == ThreadState::Unset) {
+            auto buffer = std::make_shared<ThreadBuffer>();
+            {
+                std::lock_guard<std::mutex> lock(registryMutex_);
+                buffers_.push_back(buffer);
+            }
+            t_holder.buffer = std::move(buffer);
+            t_state = ThreadState::Active;
+        }
+        return t_holder.buffer.get();
+    }
+
+    static qint64 wallOffsetNs()
+    {
+        const qint64 wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        return wallNs - steadyNowNs();
+    }
+
+    void writeOut(const std::string& text)
+    {
+        if (text.empty())
+            return;
+        fwrite(text.data(), 1, text.size(), stderr);
+        if (g_logToFile && g_logFile) {
+            fwrite(text.data(), 1, text.size(), g_logFile);
+            fflush(g_logFile);
+        }
+    }
+
+    /// Pop every ring, write the merged batch. Returns the entry count.
+    /// Caller holds outputMutex_, which also makes it the only consumer.
+    size_t drainLocked()
+    {
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            buffers = buffers_;
+        }
+
+        batch_.clear();
+        LogEntry entry;
+        for (const auto& buffer : buffers) {
+            // Read retired first: a retired ring gets no more pushes, so it
+            // can be removed once this pass has emptied it.
+            const bool retired = buffer->retired.load(std::memory_order_acquire);
+            while (buffer->queue.tryPop(entry))
+                batch_.push_back(std::move(entry));
+            if (retired) {
+                std::lock_guard<std::mutex> lock(registryMutex_);
+                buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), buffer),
+                               buffers_.end());
+            }
+        }
+
+        const uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+        if (batch_.empty() && dropped == reportedDropped_)
+            return 0;
+
+        std::stable_sort(batch_.begin(), batch_.end(),
+                         [](const LogEntry& a, const LogEntry& b) { return a.steadyNs < b.steadyNs; });
+
+        const qint64 offsetNs = wallOffsetNs();
+        out_.clear();
+        for (const LogEntry& e : batch_)
+            appendLine(out_, timestamps_.format((e.steadyNs + offsetNs) / 1000000), e);
+        if (dropped != reportedDropped_) {
+            LogEntry notice;
+            notice.steadyNs = steadyNowNs();
+            notice.type = QtWarningMsg;
+            notice.tag = "Core";
+            notice.message = QStringLiteral("Log sink dropped %1 messages (thread buffer full), %2 total")
+                .arg(dropped - reportedDropped_).arg(dropped);
+            appendLine(out_, timestamps_.format((notice.steadyNs + offsetNs) / 1000000), notice);
+            reportedDropped_ = dropped;
+        }
+        writeOut(out_);
+        const size_t count = batch_.size();
+        batch_.clear();
+        return count;
+    }
+
+    void writerLoop()
+    {
+        writerId_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        for (;;) {
+            uint64_t flushTarget;
+            bool stopping;
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex_);
+                flushTarget = flushRequested_;
+                stopping = stopRequested_;
+            }
+
+            size_t written;
+            {
+                std::lock_guard<std::mutex> lock(outputMutex_);
+                written = drainLocked();
+                if (flushTarget > flushDone_ || stopping) {
+                    fflush(stderr);
+                    if (g_logToFile && g_logFile)
+                        fflush(g_logFile);
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            if (flushTarget > flushDone_) {
+                flushDone_ = flushTarget;
+                flushed_.notify_all();
+            }
+            if (stopping && written == 0)
+                break;
+            if (written > 0 || flushRequested_ > flushDone_ || stopRequested_)
+                continue;
+
+            // A producer that pushes after the drain above sees writerIdle_
+            // and wakes us; the timeout covers a push racing the store.
+            writerIdle_.store(true);
+            wake_.wait_for(lock, kIdleWait, [this]() {
+                return !writerIdle_.load() || stopRequested_ || flushRequested_ > flushDone_;
+            });
+            writerIdle_.store(false);
+        }
+
+        writerId_.store(std::thread::id(), std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        writerExited_ = true;
+        flushed_.notify_all();
+    }
+
+    std::mutex lifecycleMutex_;
+    std::thread writer_;
+    std::atomic<std::thread::id> writerId_{};
+    std::atomic<bool> running_{false};
+
+    std::mutex registryMutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    std::atomic<bool> writerIdle_{false};
+    bool stopRequested_ = false;     // guarded by wakeMutex_
+    bool writerExited_ = false;      // guarded by wakeMutex_
+    uint64_t flushRequested_ = 0;    // guarded by wakeMutex_
+    uint64_t flushDone_ = 0;         // guarded by wakeMutex_
+
+    // Writer state, guarded by outputMutex_.
+    std::mutex outputMutex_;
+    std::vector<LogEntry> batch_;
+    std::string out_;
+    TimestampFormatter timestamps_;
+    uint64_t reportedDropped_ = 0;
+
+    std::atomic<uint64_t> dropped_{0};
+};
+
+thread_local LogSink::ThreadState LogSink::t_state = LogSink::ThreadState::Unset;
+thread_local LogSink::ThreadBufferHolder LogSink::t_holder;
+
+LogSink::ThreadBufferHolder::~ThreadBufferHolder()
+{
+    t_state = ThreadState::Exited;
+    if (buffer)
+        buffer->retired.store(true, std::memory_order_release);
+}
+
+void stopLogSink()
+{
+    LogSink::instance().stop();
+}
+
+const int g_crashSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+struct sigaction g_previousCrashActions[sizeof(g_crashSignals) / sizeof(g_crashSignals[0])];
+
+void crashSignalHandler(int sig)
+{
+    // Not async-signal-safe, but the process is going down anyway and the
+    // queued lines are usually the ones that explain why.
+    LogSink::instance().emergencyDrain();
+    for (size_t i = 0; i < sizeof(g_crashSignals) / sizeof(g_crashSignals[0]); ++i) {
+        if (g_crashSignals[i] == sig) {
+            sigaction(sig, &g_previousCrashActions[i], nullptr);
+            break;
+        }
+    }
+    raise(sig);
+}
+
+void installCrashFlush()
+{
+    struct sigaction action {};
+    action.sa_handler = crashSignalHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_NODEFER;
+    for (size_t i = 0; i < sizeof(g_crashSignals) / sizeof(g_crashSignals[0]); ++i)
+        sigaction(g_crashSignals[i], &action, &g_previousCrashActions[i]);
+}
+
 void logMessageHandler(QtMsgType type, const QMessageLogContext& ctx, const QString& msg)
 {
     // Null-check category (Pitfall 5 from research)
@@ -111,43 +557,23 @@ void logMessageHandler(QtMsgType type, const QMessageLogContext& ctx, const QStr
         }
     }
 
-    // Format timestamp
-    QByteArray timestamp = QDateTime::currentDateTime()
-                               .toString(QStringLiteral("HH:mm:ss.zzz"))
-                               .toUtf8();
-
-    const char* tag = shortTag(cat);
-    const char* level = levelTag(type);
-    QByteArray msgUtf8 = msg.toUtf8();
-
-    if (verbose) {
-        // Verbose: include thread name/ID
-        QString threadName = QThread::currentThread()->objectName();
-        if (threadName.isEmpty())
-            threadName = QStringLiteral("0x%1").arg(
-                reinterpret_cast<quintptr>(QThread::currentThreadId()), 0, 16);
-        QByteArray threadUtf8 = threadName.toUtf8();
-
-        fprintf(stderr, "[%s] [%s] [%s] [%s] %s\n",
-                timestamp.constData(), level, tag,
-                threadUtf8.constData(), msgUtf8.constData());
-
-        if (g_logToFile && g_logFile) {
-            fprintf(g_logFile, "[%s] [%s] [%s] [%s] %s\n",
-                    timestamp.constData(), level, tag,
-                    threadUtf8.constData(), msgUtf8.constData());
-            fflush(g_logFile);
-        }
-    } else {
-        fprintf(stderr, "[%s] [%s] [%s] %s\n",
-                timestamp.constData(), level, tag, msgUtf8.constData());
-
-        if (g_logToFile && g_logFile) {
-            fprintf(g_logFile, "[%s] [%s] [%s] %s\n",
-                    timestamp.constData(), level, tag, msgUtf8.constData());
-            fflush(g_logFile);
-        }
+    LogEntry entry;
+    entry.steadyNs = steadyNowNs();
+    entry.message = msg;
+    entry.tag = shortTag(cat);
+    entry.type = type;
+
+    LogSink& sink = LogSink::instance();
+    if (type == QtFatalMsg) {
+        // Qt aborts when the handler returns: write everything queued so far,
+        // then this message, before that happens.
+        sink.flush();
+        if (verbose)
+            entry.thread = threadLabel(nullptr);
+        sink.writeNow(entry);
+        return;
     }
+    sink.submit(std::move(entry), verbose);
 }
 
 } // anonymous namespace
@@ -156,9 +582,25 @@ namespace oap {
 
 void installLogHandler()
 {
+    static std::once_flag once;
+    std::call_once(once, []() {
+        std::atexit(stopLogSink);
+        installCrashFlush();
+    });
+    LogSink::instance().start();
     qInstallMessageHandler(logMessageHandler);
 }
 
+void flushLogs()
+{
+    LogSink::instance().flush();
+}
+
+quint64 droppedLogMessages()
+{
+    return LogSink::instance().droppedCount();
+}
+
 void setVerbose(bool verbose)
 {
     g_libraryOutputEnabled.store(verbose, std::memory_order_relaxed);
@@ -243,18 +685,7 @@ void applyLoggingPolicy(bool verbose, const QStringList& categories)
 
 void setLogFile(const QString& path)
 {
-    if (g_logFile) {
-        fclose(g_logFile);
-        g_logFile = nullptr;
-    }
-
-    if (path.isEmpty()) {
-        g_logToFile = false;
-        return;
-    }
-
-    g_logFile = fopen(path.toUtf8().constData(), "a");
-    g_logToFile = (g_logFile != nullptr);
+    LogSink::instance().setLogFile(path);
 }
 
 bool isLibraryMessage(const char* category, const char* file, const QString& message)
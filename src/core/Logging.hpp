@@ -14,9 +14,18 @@ Q_DECLARE_LOGGING_CATEGORY(lcEq)
 
 namespace oap {
 
-/// Install the custom message handler. Call early in main(), before any logging.
+/// Install the custom message handler and start the background log writer.
+/// Call early in main(), before any logging. Messages are queued per thread
+/// and written in batches off the logging thread; the writer is drained at
+/// exit, on qFatal, and (best effort) on crash signals.
 void installLogHandler();
 
+/// Block until every message logged before the call has been written.
+void flushLogs();
+
+/// Messages discarded because the logging thread's buffer was full.
+quint64 droppedLogMessages();
+
 /// Enable or disable verbose (debug-level) output for all categories.
 void setVerbose(bool verbose);
 
@@ -0,0 +1,131 @@
+#include "core/MetricsRegistry.hpp"
+
+#include <QJsonArray>
+#include <algorithm>
+#include <vector>
+
+namespace oap {
+
+MetricsRegistry::Registration::Registration(Registration&& other) noexcept
+    : registry_(other.registry_)
+    , id_(other.id_)
+{
+    other.registry_ = nullptr;
+    other.id_ = 0;
+}
+
+MetricsRegistry::Registration& MetricsRegistry::Registration::operator=(Registration&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        registry_ = other.registry_;
+        id_ = other.id_;
+        other.registry_ = nullptr;
+        other.id_ = 0;
+    }
+    return *this;
+}
+
+MetricsRegistry::Registration::~Registration()
+{
+    reset();
+}
+
+void MetricsRegistry::Registration::setLabel(const QString& label)
+{
+    if (registry_ && id_)
+        registry_->setLabel(id_, label);
+}
+
+void MetricsRegistry::Registration::reset()
+{
+    if (registry_ && id_)
+        registry_->remove(id_);
+    registry_ = nullptr;
+    id_ = 0;
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    // Leaked on purpose: registrations can outlive static destruction order.
+    static MetricsRegistry* registry = new MetricsRegistry;
+    return *registry;
+}
+
+MetricsRegistry::Registration MetricsRegistry::add(const QString& name, const QString& label,
+                                                   const QString& unit,
+                                                   const LatencyHistogram* histogram)
+{
+    if (!histogram)
+        return {};
+
+    QMutexLocker lock(&mutex_);
+    const quint64 id = nextId_++;
+    Entry& entry = entries_[id];
+    entry.name = name;
+    entry.label = label;
+    entry.unit = unit;
+    entry.histogram = histogram;
+    entry.baseline = histogram->snapshot();
+    return Registration(this, id);
+}
+
+void MetricsRegistry::remove(quint64 id)
+{
+    QMutexLocker lock(&mutex_);
+    entries_.erase(id);
+}
+
+void MetricsRegistry::setLabel(quint64 id, const QString& label)
+{
+    QMutexLocker lock(&mutex_);
+    auto it = entries_.find(id);
+    if (it != entries_.end())
+        it->second.label = label;
+}
+
+void MetricsRegistry::resetBaseline()
+{
+    QMutexLocker lock(&mutex_);
+    for (auto& [id, entry] : entries_)
+        entry.baseline = entry.histogram->snapshot();
+}
+
+QJsonObject MetricsRegistry::toJson() const
+{
+    QMutexLocker lock(&mutex_);
+
+    std::vector<const Entry*> ordered;
+    ordered.reserve(entries_.size());
+    for (const auto& [id, entry] : entries_)
+        ordered.push_back(&entry);
+    std::stable_sort(ordered.begin(), ordered.end(), [](const Entry* a, const Entry* b) {
+        return a->name != b->name ? a->name < b->name : a->label < b->label;
+    });
+
+    QJsonArray metrics;
+    for (const Entry* entry : ordered) {
+        LatencyHistogram::Snapshot snap = entry->histogram->snapshot();
+        snap -= entry->baseline;
+
+        QJsonObject metric;
+        metric["name"] = entry->name;
+        metric["label"] = entry->label;
+        metric["unit"] = entry->unit;
+        metric["count"] = static_cast<qint64>(snap.count);
+        metric["mean"] = snap.mean();
+        metric["min"] = static_cast<qint64>(snap.min());
+        metric["p50"] = static_cast<qint64>(snap.percentile(50.0));
+        metric["p90"] = static_cast<qint64>(snap.percentile(90.0));
+        metric["p99"] = static_cast<qint64>(snap.percentile(99.0));
+        metric["p999"] = static_cast<qint64>(snap.percentile(99.9));
+        metric["max"] = static_cast<qint64>(snap.max());
+        metrics.append(metric);
+    }
+
+    QJsonObject obj;
+    obj["metrics"] = metrics;
+    return obj;
+}
+
+} // namespace oap
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <QJsonObject>
+#include <QMutex>
+#include <QString>
+#include <map>
+
+#include "core/LatencyHistogram.hpp"
+
+namespace oap {
+
+/// Process-wide index of LatencyHistograms, dumped by the IPC `get_metrics`
+/// command so tail latency can be read from a running head unit.
+///
+/// Owners keep their histograms and hold a Registration for as long as the
+/// histogram lives; the registry only stores pointers. Registration and
+/// toJson() may run on any thread, the histograms keep recording meanwhile.
+class MetricsRegistry {
+public:
+    class Registration {
+    public:
+        Registration() = default;
+        Registration(const Registration&) = delete;
+        Registration& operator=(const Registration&) = delete;
+        Registration(Registration&& other) noexcept;
+        Registration& operator=(Registration&& other) noexcept;
+        ~Registration();
+
+        bool isRegistered() const { return id_ != 0; }
+        /// Rename, e.g. once a decoder learns which display it serves.
+        void setLabel(const QString& label);
+        void reset();
+
+    private:
+        friend class MetricsRegistry;
+        Registration(MetricsRegistry* registry, quint64 id) : registry_(registry), id_(id) {}
+
+        MetricsRegistry* registry_ = nullptr;
+        quint64 id_ = 0;
+    };
+
+    static MetricsRegistry& instance();
+
+    /// @p name identifies the measurement ("video.total"), @p label the
+    /// instance it belongs to (a display, an audio stream; may be empty),
+    /// @p unit the sample unit ("us", "ppm").
+    [[nodiscard]] Registration add(const QString& name, const QString& label,
+                                   const QString& unit, const LatencyHistogram* histogram);
+
+    /// {"metrics":[{name, label, unit, count, mean, min, p50, p90, p99,
+    /// p999, max}, ...]} ordered by name then label. Values cover everything
+    /// since the last resetBaseline() (or registration).
+    QJsonObject toJson() const;
+
+    /// Make later dumps start from now, e.g. before a benchmark run.
+    void resetBaseline();
+
+private:
+    struct Entry {
+        QString name;
+        QString label;
+        QString unit;
+        const LatencyHistogram* histogram = nullptr;
+        LatencyHistogram::Snapshot baseline;
+    };
+
+    void remove(quint64 id);
+    void setLabel(quint64 id, const QString& label);
+
+    mutable QMutex mutex_;
+    std::map<quint64, Entry> entries_;
+    quint64 nextId_ = 1;
+};
+
+} // namespace oap
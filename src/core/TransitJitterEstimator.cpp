@@ -0,0 +1,62 @@
+#include "TransitJitterEstimator.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace oap {
+
+TransitJitterEstimator::Observation TransitJitterEstimator::observe(int64_t ptsUs,
+                                                                    int64_t arrivalUs)
+{
+    const int64_t transitUs = arrivalUs - ptsUs;
+    if (!haveOffset_ || std::llabs(transitUs - offsetUs_) > kResyncThresholdUs) {
+        haveOffset_ = true;
+        offsetUs_ = transitUs;
+        windowStartUs_ = arrivalUs;
+        windowMinUs_ = transitUs;
+        previousWindowMinUs_ = transitUs;
+        recentCount_ = 0;
+        recentNext_ = 0;
+        sinceRetarget_ = 0;
+    } else {
+        if (arrivalUs - windowStartUs_ >= kOffsetWindowUs) {
+            previousWindowMinUs_ = windowMinUs_;
+            windowMinUs_ = transitUs;
+            windowStartUs_ = arrivalUs;
+        } else {
+            windowMinUs_ = std::min(windowMinUs_, transitUs);
+        }
+        offsetUs_ = std::min(previousWindowMinUs_, windowMinUs_);
+    }
+
+    Observation observation;
+    observation.jitterUs = transitUs - offsetUs_;
+    recentJitter_[recentNext_] = observation.jitterUs;
+    recentNext_ = (recentNext_ + 1) % kJitterSamples;
+    recentCount_ = std::min(recentCount_ + 1, kJitterSamples);
+    if (++sinceRetarget_ >= kRetargetInterval) {
+        sinceRetarget_ = 0;
+        observation.retarget = true;
+    }
+    return observation;
+}
+
+void TransitJitterEstimator::reset()
+{
+    haveOffset_ = false;
+    recentCount_ = 0;
+    recentNext_ = 0;
+    sinceRetarget_ = 0;
+}
+
+int64_t TransitJitterEstimator::recentP95Us() const
+{
+    if (recentCount_ == 0)
+        return 0;
+    std::array<int64_t, kJitterSamples> sorted = recentJitter_;
+    const size_t rank = (recentCount_ * 95) / 100;
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.begin() + recentCount_);
+    return sorted[rank];
+}
+
+} // namespace oap
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oap {
+
+/// Maps a remote media clock onto the local clock from timestamped arrivals
+/// and measures how late each arrival was, for the AA video presentation
+/// scheduler and the audio jitter buffer.
+///
+/// The mapping (offset) is the minimum transit (arrival - pts) over the
+/// current and previous kOffsetWindowUs window, so it follows slow drift
+/// between the two clocks and can rise again within two windows. A transit
+/// more than kResyncThresholdUs from the mapping means the remote restarted
+/// its timeline (new encoder session); the estimator re-anchors on it and
+/// forgets the recent jitter. Jitter is the distance above the mapping and
+/// covers network, queueing and, for video, decode.
+///
+/// Single-threaded and allocation-free.
+class TransitJitterEstimator {
+public:
+    static constexpr int64_t kOffsetWindowUs = 2000000;
+    static constexpr int64_t kResyncThresholdUs = 1000000;
+    static constexpr size_t kJitterSamples = 128;
+    /// Samples between retarget hints.
+    static constexpr int kRetargetInterval = 16;
+
+    struct Observation {
+        int64_t jitterUs = 0;
+        /// Set every kRetargetInterval samples since the last re-anchor: time
+        /// to move a delay target toward recentP95Us().
+        bool retarget = false;
+    };
+
+    Observation observe(int64_t ptsUs, int64_t arrivalUs);
+    /// Forget the mapping and recent jitter.
+    void reset();
+
+    bool hasOffset() const { return haveOffset_; }
+    /// Local time minus remote time at the minimum transit.
+    int64_t offsetUs() const { return offsetUs_; }
+    /// 95th percentile of the last kJitterSamples jitter values; 0 before
+    /// the first sample.
+    int64_t recentP95Us() const;
+
+private:
+    bool haveOffset_ = false;
+    int64_t offsetUs_ = 0;
+    int64_t windowStartUs_ = 0;
+    int64_t windowMinUs_ = 0;
+    int64_t previousWindowMinUs_ = 0;
+
+    std::array<int64_t, kJitterSamples> recentJitter_{};
+    size_t recentCount_ = 0;
+    size_t recentNext_ = 0;
+    int sinceRetarget_ = 0;
+};
+
+} // namespace oap
@@ -50,16 +50,27 @@ void YamlConfig::initDefaults()
     root_["connection"]["wifi_ap"]["channel"] = 36;
     root_["connection"]["wifi_ap"]["band"] = "a";
     root_["connection"]["tcp_port"] = 5277;
+    root_["connection"]["protocol_thread"] = false;
+    root_["connection"]["media_ack"]["mode"] = "immediate";
+    root_["connection"]["media_ack"]["flush_threshold"] = 0;
+    root_["connection"]["media_ack"]["video_hold_backlog"] = 0;
+    root_["connection"]["media_ack"]["video_max_hold_ms"] = 100;
     root_["connection"]["protocol_capture"]["enabled"] = false;
     root_["connection"]["protocol_capture"]["format"] = "jsonl";
     root_["connection"]["protocol_capture"]["include_media"] = false;
     root_["connection"]["protocol_capture"]["path"] = "/tmp/oaa-protocol-capture.jsonl";
+    root_["connection"]["protocol_capture"]["payload"] = "full";
 
     root_["audio"]["master_volume"] = 80;
     root_["audio"]["output_device"] = "auto";
+    root_["audio"]["sample_format"] = "s16";
+    root_["audio"]["profile_stages"] = false;
     root_["audio"]["buffer_ms"]["media"] = 500;
     root_["audio"]["buffer_ms"]["speech"] = 500;
     root_["audio"]["buffer_ms"]["system"] = 500;
+    root_["audio"]["jitter_buffer"]["enabled"] = true;
+    root_["audio"]["jitter_buffer"]["min_ms"] = 20;
+    root_["audio"]["jitter_buffer"]["max_ms"] = 200;
     root_["audio"]["microphone"]["device"] = "auto";
     root_["audio"]["microphone"]["gain"] = 1.0;
 
@@ -75,6 +86,13 @@ void YamlConfig::initDefaults()
     root_["video"]["resolution"] = "720p";
     root_["video"]["dpi"] = 140;
     root_["video"]["secondary_display_content"] = "map";
+    root_["video"]["software_output"] = "zero_copy";
+    root_["video"]["decode_threading"] = "slice";
+    root_["video"]["decode_threads"] = 0;
+    root_["video"]["presentation"] = "lowest_latency";
+    root_["video"]["presentation_max_delay_ms"] = 60;
+    root_["video"]["catch_up_age_ms"] = 250;
+    root_["video"]["catch_up_request_keyframe"] = false;
 
     root_["video"]["codecs"] = YAML::Node(YAML::NodeType::Sequence);
     root_["video"]["codecs"].push_back("h265");
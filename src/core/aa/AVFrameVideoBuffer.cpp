@@ -0,0 +1,46 @@
+#include "AVFrameVideoBuffer.hpp"
+
+namespace oap {
+namespace aa {
+
+AVFrameVideoBuffer::AVFrameVideoBuffer(const AVFrame* frame)
+    : QAbstractVideoBuffer()
+    , frame_(av_frame_clone(frame))  // new ref to the same buffers, no pixel copy
+    , format_(QSize(frame->width, frame->height), QVideoFrameFormat::Format_YUV420P)
+{
+}
+
+AVFrameVideoBuffer::~AVFrameVideoBuffer()
+{
+    if (frame_)
+        av_frame_free(&frame_);
+}
+
+QVideoFrameFormat AVFrameVideoBuffer::format() const
+{
+    return format_;
+}
+
+QAbstractVideoBuffer::MapData AVFrameVideoBuffer::map(QVideoFrame::MapMode mode)
+{
+    MapData data;
+    // Decoder-owned pixels may still be a reference picture for later frames.
+    if (!frame_ || (mode & QVideoFrame::WriteOnly))
+        return data;
+
+    const int chromaHeight = (frame_->height + 1) / 2;
+    data.planeCount = 3;
+    for (int i = 0; i < 3; ++i) {
+        data.data[i] = frame_->data[i];
+        data.bytesPerLine[i] = frame_->linesize[i];
+        data.dataSize[i] = frame_->linesize[i] * (i == 0 ? frame_->height : chromaHeight);
+    }
+    return data;
+}
+
+void AVFrameVideoBuffer::unmap()
+{
+}
+
+} // namespace aa
+} // namespace oap
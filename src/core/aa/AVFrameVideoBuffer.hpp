@@ -0,0 +1,45 @@
+#pragma once
+
+#include <QAbstractVideoBuffer>
+#include <QVideoFrame>
+#include <QVideoFrameFormat>
+
+extern "C" {
+#include <libavutil/frame.h>
+}
+
+namespace oap {
+namespace aa {
+
+/// Exposes a software-decoded YUV420P AVFrame to Qt without copying.
+///
+/// Holds its own reference to the decoder's frame buffers, so the decoder
+/// cannot reuse them while Qt still renders the frame; the buffers return to
+/// the codec's internal pool (avcodec_default_get_buffer2) when the last
+/// QVideoFrame is released. Planes keep FFmpeg's padded strides.
+///
+/// Software counterpart of DmaBufVideoBuffer; VideoFramePool's copy path
+/// remains for `video.software_output: copy`.
+class AVFrameVideoBuffer : public QAbstractVideoBuffer
+{
+public:
+    /// Takes its own ref of @p frame (YUV420P or YUVJ420P); the caller keeps
+    /// and may unref the original.
+    explicit AVFrameVideoBuffer(const AVFrame* frame);
+    ~AVFrameVideoBuffer() override;
+
+    /// False if the ref could not be taken (out of memory).
+    bool isValid() const { return frame_ != nullptr; }
+
+    QVideoFrameFormat format() const override;
+
+    MapData map(QVideoFrame::MapMode mode) override;
+    void unmap() override;
+
+private:
+    AVFrame* frame_;
+    QVideoFrameFormat format_;
+};
+
+} // namespace aa
+} // namespace oap
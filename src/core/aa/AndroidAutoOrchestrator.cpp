@@ -101,16 +101,18 @@ AndroidAutoOrchestrator::AndroidAutoOrchestrator(
     connect(clusterDisplay_.videoHandler(),
             &oaa::hu::VideoChannelHandler::setupRequested,
             this, [this](int) { lastProjectedActivityWasCluster_ = true; });
+    // AutoConnection: direct on the shared owner thread, queued behind the
+    // frame itself when the session runs on the protocol thread.
     connect(mainDisplay_.videoHandler(),
             &oaa::hu::VideoChannelHandler::videoFrameData,
             this, [this](const auto&, qint64) {
                 lastProjectedActivityWasCluster_ = false;
-            }, Qt::DirectConnection);
+            });
     connect(clusterDisplay_.videoHandler(),
             &oaa::hu::VideoChannelHandler::videoFrameData,
             this, [this](const auto&, qint64) {
                 lastProjectedActivityWasCluster_ = true;
-            }, Qt::DirectConnection);
+            });
     connect(&clusterDisplay_,
             &ProjectedDisplaySession::clusterProfileChangeRequested,
             this, [this]() {
@@ -125,7 +127,19 @@ AndroidAutoOrchestrator::AndroidAutoOrchestrator(
 
     // AVInput requests are handled synchronously on this Qt owner thread so an
     // immediate PipeWire failure can be reported honestly before the response.
+    // On the protocol thread the handler must not block on the owner, so the
+    // open is acknowledged optimistically and a failed start aborts afterwards.
     avInputHandler_.setCaptureController([this](bool open) {
+        if (protocolThread_ && protocolThread_->isCurrentThread()) {
+            QMetaObject::invokeMethod(this, [this, open]() {
+                if (!open) {
+                    stopAssistantMicCapture();
+                } else if (!startAssistantMicCapture()) {
+                    postToSessionThread([this]() { avInputHandler_.abortCapture(); });
+                }
+            }, Qt::QueuedConnection);
+            return true;
+        }
         if (!open) {
             stopAssistantMicCapture();
             return true;
@@ -133,8 +147,7 @@ AndroidAutoOrchestrator::AndroidAutoOrchestrator(
         return startAssistantMicCapture();
     });
     connect(&avInputHandler_, &oaa::hu::AVInputChannelHandler::sendWindowAvailable,
-            &micCaptureBridge_, &AVInputCaptureBridge::notifyWindowAvailable,
-            Qt::DirectConnection);
+            &micCaptureBridge_, &AVInputCaptureBridge::notifyWindowAvailable);
 
     micCaptureOpen_ = [this](const MicCaptureRequest& request) -> oap::AudioStreamHandle* {
         if (!concreteAudio_)
@@ -258,13 +271,16 @@ void AndroidAutoOrchestrator::stop()
     if (session_ && (state_ == Connected || state_ == Backgrounded)) {
         qCDebug(lcAA) << "Sending graceful shutdown to phone";
         QPointer<oaa::AASession> stoppingSession(session_);
-        session_->stop(7);  // POWER_DOWN — app is exiting
-        // QTcpSocket buffers writes until the event loop runs, and synchronous
-        // teardown destroys the socket (an abort) before that ever happens —
-        // flush now or the ShutdownRequest never reaches the wire.
-        if (activeSocket_
-            && activeSocket_->state() == QAbstractSocket::ConnectedState)
-            activeSocket_->flush();
+        runOnSessionThread([this]() {
+            session_->stop(7);  // POWER_DOWN — app is exiting
+            // QTcpSocket buffers writes until the event loop runs, and
+            // synchronous teardown destroys the socket (an abort) before that
+            // ever happens — flush now or the ShutdownRequest never reaches
+            // the wire.
+            if (activeSocket_
+                && activeSocket_->state() == QAbstractSocket::ConnectedState)
+                activeSocket_->flush();
+        });
         if (session_ == stoppingSession.data())
             teardownSession(false);
     } else {
@@ -296,7 +312,7 @@ void AndroidAutoOrchestrator::disconnectSession()
     // The session has a 5s internal timeout; when the ack arrives (or times out),
     // it emits disconnected → onSessionDisconnected handles teardown normally.
     // No blocking event loop here — that causes re-entrancy crashes.
-    session_->stop(1);
+    postToSessionThread([session = session_]() { session->stop(1); });
 }
 
 void AndroidAutoOrchestrator::disconnectAndRetrigger()
@@ -365,8 +381,15 @@ void AndroidAutoOrchestrator::onNewConnection()
     activeSocket_ = socket;
     lastProjectedActivityWasCluster_ = false;
 
+    // Parentless on the protocol thread: only top-level objects can move.
+    const QVariant protocolThreadVar = yamlConfig_
+        ? yamlConfig_->valueByPath("connection.protocol_thread") : QVariant();
+    const bool useProtocolThread = protocolThreadVar.isValid()
+        && protocolThreadVar.toBool();
+    QObject* sessionParent = useProtocolThread ? nullptr : this;
+
     // Create transport
-    transport_ = new oaa::TCPTransport(this);
+    transport_ = new oaa::TCPTransport(sessionParent);
     transport_->setSocket(socket);
     transport_->start();
 
@@ -408,7 +431,7 @@ void AndroidAutoOrchestrator::onNewConnection()
     oaa::SessionConfig config = builder.build();
 
     // Create session
-    session_ = new oaa::AASession(transport_, config, this);
+    session_ = new oaa::AASession(transport_, config, sessionParent);
 
     // Setup responses must enumerate exactly the configs in each descriptor.
     mainDisplay_.setAdvertisedVideoConfigCount(
@@ -431,6 +454,8 @@ void AndroidAutoOrchestrator::onNewConnection()
             << builder.videoConfigCount(ProjectedDisplayRole::Cluster);
     }
 
+    applyMediaAckPolicy();
+
     // Register all known channel handlers.
     //
     // Registered: Control(0), Input(1), Sensor(2), Video(3), MediaAudio(4),
@@ -537,20 +562,33 @@ void AndroidAutoOrchestrator::onNewConnection()
         }
 
         if (concreteAudio_) {
+            // AA packets carry phone timestamps: size each stream's delay
+            // from their arrival jitter and conceal gaps instead of
+            // playing hard silence.
+            const bool jitterBuffer = yamlConfig_
+                ? yamlConfig_->valueByPath("audio.jitter_buffer.enabled").toBool() : true;
+            const int jitterMinMs = yamlConfig_
+                ? yamlConfig_->valueByPath("audio.jitter_buffer.min_ms").toInt() : 20;
+            const int jitterMaxMs = yamlConfig_
+                ? yamlConfig_->valueByPath("audio.jitter_buffer.max_ms").toInt() : 200;
+
             // Preferred path: attach the engine via options (before connect).
             oap::AudioService::PlaybackStreamOptions mo;
             mo.name = "AA Media"; mo.priority = 50; mo.sampleRate = 48000;
             mo.channels = 2; mo.bufferMs = mediaBufMs; mo.eqEngine = mediaEq_;
+            mo.jitterBuffer = jitterBuffer; mo.jitterMinMs = jitterMinMs; mo.jitterMaxMs = jitterMaxMs;
             mediaStream_ = concreteAudio_->createStreamWithOptions(mo);
 
             oap::AudioService::PlaybackStreamOptions so;
             so.name = "AA Speech"; so.priority = 60; so.sampleRate = 48000;
             so.channels = 1; so.bufferMs = speechBufMs; so.eqEngine = speechEq_;
+            so.jitterBuffer = jitterBuffer; so.jitterMinMs = jitterMinMs; so.jitterMaxMs = jitterMaxMs;
             speechStream_ = concreteAudio_->createStreamWithOptions(so);
 
             oap::AudioService::PlaybackStreamOptions syso;
             syso.name = "AA System"; syso.priority = 40; syso.sampleRate = 16000;
             syso.channels = 1; syso.bufferMs = systemBufMs; syso.eqEngine = systemEq_;
+            syso.jitterBuffer = jitterBuffer; syso.jitterMinMs = jitterMinMs; syso.jitterMaxMs = jitterMaxMs;
             systemStream_ = concreteAudio_->createStreamWithOptions(syso);
         } else {
             // Fallback (mock IAudioService in tests): legacy createStream +
@@ -566,28 +604,31 @@ void AndroidAutoOrchestrator::onNewConnection()
 
         if (mediaStream_) {
             connect(&mediaAudioHandler_, &oaa::hu::AudioChannelHandler::audioDataReceived,
-                    this, [this](const QByteArray& data, uint64_t) {
+                    this, [this](const QByteArray& data, uint64_t timestamp) {
                         if (audioService_ && mediaStream_) {
-                            audioService_->writeAudio(mediaStream_,
-                                reinterpret_cast<const uint8_t*>(data.constData()), data.size());
+                            audioService_->writeTimedAudio(mediaStream_,
+                                reinterpret_cast<const uint8_t*>(data.constData()), data.size(),
+                                timestamp);
                         }
                     }, Qt::QueuedConnection);
         }
         if (speechStream_) {
             connect(&speechAudioHandler_, &oaa::hu::AudioChannelHandler::audioDataReceived,
-                    this, [this](const QByteArray& data, uint64_t) {
+                    this, [this](const QByteArray& data, uint64_t timestamp) {
                         if (audioService_ && speechStream_) {
-                            audioService_->writeAudio(speechStream_,
-                                reinterpret_cast<const uint8_t*>(data.constData()), data.size());
+                            audioService_->writeTimedAudio(speechStream_,
+                                reinterpret_cast<const uint8_t*>(data.constData()), data.size(),
+                                timestamp);
                         }
                     }, Qt::QueuedConnection);
         }
         if (systemStream_) {
             connect(&systemAudioHandler_, &oaa::hu::AudioChannelHandler::audioDataReceived,
-                    this, [this](const QByteArray& data, uint64_t) {
+                    this, [this](const QByteArray& data, uint64_t timestamp) {
                         if (audioService_ && systemStream_) {
-                            audioService_->writeAudio(systemStream_,
-                                reinterpret_cast<const uint8_t*>(data.constData()), data.size());
+                            audioService_->writeTimedAudio(systemStream_,
+                                reinterpret_cast<const uint8_t*>(data.constData()), data.size(),
+                                timestamp);
                         }
                     }, Qt::QueuedConnection);
         }
@@ -804,8 +845,11 @@ void AndroidAutoOrchestrator::onNewConnection()
     if (projectedClusterConfig_.enabled)
         clusterDisplay_.beginProtocolSession();
 
+    if (useProtocolThread)
+        attachSessionToProtocolThread();
+
     // Start protocol handshake
-    session_->start();
+    postToSessionThread([session = session_]() { session->start(); });
 }
 
 void AndroidAutoOrchestrator::setNightModeService(oap::NightModeService* service)
@@ -832,6 +876,10 @@ void AndroidAutoOrchestrator::setNightModeService(oap::NightModeService* service
 
 void AndroidAutoOrchestrator::onSessionStateChanged(oaa::SessionState state)
 {
+    // Queued delivery from the protocol thread can outlive its session.
+    if (sender() && sender() != session_)
+        return;
+
     switch (state) {
     case oaa::SessionState::Active:
         qCInfo(lcAA) << "Android Auto connected!";
@@ -860,6 +908,9 @@ void AndroidAutoOrchestrator::onSessionStateChanged(oaa::SessionState state)
 
 void AndroidAutoOrchestrator::onSessionDisconnected(oaa::DisconnectReason reason)
 {
+    if (sender() && sender() != session_)
+        return;
+
     qCInfo(lcAA) << "Disconnected, reason:" << static_cast<int>(reason)
                  << "last_projected_role="
                  << (lastProjectedActivityWasCluster_ ? "CLUSTER" : "MAIN");
@@ -923,6 +974,10 @@ void AndroidAutoOrchestrator::startProtocolCapture()
     const QVariant includeMediaVar = yamlConfig_->valueByPath("connection.protocol_capture.include_media");
     const bool includeMedia = includeMediaVar.isValid() ? includeMediaVar.toBool() : false;
 
+    const QString payload = yamlConfig_->valueByPath("connection.protocol_capture.payload")
+                                .toString().trimmed().toLower();
+    const bool digestPayloads = payload == "digest";
+
     if (!protocolLogger_) {
         protocolLogger_ = std::make_unique<oaa::ProtocolLogger>();
     }
@@ -931,8 +986,13 @@ void AndroidAutoOrchestrator::startProtocolCapture()
     protocolLogger_->close();
     protocolLogger_->setFormat(format == "jsonl"
         ? oaa::ProtocolLogger::OutputFormat::Jsonl
-        : oaa::ProtocolLogger::OutputFormat::Tsv);
+        : format == "binary"
+            ? oaa::ProtocolLogger::OutputFormat::Binary
+            : oaa::ProtocolLogger::OutputFormat::Tsv);
     protocolLogger_->setIncludeMedia(includeMedia);
+    protocolLogger_->setPayloadMode(digestPayloads
+        ? oaa::ProtocolLogger::PayloadMode::Digest
+        : oaa::ProtocolLogger::PayloadMode::Full);
     protocolLogger_->open(path.toStdString());
     if (!protocolLogger_->isOpen()) {
         qCWarning(lcAA) << "Protocol capture enabled but failed to open:" << path;
@@ -943,7 +1003,8 @@ void AndroidAutoOrchestrator::startProtocolCapture()
     qCInfo(lcAA) << "Protocol capture active:"
             << "path=" << path
             << "format=" << format
-            << "include_media=" << includeMedia;
+            << "include_media=" << includeMedia
+            << "payload=" << (digestPayloads ? "digest" : "full");
 }
 
 void AndroidAutoOrchestrator::stopProtocolCapture()
@@ -952,8 +1013,139 @@ void AndroidAutoOrchestrator::stopProtocolCapture()
         return;
     }
 
+    const bool wasOpen = protocolLogger_->isOpen();
     protocolLogger_->detach();
     protocolLogger_->close();
+    if (wasOpen) {
+        qCInfo(lcAA) << "Protocol capture closed:"
+                << "written=" << protocolLogger_->writtenCount()
+                << "dropped=" << protocolLogger_->droppedCount();
+    }
+}
+
+QList<oaa::IChannelHandler*> AndroidAutoOrchestrator::sessionHandlers()
+{
+    QList<oaa::IChannelHandler*> handlers{
+        mainDisplay_.videoHandler(), mainDisplay_.inputHandler(),
+        &mediaAudioHandler_, &speechAudioHandler_, &systemAudioHandler_,
+        &sensorHandler_, &btHandler_, &avInputHandler_, &navHandler_,
+        &mediaStatusHandler_, &phoneStatusHandler_,
+    };
+    if (wifiHandler_)
+        handlers.append(wifiHandler_.get());
+    if (projectedClusterConfig_.enabled) {
+        handlers.append(clusterDisplay_.videoHandler());
+        handlers.append(clusterDisplay_.inputHandler());
+    }
+    return handlers;
+}
+
+void AndroidAutoOrchestrator::applyMediaAckPolicy()
+{
+    oaa::MediaAckPolicy policy;
+    if (yamlConfig_) {
+        const QString mode = yamlConfig_->valueByPath("connection.media_ack.mode")
+                                 .toString().trimmed().toLower();
+        if (mode == QLatin1String("coalesced"))
+            policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        else if (!mode.isEmpty() && mode != QLatin1String("immediate"))
+            qCWarning(lcAA) << "Unknown connection.media_ack.mode" << mode
+                            << "- using immediate";
+        const int threshold = yamlConfig_->valueByPath(
+            "connection.media_ack.flush_threshold").toInt();
+        policy.flushThreshold = threshold > 0 ? static_cast<uint32_t>(threshold) : 0;
+    }
+
+    // Back-pressure applies to video only: the display sessions probe their
+    // decoder queues, audio has its own buffering and rate matching.
+    oaa::MediaAckPolicy videoPolicy = policy;
+    if (yamlConfig_) {
+        const int holdBacklog = yamlConfig_->valueByPath(
+            "connection.media_ack.video_hold_backlog").toInt();
+        videoPolicy.holdBacklog = holdBacklog > 0 ? static_cast<uint32_t>(holdBacklog) : 0;
+        const int maxHoldMs = yamlConfig_->valueByPath(
+            "connection.media_ack.video_max_hold_ms").toInt();
+        if (maxHoldMs > 0)
+            videoPolicy.maxHoldMs = static_cast<uint32_t>(maxHoldMs);
+    }
+
+    mainDisplay_.videoHandler()->setAckPolicy(videoPolicy);
+    clusterDisplay_.videoHandler()->setAckPolicy(videoPolicy);
+    mediaAudioHandler_.setAckPolicy(policy);
+    speechAudioHandler_.setAckPolicy(policy);
+    systemAudioHandler_.setAckPolicy(policy);
+}
+
+void AndroidAutoOrchestrator::logMediaAckStats()
+{
+    const auto log = [](const char* channel, uint64_t frames, uint64_t records,
+                        uint64_t permits) {
+        if (frames == 0)
+            return;
+        qCInfo(lcAA) << "[Perf] Media ACKs:" << channel << "frames=" << frames
+                     << "ack_records=" << records << "permits=" << permits;
+    };
+    const auto logHolds = [](const char* channel, const oaa::hu::VideoChannelHandler* handler) {
+        if (handler->ackHoldCount() == 0)
+            return;
+        qCInfo(lcAA) << "[Perf] Media ACKs:" << channel << "holds=" << handler->ackHoldCount()
+                     << "timeouts=" << handler->ackHoldTimeoutCount()
+                     << "held_ms=" << handler->ackHeldUs() / 1000;
+    };
+    const auto* video = mainDisplay_.videoHandler();
+    log("video", video->receivedFrameCount(), video->ackCount(), video->ackedFrameCount());
+    logHolds("video", video);
+    if (projectedClusterConfig_.enabled) {
+        const auto* cluster = clusterDisplay_.videoHandler();
+        log("cluster_video", cluster->receivedFrameCount(), cluster->ackCount(),
+            cluster->ackedFrameCount());
+        logHolds("cluster_video", cluster);
+    }
+    log("media_audio", mediaAudioHandler_.receivedFrameCount(),
+        mediaAudioHandler_.ackCount(), mediaAudioHandler_.ackedFrameCount());
+    log("speech_audio", speechAudioHandler_.receivedFrameCount(),
+        speechAudioHandler_.ackCount(), speechAudioHandler_.ackedFrameCount());
+    log("system_audio", systemAudioHandler_.receivedFrameCount(),
+        systemAudioHandler_.ackCount(), systemAudioHandler_.ackedFrameCount());
+}
+
+void AndroidAutoOrchestrator::attachSessionToProtocolThread()
+{
+    Q_ASSERT(QThread::currentThread() == thread());
+    if (!protocolThread_)
+        protocolThread_ = std::make_unique<oaa::ProtocolThread>();
+    protocolThread_->start();
+
+    // Everything AASession dispatches to directly must share its thread;
+    // owner-side receivers were connected with AutoConnection and now queue.
+    const auto handlers = sessionHandlers();
+    bool attached = protocolThread_->attach(transport_)
+        && protocolThread_->attach(session_);
+    for (auto* handler : handlers)
+        attached = protocolThread_->attach(handler) && attached;
+    if (!attached) {
+        qCCritical(lcAA) << "Protocol thread attach failed; session objects"
+                            " are split across threads";
+    }
+    sessionOnProtocolThread_ = true;
+    qCInfo(lcAA) << "AA session running on protocol thread with"
+                 << handlers.size() << "handlers";
+}
+
+void AndroidAutoOrchestrator::postToSessionThread(std::function<void()> fn)
+{
+    if (sessionOnProtocolThread_)
+        protocolThread_->post(std::move(fn));
+    else
+        fn();
+}
+
+void AndroidAutoOrchestrator::runOnSessionThread(const std::function<void()>& fn)
+{
+    if (sessionOnProtocolThread_)
+        protocolThread_->invokeBlocking(fn);
+    else
+        fn();
 }
 
 bool AndroidAutoOrchestrator::startAssistantMicCapture()
@@ -968,6 +1160,14 @@ bool AndroidAutoOrchestrator::startAssistantMicCapture()
     const uint64_t generation = micCaptureBridge_.start(
         gain,
         [this](const QByteArray& pcm, uint64_t timestampUs) {
+            if (sessionOnProtocolThread_) {
+                // The handler's unacked window still bounds the wire; frames
+                // past it are dropped there instead of held in the bridge.
+                postToSessionThread([this, pcm, timestampUs]() {
+                    avInputHandler_.sendMicData(pcm, timestampUs);
+                });
+                return true;
+            }
             return avInputHandler_.sendMicData(pcm, timestampUs);
         });
     if (generation == 0)
@@ -1020,7 +1220,7 @@ void AndroidAutoOrchestrator::onAssistantMicCaptureError(uint64_t generation)
 
     qCWarning(lcAA) << "AA Assistant microphone capture failed at runtime";
     stopAssistantMicCapture();
-    avInputHandler_.abortCapture();
+    postToSessionThread([this]() { avInputHandler_.abortCapture(); });
 }
 
 void AndroidAutoOrchestrator::onAudioServiceAboutToDestroy()
@@ -1031,7 +1231,7 @@ void AndroidAutoOrchestrator::onAudioServiceAboutToDestroy()
     // valid. Quiesce our capture now, then invalidate every non-owning audio
     // handle before AudioService destroys any remaining objects itself.
     stopAssistantMicCapture();
-    avInputHandler_.abortCapture();
+    runOnSessionThread([this]() { avInputHandler_.abortCapture(); });
     mediaAudioHandler_.disconnect(this);
     speechAudioHandler_.disconnect(this);
     systemAudioHandler_.disconnect(this);
@@ -1052,7 +1252,7 @@ void AndroidAutoOrchestrator::teardownSession(bool deferDeletion)
     // Stop the real-time producer before AASession::finalize() disconnects the
     // persistent AVInput handler from its Messenger send edge.
     stopAssistantMicCapture();
-    avInputHandler_.abortCapture();
+    runOnSessionThread([this]() { avInputHandler_.abortCapture(); });
     stopProtocolCapture();
 
     // Reset phone status properties (no stale data after disconnect)
@@ -1085,9 +1285,32 @@ void AndroidAutoOrchestrator::teardownSession(bool deferDeletion)
         // session. Finalize synchronously while they and the transport are
         // alive so every handler loses old wire state/send connections exactly
         // once. The session destructor deliberately performs no external work.
-        session_->finalize();
+        runOnSessionThread([this]() {
+            const auto rx = session_->messenger()->receiveStats();
+            if (rx.frames > 0) {
+                qCInfo(lcAA) << "[Perf] Receive path: frames=" << rx.frames
+                             << "bytes_copied=" << rx.bytesCopied
+                             << "per_frame=" << rx.bytesCopied / rx.frames;
+            }
+            logMediaAckStats();
+            session_->finalize();
+        });
 
-        if (deferDeletion) {
+        if (sessionOnProtocolThread_) {
+            // Session signals reach us queued, so this is never inside one of
+            // their emissions: destroy on the thread that owns the socket and
+            // return the handlers for the next session's registration.
+            QThread* owner = thread();
+            const auto handlers = sessionHandlers();
+            protocolThread_->invokeBlocking([this, owner, &handlers]() {
+                for (auto* handler : handlers)
+                    handler->moveToThread(owner);
+                delete session_;
+                delete transport_;
+            });
+            transport_ = nullptr;
+            sessionOnProtocolThread_ = false;
+        } else if (deferDeletion) {
             // teardownSession() is often called from within
             // onSessionStateChanged(), a direct-connection slot. Deleting the
             // sender there would cause UAF when Qt signal dispatch resumes.
@@ -1126,7 +1349,9 @@ void AndroidAutoOrchestrator::requestVideoFocus()
 {
     if (state_ == Backgrounded) {
         qCInfo(lcAA) << "Requesting video focus (returning from background)";
-        mainDisplay_.videoHandler()->requestVideoFocus(true);
+        postToSessionThread([this]() {
+            mainDisplay_.videoHandler()->requestVideoFocus(true);
+        });
         setState(Connected, "Android Auto active");
     }
 }
@@ -1135,7 +1360,9 @@ void AndroidAutoOrchestrator::requestExitToCar()
 {
     if (state_ == Connected) {
         qCInfo(lcAA) << "Requesting exit to car";
-        mainDisplay_.videoHandler()->requestVideoFocus(false);
+        postToSessionThread([this]() {
+            mainDisplay_.videoHandler()->requestVideoFocus(false);
+        });
         setState(Backgrounded, "Exited to car");
     }
 }
@@ -1146,10 +1373,12 @@ void AndroidAutoOrchestrator::sendButtonPress(int keycode)
     auto ts = static_cast<uint64_t>(
         std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::steady_clock::now().time_since_epoch()).count());
-    mainDisplay_.inputHandler()->sendButtonEvent(
-        static_cast<uint32_t>(keycode), true, ts);
-    mainDisplay_.inputHandler()->sendButtonEvent(
-        static_cast<uint32_t>(keycode), false, ts + 50000);
+    postToSessionThread([this, keycode, ts]() {
+        mainDisplay_.inputHandler()->sendButtonEvent(
+            static_cast<uint32_t>(keycode), true, ts);
+        mainDisplay_.inputHandler()->sendButtonEvent(
+            static_cast<uint32_t>(keycode), false, ts + 50000);
+    });
 }
 
 void AndroidAutoOrchestrator::setState(ConnectionState state, const QString& message)
@@ -1176,7 +1405,11 @@ void AndroidAutoOrchestrator::startConnectionWatchdog()
             return;
         }
 
-        auto fd = activeSocket_->socketDescriptor();
+        // The socket lives on the session thread when the protocol thread is
+        // enabled; touch it only there.
+        qintptr fd = -1;
+        QTcpSocket* socket = activeSocket_;
+        runOnSessionThread([socket, &fd]() { fd = socket->socketDescriptor(); });
         if (fd == -1) {
             qCWarning(lcAA) << "Watchdog: socket descriptor invalid";
             teardownSession();
@@ -1216,7 +1449,7 @@ void AndroidAutoOrchestrator::startConnectionWatchdog()
         }
 
         if (dead) {
-            activeSocket_->abort();
+            runOnSessionThread([socket]() { socket->abort(); });
             onSessionDisconnected(oaa::DisconnectReason::TransportError);
         }
     });
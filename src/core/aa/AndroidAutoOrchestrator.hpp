@@ -1,13 +1,16 @@
 #pragma once
 
+#include <QList>
 #include <QObject>
 #include <QThread>
 #include <QTcpServer>
 #include <QTcpSocket>
 #include <QTimer>
+#include <functional>
 #include <memory>
 
 #include <oaa/Session/AASession.hpp>
+#include <oaa/Session/ProtocolThread.hpp>
 #include <oaa/Transport/TCPTransport.hpp>
 #include <oaa/Messenger/ProtocolLogger.hpp>
 
@@ -149,6 +152,17 @@ private:
     void onAssistantMicCaptureError(uint64_t generation);
     void onAudioServiceAboutToDestroy();
 
+    // connection.protocol_thread: when set, the transport, AASession and every
+    // registered handler live on protocolThread_ for the session's lifetime.
+    // Owner-thread calls into them go through these helpers; without the
+    // option both run the function inline.
+    QList<oaa::IChannelHandler*> sessionHandlers();
+    void attachSessionToProtocolThread();
+    void applyMediaAckPolicy();
+    void logMediaAckStats();
+    void postToSessionThread(std::function<void()> fn);
+    void runOnSessionThread(const std::function<void()>& fn);
+
     oap::IConfigService* configService_;
     oap::IAudioService* audioService_;
     // Concrete AudioService (createStreamWithOptions), cached from a
@@ -226,6 +240,10 @@ private:
 
     std::unique_ptr<oaa::ProtocolLogger> protocolLogger_;
 
+    // Declared after the handlers so it joins before they are destroyed.
+    std::unique_ptr<oaa::ProtocolThread> protocolThread_;
+    bool sessionOnProtocolThread_ = false;
+
     ConnectionState state_ = Disconnected;
     QString statusMessage_;
     bool pendingReconnect_ = false;
@@ -3,6 +3,7 @@
 #include "EvdevTouchReader.hpp"
 #include "EvdevCoordBridge.hpp"
 #include "ServiceDiscoveryBuilder.hpp"
+#include "VideoResolutionHelper.hpp"
 #include "core/InputDeviceScanner.hpp"
 #include "core/services/IConfigService.hpp"
 #include "ui/DisplayInfo.hpp"
@@ -34,13 +35,9 @@ int AndroidAutoRuntimeBridge::computeNavbarThickness(int dpi, double globalScale
 
 std::pair<int, int> AndroidAutoRuntimeBridge::resolveAAResolution(IConfigService* configService)
 {
-    int aaW = 1280, aaH = 720;
-    if (configService) {
-        QString res = configService->value("video.resolution").toString();
-        if (res == QLatin1String("1080p")) { aaW = 1920; aaH = 1080; }
-        else if (res == QLatin1String("480p")) { aaW = 800; aaH = 480; }
-    }
-    return {aaW, aaH};
+    const QSize size = videoResolutionSize(
+        configService ? configService->value("video.resolution").toString() : QString());
+    return {size.width(), size.height()};
 }
 
 QString AndroidAutoRuntimeBridge::resolveTouchDevice(IConfigService* configService) const
@@ -2,11 +2,9 @@
 
 #include <chrono>
 #include <cstdint>
-#include <algorithm>
-#include <string>
-#include <sstream>
-#include <iomanip>
-#include <QDebug>
+#include <QString>
+
+#include "core/LatencyHistogram.hpp"
 
 namespace oap {
 namespace aa {
@@ -15,32 +13,23 @@ struct PerfStats {
     using Clock = std::chrono::steady_clock;
     using TimePoint = Clock::time_point;
 
-    struct Metric {
-        double sum = 0.0;
-        double min = 1e9;
-        double max = 0.0;
-        uint64_t count = 0;
-
-        void record(double ms) {
-            sum += ms;
-            min = std::min(min, ms);
-            max = std::max(max, ms);
-            ++count;
-        }
-
-        double avg() const { return count > 0 ? sum / count : 0.0; }
-
-        void reset() {
-            sum = 0.0;
-            min = 1e9;
-            max = 0.0;
-            count = 0;
-        }
-    };
-
     static double msElapsed(TimePoint start, TimePoint end) {
         return std::chrono::duration<double, std::milli>(end - start).count();
     }
+
+    /// Histogram samples are whole microseconds; negative spans record as 0.
+    static uint64_t usElapsed(TimePoint start, TimePoint end) {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        return us > 0 ? static_cast<uint64_t>(us) : 0;
+    }
+
+    /// "p50=1.2 p99=3.4 p99.9=5.6" in milliseconds for a microsecond window.
+    static QString percentilesMs(const LatencyHistogram::Snapshot& window) {
+        auto ms = [](uint64_t us) { return QString::number(us / 1000.0, 'f', 1); };
+        return QStringLiteral("p50=%1 p90=%2 p99=%3 p99.9=%4")
+            .arg(ms(window.percentile(50.0)), ms(window.percentile(90.0)),
+                 ms(window.percentile(99.0)), ms(window.percentile(99.9)));
+    }
 };
 
 } // namespace aa
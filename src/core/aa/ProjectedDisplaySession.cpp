@@ -1,11 +1,19 @@
 #include "ProjectedDisplaySession.hpp"
+#include "VideoResolutionHelper.hpp"
 
 #include "../Logging.hpp"
 #include "../YamlConfig.hpp"
 
+#include <QGuiApplication>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QScreen>
 #include <QThread>
 #include <QVideoFrame>
 
+#include <algorithm>
+#include <chrono>
+
 namespace oap::aa {
 
 namespace {
@@ -25,6 +33,18 @@ QString roleName(ProjectedDisplayRole role)
         : QStringLiteral("CLUSTER");
 }
 
+int64_t monotonicUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        PerfStats::Clock::now().time_since_epoch()).count();
+}
+
+int64_t refreshPeriodUs(const QScreen* screen)
+{
+    const qreal hz = screen ? screen->refreshRate() : 0.0;
+    return hz >= 1.0 ? static_cast<int64_t>(1000000.0 / hz) : 16667;
+}
+
 } // namespace
 
 ProjectedDisplaySession::ProjectedDisplaySession(
@@ -56,6 +76,36 @@ ProjectedDisplaySession::ProjectedDisplaySession(
         decoder_ = std::make_unique<VideoDecoder>();
         decoder_->setYamlConfig(yamlConfig);
         decoder_->setDiagnosticLabel(diagnosticPrefix_);
+        if (role_ == ProjectedDisplayRole::Cluster) {
+            decoder_->setExpectedFrameHeight(activeProfile_.geometry().encodedHeight);
+        } else if (yamlConfig) {
+            decoder_->setExpectedFrameHeight(
+                videoResolutionSize(yamlConfig->videoResolution()).height());
+        }
+        if (yamlConfig) {
+            if (yamlConfig->valueByPath("video.presentation").toString()
+                == QLatin1String("smooth")) {
+                scheduler_.setMode(VideoPresentationScheduler::Mode::Smooth);
+            }
+            scheduler_.setMaxDelayUs(
+                yamlConfig->valueByPath("video.presentation_max_delay_ms").toInt()
+                * int64_t(1000));
+        }
+        jitterRegistration_ = MetricsRegistry::instance().add(
+            QStringLiteral("video.jitter"), diagnosticPrefix_,
+            QStringLiteral("us"), &scheduler_.jitter());
+        latenessRegistration_ = MetricsRegistry::instance().add(
+            QStringLiteral("video.present_late"), diagnosticPrefix_,
+            QStringLiteral("us"), &scheduler_.lateness());
+        // Read on the protocol thread when the session runs there; the
+        // worker queue is mutex-guarded.
+        videoHandler_.setBacklogProbe([decoder = decoder_.get()]() {
+            return static_cast<uint32_t>(decoder->queueDepth());
+        });
+        vsyncTimer_.setSingleShot(true);
+        vsyncTimer_.setTimerType(Qt::PreciseTimer);
+        connect(&vsyncTimer_, &QTimer::timeout,
+                this, &ProjectedDisplaySession::presentDueFrame);
         state_ = Disconnected;
         statusText_ = QStringLiteral("Android Auto disconnected");
     } else {
@@ -95,6 +145,7 @@ ProjectedDisplaySession::ProjectedDisplaySession(
                 if (terminalStateLatched_ || !decoder_)
                     return;
                 activeDecoderGeneration_ = decoder_->beginStream();
+                scheduler_.reset();
                 firstDecodedLogged_ = false;
                 qCInfo(lcAA).noquote() << diagnosticPrefix_
                                       << "stream started session=" << session
@@ -116,6 +167,7 @@ ProjectedDisplaySession::ProjectedDisplaySession(
                 qCInfo(lcAA).noquote() << diagnosticPrefix_ << "stream stopped";
                 activeDecoderGeneration_ = 0;
                 decoder_->endStream();
+                scheduler_.reset();
                 setState(videoChannelOpen_ ? WaitingForFrames
                                            : WaitingForChannel,
                          videoChannelOpen_
@@ -134,11 +186,11 @@ ProjectedDisplaySession::ProjectedDisplaySession(
     connect(&videoHandler_, &oaa::hu::VideoChannelHandler::videoFrameData,
             this,
             [this](std::shared_ptr<const QByteArray> data,
-                   qint64 enqueueTimeNs) {
-                // AASession, the channel handler, and this display session
-                // share one Qt event-loop thread. Direct delivery avoids a
-                // frame copy but must remain owner-thread-only because this
-                // path updates generation and summary state.
+                   qint64 enqueueTimeNs, qint64 phoneTimestampUs) {
+                // Direct when AASession and the handler share this display
+                // session's thread; queued (the shared_ptr, not the frame)
+                // when they run on the protocol thread. Either way this path
+                // updates generation and summary state on the owner thread.
                 Q_ASSERT(QThread::currentThread() == thread());
                 if (!protocolActive_ || terminalStateLatched_ || !decoder_
                     || activeDecoderGeneration_ == 0) {
@@ -151,9 +203,9 @@ ProjectedDisplaySession::ProjectedDisplaySession(
                                           << (data ? data->size() : 0);
                 }
                 maybeLogFrameSummary();
-                decoder_->decodeFrame(std::move(data), enqueueTimeNs);
-            },
-            Qt::DirectConnection);
+                decoder_->decodeFrame(std::move(data), enqueueTimeNs,
+                                      phoneTimestampUs);
+            });
     if (!decoder_)
         return;
 
@@ -192,8 +244,13 @@ ProjectedDisplaySession::ProjectedDisplaySession(
                             << diagnosticPrefix_ << "first decoded frame"
                             << frame.width() << "x" << frame.height();
                     }
-                    if (QVideoSink* sink = decoder_->videoSink())
-                        sink->setVideoFrame(frame);
+                    scheduler_.push(std::move(frame), monotonicUs());
+                    if (scheduler_.mode()
+                        == VideoPresentationScheduler::Mode::LowestLatency) {
+                        presentDueFrame();
+                    } else {
+                        requestVsync();
+                    }
                 }
                 setState(Rendering, QStringLiteral("Rendering projected display"));
             });
@@ -207,6 +264,21 @@ ProjectedDisplaySession::ProjectedDisplaySession(
                                          << "decoder error:" << message;
                 enterTerminalState(Error, message);
             });
+    connect(decoder_.get(), &VideoDecoder::keyframeNeeded,
+            this, [this](quint64 generation) {
+                if (!protocolActive_ || terminalStateLatched_ || generation == 0
+                    || generation != activeDecoderGeneration_) {
+                    return;
+                }
+                // AA has no keyframe request message; phones restart the
+                // encoder with an IDR when projected focus is re-asserted.
+                qCInfo(lcAA).noquote() << diagnosticPrefix_
+                                      << "video backlog stale without a keyframe,"
+                                         " re-asserting projected focus";
+                QMetaObject::invokeMethod(&videoHandler_, [this]() {
+                    videoHandler_.requestVideoFocus(true);
+                });
+            });
     connect(decoder_.get(), &VideoDecoder::streamEnded,
             this, [this](quint64 generation) {
                 qCInfo(lcAA).noquote() << diagnosticPrefix_
@@ -219,6 +291,7 @@ ProjectedDisplaySession::~ProjectedDisplaySession()
 {
     protocolActive_ = false;
     activeDecoderGeneration_ = 0;
+    videoHandler_.setBacklogProbe({});
     if (decoder_) {
         decoder_->endStream();
         if (decoder_->videoSink())
@@ -320,6 +393,8 @@ void ProjectedDisplaySession::activateRequestedClusterProfile()
     const ProjectedViewportGeometry oldGeometry = activeProfile_.geometry();
     activeProfile_ = requestedProfile_;
     const ProjectedViewportGeometry geometry = activeProfile_.geometry();
+    if (decoder_)
+        decoder_->setExpectedFrameHeight(geometry.encodedHeight);
     profileStatusText_ = QStringLiteral("Profile active");
     emit profileDiagnosticsChanged();
     if (!(oldGeometry == geometry))
@@ -379,6 +454,7 @@ void ProjectedDisplaySession::endProtocolSession()
     activeDecoderGeneration_ = 0;
     if (decoder_)
         decoder_->endStream();
+    scheduler_.reset();
     qCInfo(lcAA).noquote() << diagnosticPrefix_
                           << "protocol end generation="
                           << endedProtocolGeneration;
@@ -536,9 +612,69 @@ void ProjectedDisplaySession::logSummary(const char* reason)
         << "focus=" << focusMode_
         << "protocol_generation=" << protocolGeneration_
         << "decoder_generation=" << activeDecoderGeneration_;
+    const VideoPresentationScheduler::Stats& presentation = scheduler_.stats();
+    if (presentation.presented > 0) {
+        qCInfo(lcAA).noquote()
+            << diagnosticPrefix_ << "presentation mode="
+            << (scheduler_.mode() == VideoPresentationScheduler::Mode::Smooth
+                    ? "smooth" : "lowest_latency")
+            << "presented=" << presentation.presented
+            << "late=" << presentation.presentedLate
+            << "dropped_late=" << presentation.droppedLate
+            << "superseded=" << presentation.droppedSuperseded
+            << "overflow=" << presentation.droppedOverflow
+            << "untimed=" << presentation.untimed
+            << "target_delay_ms=" << presentation.targetDelayUs / 1000.0;
+    }
     summaryTimer_.restart();
 }
 
+void ProjectedDisplaySession::presentDueFrame()
+{
+    const QVideoFrame frame = scheduler_.takeDue(monotonicUs(), vsyncPeriodUs_);
+    if (frame.isValid() && decoder_) {
+        if (QVideoSink* sink = decoder_->videoSink())
+            sink->setVideoFrame(frame);
+    }
+    if (scheduler_.hasPending()
+        && scheduler_.mode() == VideoPresentationScheduler::Mode::Smooth) {
+        requestVsync();
+    }
+}
+
+void ProjectedDisplaySession::requestVsync()
+{
+    QQuickWindow* window = sinkWindow();
+    if (window != vsyncWindow_) {
+        disconnect(vsyncConnection_);
+        vsyncWindow_ = window;
+        if (window) {
+            vsyncConnection_ = connect(window, &QQuickWindow::afterAnimating,
+                                       this, &ProjectedDisplaySession::presentDueFrame);
+        }
+    }
+    if (window) {
+        vsyncPeriodUs_ = refreshPeriodUs(window->screen());
+        window->update();
+        return;
+    }
+
+    if (vsyncTimer_.isActive())
+        return;
+    vsyncPeriodUs_ = refreshPeriodUs(QGuiApplication::primaryScreen());
+    const int64_t waitUs = std::clamp<int64_t>(
+        scheduler_.nextDueUs() - monotonicUs(), 0, vsyncPeriodUs_);
+    vsyncTimer_.start(static_cast<int>(waitUs / 1000));
+}
+
+QQuickWindow* ProjectedDisplaySession::sinkWindow() const
+{
+    // A QML VideoOutput owns its sink, so the sink's parent is the item.
+    QVideoSink* sink = decoder_ ? decoder_->videoSink() : nullptr;
+    auto* item = sink ? qobject_cast<QQuickItem*>(sink->parent()) : nullptr;
+    return item ? item->window() : nullptr;
+}
+
 void ProjectedDisplaySession::maybeLogFrameSummary()
 {
     if (!summaryTimer_.isValid()) {
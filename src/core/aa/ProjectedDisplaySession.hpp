@@ -5,6 +5,7 @@
 #include <QMetaObject>
 #include <QPointer>
 #include <QString>
+#include <QTimer>
 #include <QVideoSink>
 
 #include <cstdint>
@@ -15,8 +16,10 @@
 
 #include "ProjectedDisplayConfig.hpp"
 #include "VideoDecoder.hpp"
+#include "VideoPresentationScheduler.hpp"
 
 namespace oap { class YamlConfig; }
+class QQuickWindow;
 
 namespace oap::aa {
 
@@ -141,6 +144,9 @@ private:
     void logSummary(const char* reason);
     void maybeLogFrameSummary();
     QString stateName(State state) const;
+    void presentDueFrame();
+    void requestVsync();
+    QQuickWindow* sinkWindow() const;
 
     ProjectedDisplayRole role_;
     uint8_t displayId_;
@@ -173,6 +179,17 @@ private:
     QMetaObject::Connection sinkDestroyedConnection_;
     bool sinkClaimRejectionLogged_ = false;
     QElapsedTimer summaryTimer_;
+
+    // Smooth presentation is ticked by the sink's window (afterAnimating, so
+    // the frame lands in the vsync being prepared), or by a precise timer at
+    // the screen refresh period when the sink is not in a Quick window.
+    VideoPresentationScheduler scheduler_;
+    QPointer<QQuickWindow> vsyncWindow_;
+    QMetaObject::Connection vsyncConnection_;
+    QTimer vsyncTimer_;
+    int64_t vsyncPeriodUs_ = 16667;
+    MetricsRegistry::Registration jitterRegistration_;
+    MetricsRegistry::Registration latenessRegistration_;
 };
 
 } // namespace oap::aa
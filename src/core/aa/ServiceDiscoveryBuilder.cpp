@@ -1,4 +1,5 @@
 #include "ServiceDiscoveryBuilder.hpp"
+#include "VideoResolutionHelper.hpp"
 #include "../../core/YamlConfig.hpp"
 
 #include <cmath>
@@ -328,21 +329,19 @@ QByteArray ServiceDiscoveryBuilder::buildVideoDescriptor() const
     auto fpsEnum = (fps == 60) ? oaa::proto::enums::VideoFPS::_60
                                : oaa::proto::enums::VideoFPS::_30;
 
-    int remoteW = 1280, remoteH = 720;
-    if (res == "1080p") { remoteW = 1920; remoteH = 1080; }
-    else if (res == "480p") { remoteW = 800; remoteH = 480; }
+    const QSize remote = videoResolutionSize(res);
 
     // Advertise only the configured resolution with codecs from config.
     // Config populated by capability detection (Task 6) or defaults to H.264+H.265.
     using Res = oaa::proto::enums::VideoResolution;
 
-    struct ResInfo { Res::Enum res; int w; int h; const char* label; };
-    ResInfo chosen = { Res::VIDEO_1280x720, 1280, 720, "720p" };
-    if (res == "1080p") chosen = { Res::VIDEO_1920x1080, 1920, 1080, "1080p" };
-    else if (res == "480p") chosen = { Res::VIDEO_800x480, 800, 480, "480p" };
+    struct ResInfo { Res::Enum res; const char* label; };
+    ResInfo chosen = { Res::VIDEO_1280x720, "720p" };
+    if (res == "1080p") chosen = { Res::VIDEO_1920x1080, "1080p" };
+    else if (res == "480p") chosen = { Res::VIDEO_800x480, "480p" };
 
     int mW = 0, mH = 0;
-    calcMargins(chosen.w, chosen.h, mW, mH);
+    calcMargins(remote.width(), remote.height(), mW, mH);
 
     int configIdx = 0;
     const qsizetype codecCount = oaa::SessionProtocolPolicy(protocolVersion_)
@@ -496,12 +495,9 @@ QByteArray ServiceDiscoveryBuilder::buildInputDescriptor() const
         inputChannel->set_display_id(kMainDisplayId);
 
     // Touch screen config — must match content dimensions (after margins)
-    int touchW = 1280, touchH = 720;
-    if (yamlConfig_) {
-        QString res = yamlConfig_->videoResolution();
-        if (res == "1080p") { touchW = 1920; touchH = 1080; }
-        else if (res == "480p") { touchW = 800; touchH = 480; }
-    }
+    const QSize touchSize = videoResolutionSize(
+        yamlConfig_ ? yamlConfig_->videoResolution() : QString());
+    int touchW = touchSize.width(), touchH = touchSize.height();
     // Use shared viewport calculation (navbar-aware) to adjust touch dimensions
     {
         int mW = 0, mH = 0;
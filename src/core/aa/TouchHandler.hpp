@@ -8,6 +8,7 @@
 #include <chrono>
 #include <iomanip>
 #include "PerfStats.hpp"
+#include "core/MetricsRegistry.hpp"
 #include <oaa/HU/Handlers/InputChannelHandler.hpp>
 
 namespace oap {
@@ -36,7 +37,9 @@ public:
     }
 
     explicit TouchHandler(QObject* parent = nullptr)
-        : QObject(parent) {}
+        : QObject(parent)
+        , metricsRegistration_(MetricsRegistry::instance().add(
+              QStringLiteral("touch.total"), QString(), QStringLiteral("us"), &metricTotal_)) {}
 
     // Thread safety: handler_ is written once from main thread before
     // EvdevTouchReader starts, then read from the evdev thread.
@@ -88,16 +91,16 @@ public:
 
         auto t_send = PerfStats::Clock::now();
 
-        metricTotal_.record(PerfStats::msElapsed(t_start, t_send));
+        metricTotal_.record(PerfStats::usElapsed(t_start, t_send));
         ++eventsSinceLog_;
 
         double secSinceLog = PerfStats::msElapsed(lastLogTime_, t_send) / 1000.0;
         if (secSinceLog >= 5.0) {
             double eventsPerSec = eventsSinceLog_ / secSinceLog;
-            qCDebug(lcAA) << "[Perf] Touch: total=" << QString::number(metricTotal_.avg(), 'f', 1) << "ms"
-                     << "(p99~" << QString::number(metricTotal_.max, 'f', 1) << "ms)"
+            const LatencyHistogram::Snapshot total = windowTotal_.take();
+            qCDebug(lcAA).noquote() << "[Perf] Touch: total=" << QString::number(total.mean() / 1000.0, 'f', 1) << "ms"
+                     << QStringLiteral("(%1 ms)").arg(PerfStats::percentilesMs(total))
                      << "|" << QString::number(eventsPerSec, 'f', 1) << "events/sec";
-            metricTotal_.reset();
             eventsSinceLog_ = 0;
             lastLogTime_ = t_send;
         }
@@ -122,7 +125,10 @@ private:
 
     std::atomic<oaa::hu::InputChannelHandler*> handler_{nullptr};
 
-    PerfStats::Metric metricTotal_;
+    // Evdev-thread writer; the window is only touched on the same thread.
+    LatencyHistogram metricTotal_;   // sendTouchIndication() duration, us
+    LatencyWindow windowTotal_{metricTotal_};
+    MetricsRegistry::Registration metricsRegistration_;
     PerfStats::TimePoint lastLogTime_ = PerfStats::Clock::now();
     uint64_t eventsSinceLog_ = 0;
 };
@@ -1,8 +1,10 @@
 #include "VideoDecoder.hpp"
 #include "../../core/YamlConfig.hpp"
 #include "DmaBufVideoBuffer.hpp"
+#include "AVFrameVideoBuffer.hpp"
 
 #include "../Logging.hpp"
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 
@@ -14,6 +16,15 @@ std::atomic<bool> VideoDecoder::failCodecInitForTest_{false};
 VideoDecoder::VideoDecoder(QObject* parent)
     : QObject(parent)
 {
+    auto& registry = MetricsRegistry::instance();
+    const QString us = QStringLiteral("us");
+    metricsRegistrations_[0] = registry.add(QStringLiteral("video.queue"), QString(), us, &metricQueue_);
+    metricsRegistrations_[1] = registry.add(QStringLiteral("video.decode"), QString(), us, &metricDecode_);
+    metricsRegistrations_[2] = registry.add(QStringLiteral("video.copy"), QString(), us, &metricCopy_);
+    metricsRegistrations_[3] = registry.add(QStringLiteral("video.total"), QString(), us, &metricTotal_);
+    metricsRegistrations_[4] = registry.add(QStringLiteral("video.catchup_saved"), QString(), us,
+                                            &metricCatchUpSaved_);
+
     packet_ = av_packet_alloc();
     frame_ = av_frame_alloc();
 
@@ -39,6 +50,13 @@ VideoDecoder::VideoDecoder(QObject* parent)
     qCInfo(lcAA) << "Decode worker thread started";
 }
 
+void VideoDecoder::setDiagnosticLabel(const QString& label)
+{
+    diagnosticLabel_ = label;
+    for (auto& registration : metricsRegistrations_)
+        registration.setLabel(label);
+}
+
 bool VideoDecoder::isHardwareDecoder(const AVCodec* codec)
 {
     if (!codec) return false;
@@ -67,6 +85,35 @@ enum AVPixelFormat VideoDecoder::getHwFormat(
     return pix_fmts[0];
 }
 
+int VideoDecoder::sliceThreadCount(int cores, int frameHeight)
+{
+    if (frameHeight <= 0)
+        frameHeight = 720;
+    const int wanted = (frameHeight + kSliceRowsPerThread - 1) / kSliceRowsPerThread;
+    const int available = cores > 2 ? cores - 1 : 1;
+    return std::max(1, std::min(wanted, available));
+}
+
+int VideoDecoder::decodeThreadCount(const AVCodec* codec, AVCodecID codecId) const
+{
+    // Hardware decoders and the V4L2 request hwaccel do their own scheduling.
+    if (isHardwareDecoder(codec) || (codecId == AV_CODEC_ID_H265 && hwDeviceCtx_))
+        return 1;
+    if (!(codec->capabilities & AV_CODEC_CAP_SLICE_THREADS))
+        return 1;
+
+    if (yamlConfig_) {
+        if (yamlConfig_->valueByPath("video.decode_threading").toString() == QLatin1String("single"))
+            return 1;
+        const int configured = yamlConfig_->valueByPath("video.decode_threads").toInt();
+        if (configured > 0)
+            return configured;
+    }
+
+    const int height = lastFrameHeight_ > 0 ? lastFrameHeight_ : expectedFrameHeight_.load();
+    return sliceThreadCount(QThread::idealThreadCount(), height);
+}
+
 bool VideoDecoder::tryOpenCodec(const AVCodec* codec, AVCodecID codecId)
 {
     codecCtx_ = avcodec_alloc_context3(codec);
@@ -75,7 +122,12 @@ bool VideoDecoder::tryOpenCodec(const AVCodec* codec, AVCodecID codecId)
     // Low-latency settings for real-time streaming
     codecCtx_->flags |= AV_CODEC_FLAG_LOW_DELAY;
     codecCtx_->flags2 |= AV_CODEC_FLAG2_FAST;
-    codecCtx_->thread_count = 1;  // Single-threaded for immediate output (no frame reordering delay)
+    // Frame threading would delay output by one frame per thread, so only
+    // slice threading is ever enabled: it splits each frame's slices (HEVC:
+    // WPP rows/tiles) across threads and returns the frame immediately.
+    decodeThreads_ = decodeThreadCount(codec, codecId);
+    codecCtx_->thread_count = decodeThreads_;
+    codecCtx_->thread_type = decodeThreads_ > 1 ? FF_THREAD_SLICE : 0;
 
     // For HEVC software decoder with DRM device available, enable V4L2 request
     // API hwaccel.  FFmpeg's HEVC parser feeds parsed slices to rpi-hevc-dec
@@ -187,9 +239,12 @@ bool VideoDecoder::initCodec(AVCodecID codecId)
 
     usingHardware_ = isHardwareDecoder(codec_) ||
                      (codecCtx_ && codecCtx_->hw_device_ctx);
+    softwareZeroCopy_ = !yamlConfig_ ||
+        yamlConfig_->valueByPath("video.software_output").toString() != QLatin1String("copy");
     qCInfo(lcAA) << "Using" << codec_->name
             << (usingHardware_ ? "(hardware)" : "(software)")
-            << (codecCtx_->hw_device_ctx ? "[DRM hwaccel]" : "");
+            << (codecCtx_->hw_device_ctx ? "[DRM hwaccel]" : "")
+            << "threads=" << decodeThreads_;
     return true;
 }
 
@@ -302,10 +357,21 @@ void VideoDecoder::setVideoSink(QVideoSink* sink)
     }
 }
 
-void VideoDecoder::decodeFrame(std::shared_ptr<const QByteArray> h264Data, qint64 enqueueTimeNs)
+void VideoDecoder::setYamlConfig(oap::YamlConfig* config)
+{
+    yamlConfig_ = config;
+    catchUpAgeNs_ = config
+        ? qint64(std::max(0, config->valueByPath("video.catch_up_age_ms").toInt())) * 1000000
+        : 0;
+    requestKeyframes_ = config &&
+        config->valueByPath("video.catch_up_request_keyframe").toBool();
+}
+
+void VideoDecoder::decodeFrame(std::shared_ptr<const QByteArray> h264Data, qint64 enqueueTimeNs,
+                               qint64 phoneTimestampUs)
 {
     if (worker_ && acceptingFrames_.load())
-        worker_->enqueue(std::move(h264Data), enqueueTimeNs);
+        worker_->enqueue(std::move(h264Data), enqueueTimeNs, phoneTimestampUs);
 }
 
 quint64 VideoDecoder::beginStream()
@@ -344,10 +410,10 @@ void VideoDecoder::resetForNewStream(quint64 generation)
     codecDetected_ = false;
     clearBufferedFrames();
 
-    metricQueue_.reset();
-    metricDecode_.reset();
-    metricCopy_.reset();
-    metricTotal_.reset();
+    windowQueue_.reset();
+    windowDecode_.reset();
+    windowCopy_.reset();
+    windowTotal_.reset();
     frameCount_ = 0;
     framesSinceLog_ = 0;
     lastLogTime_ = PerfStats::Clock::now();
@@ -384,7 +450,8 @@ void VideoDecoder::reportStreamError(quint64 generation, const QString& message)
     emit streamError(generation, labelledMessage);
 }
 
-void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs)
+void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs,
+                                qint64 phoneTimestampUs)
 {
     if (!codecCtx_ || !parser_ || !packet_ || !frame_) return;
 
@@ -420,12 +487,16 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
     const uint8_t* data = reinterpret_cast<const uint8_t*>(h264Data.constData());
     int dataSize = h264Data.size();
 
+    // The parser carries the phone timestamp to the packet, and the decoder
+    // to frame_->pts, so it stays with its picture through any parser delay.
+    const int64_t pts = phoneTimestampUs >= 0 ? phoneTimestampUs : AV_NOPTS_VALUE;
+
     while (dataSize > 0) {
         int consumed = av_parser_parse2(
             parser_, codecCtx_,
             &packet_->data, &packet_->size,
             data, dataSize,
-            AV_NOPTS_VALUE, AV_NOPTS_VALUE, 0);
+            pts, AV_NOPTS_VALUE, 0);
 
         if (consumed < 0) {
             qCCritical(lcAA) << "Parse error";
@@ -437,6 +508,10 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
 
         if (packet_->size == 0)
             continue;
+        // The parser returns the timestamp of the input that started this
+        // packet, which is not necessarily the one just passed in.
+        packet_->pts = parser_->pts;
+        packet_->dts = parser_->dts;
 
         // Send packet to decoder
         int ret = avcodec_send_packet(codecCtx_, packet_);
@@ -499,6 +574,8 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
                 auto buffer = std::make_unique<DmaBufVideoBuffer>(
                     frame_, frame_->width, frame_->height);
                 QVideoFrame videoFrame(std::move(buffer));
+                if (frame_->pts != AV_NOPTS_VALUE)
+                    videoFrame.setStartTime(frame_->pts);
 
                 t_copyDone = PerfStats::Clock::now();
 
@@ -513,69 +590,23 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
             }
             else if (sink && (frame_->format == AV_PIX_FMT_YUV420P ||
                                frame_->format == AV_PIX_FMT_YUVJ420P)) {
-                // Create or reset frame pool on first frame or resolution change
-                if (!framePool_ ||
-                    framePool_->format().frameWidth() != frame_->width ||
-                    framePool_->format().frameHeight() != frame_->height) {
-                    QVideoFrameFormat fmt(
-                        QSize(frame_->width, frame_->height),
-                        QVideoFrameFormat::Format_YUV420P);
-                    if (framePool_) {
-                        framePool_->reset(fmt);
-                    } else {
-                        framePool_ = std::make_unique<VideoFramePool>(fmt, 5);
+                // Zero-copy: Qt gets a ref to the decoder's own buffers. The
+                // pooled copy is the configured fallback and the recovery
+                // path if the ref cannot be taken.
+                QVideoFrame videoFrame;
+                if (softwareZeroCopy_) {
+                    auto buffer = std::make_unique<AVFrameVideoBuffer>(frame_);
+                    if (buffer->isValid()) {
+                        videoFrame = QVideoFrame(std::move(buffer));
+                        ++zeroCopyFrames_;
                     }
                 }
+                if (!videoFrame.isValid())
+                    videoFrame = copyToPooledFrame();
 
-                const int w = frame_->width;
-                const int h = frame_->height;
-                const int chromaH = h / 2;
-                const int chromaW = w / 2;
-
-                // Recycled buffer path — pool manages raw memory,
-                // destructor returns it when Qt's render thread is done.
-                // Tightly packed strides (no alignment padding).
-                QVideoFrame videoFrame = framePool_->acquireRecycled();
-                // map() to get our buffer pointer (no-op internally, just returns pointers)
-                if (videoFrame.map(QVideoFrame::WriteOnly)) {
-                    uint8_t* yDst = videoFrame.bits(0);
-                    uint8_t* uDst = videoFrame.bits(1);
-                    uint8_t* vDst = videoFrame.bits(2);
-                    const int yDstStride = videoFrame.bytesPerLine(0);  // == w
-                    const int uDstStride = videoFrame.bytesPerLine(1);  // == w/2
-                    const int vDstStride = videoFrame.bytesPerLine(2);  // == w/2
-                    // Y plane — bulk copy if strides match
-                    if (yDstStride == frame_->linesize[0]) {
-                        std::memcpy(yDst, frame_->data[0], frame_->linesize[0] * h);
-                    } else {
-                        const int rowBytes = std::min(yDstStride, frame_->linesize[0]);
-                        for (int y = 0; y < h; ++y)
-                            std::memcpy(yDst + y * yDstStride,
-                                        frame_->data[0] + y * frame_->linesize[0], rowBytes);
-                    }
-
-                    // U plane
-                    if (uDstStride == frame_->linesize[1]) {
-                        std::memcpy(uDst, frame_->data[1], frame_->linesize[1] * chromaH);
-                    } else {
-                        const int rowBytes = std::min(uDstStride, frame_->linesize[1]);
-                        for (int y = 0; y < chromaH; ++y)
-                            std::memcpy(uDst + y * uDstStride,
-                                        frame_->data[1] + y * frame_->linesize[1], rowBytes);
-                    }
-
-                    // V plane
-                    if (vDstStride == frame_->linesize[2]) {
-                        std::memcpy(vDst, frame_->data[2], frame_->linesize[2] * chromaH);
-                    } else {
-                        const int rowBytes = std::min(vDstStride, frame_->linesize[2]);
-                        for (int y = 0; y < chromaH; ++y)
-                            std::memcpy(vDst + y * vDstStride,
-                                        frame_->data[2] + y * frame_->linesize[2], rowBytes);
-                    }
-
-                    videoFrame.unmap();
-
+                if (videoFrame.isValid()) {
+                    if (frame_->pts != AV_NOPTS_VALUE)
+                        videoFrame.setStartTime(frame_->pts);
                     t_copyDone = PerfStats::Clock::now();
 
                     {
@@ -595,15 +626,17 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
 
                 if (enqueueTimeNs > 0) {
                     auto t_enqueue = PerfStats::TimePoint(std::chrono::nanoseconds(enqueueTimeNs));
-                    metricQueue_.record(PerfStats::msElapsed(t_enqueue, t_decodeStart));
-                    metricTotal_.record(PerfStats::msElapsed(t_enqueue, t_display));
+                    metricQueue_.record(PerfStats::usElapsed(t_enqueue, t_decodeStart));
+                    metricTotal_.record(PerfStats::usElapsed(t_enqueue, t_display));
                 }
-                metricDecode_.record(PerfStats::msElapsed(t_decodeStart, t_decodeDone));
-                metricCopy_.record(PerfStats::msElapsed(t_decodeDone, t_copyDone));
+                metricDecode_.record(PerfStats::usElapsed(t_decodeStart, t_decodeDone));
+                metricCopy_.record(PerfStats::usElapsed(t_decodeDone, t_copyDone));
 
                 ++frameCount_;
                 ++framesSinceLog_;
 
+                lastFrameHeight_ = frame_->height;
+
                 if (frameCount_ == 1) {
                     qCInfo(lcAA) << "First frame decoded:"
                             << frame_->width << "x" << frame_->height
@@ -617,20 +650,27 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
                 if (elapsed >= LOG_INTERVAL_SEC) {
                     double fps = framesSinceLog_ / elapsed;
                     int depth = worker_ ? worker_->queueDepth() : 0;
+                    const LatencyHistogram::Snapshot queue = windowQueue_.take();
+                    const LatencyHistogram::Snapshot decode = windowDecode_.take();
+                    const LatencyHistogram::Snapshot copy = windowCopy_.take();
+                    const LatencyHistogram::Snapshot total = windowTotal_.take();
                     qCDebug(lcAA).noquote() << diagnosticLabel_ << "[Perf] Video: queue="
-                        << QString::number(metricQueue_.avg(), 'f', 1) << "ms"
-                        << "decode=" << QString::number(metricDecode_.avg(), 'f', 1) << "ms"
-                        << "copy=" << QString::number(metricCopy_.avg(), 'f', 1) << "ms"
-                        << "total=" << QString::number(metricTotal_.avg(), 'f', 1) << "ms"
-                        << "(p99\u2248" << QString::number(metricTotal_.max, 'f', 1) << "ms)"
+                        << QString::number(queue.mean() / 1000.0, 'f', 1) << "ms"
+                        << "decode=" << QString::number(decode.mean() / 1000.0, 'f', 1) << "ms"
+                        << QStringLiteral("(%1 ms, %2)").arg(PerfStats::percentilesMs(decode),
+                               decodeThreads_ > 1 ? QStringLiteral("slice x%1").arg(decodeThreads_)
+                                                  : QStringLiteral("single"))
+                        << "copy=" << QString::number(copy.mean() / 1000.0, 'f', 1) << "ms"
+                        << "total=" << QString::number(total.mean() / 1000.0, 'f', 1) << "ms"
+                        << QStringLiteral("(%1 ms)").arg(PerfStats::percentilesMs(total))
                         << "|" << QString::number(fps, 'f', 1) << "fps"
                         << (depth > 0 ? QString(" qdepth=%1").arg(depth) : "")
-                        << (framePool_ ? QString(" pool=%1/%2").arg(framePool_->totalRecycled()).arg(framePool_->totalAllocated()) : "");
+                        << (framePool_ ? QString(" pool=%1/%2").arg(framePool_->totalRecycled()).arg(framePool_->totalAllocated()) : "")
+                        << (zeroCopyFrames_ > 0 ? QString(" zerocopy=%1").arg(zeroCopyFrames_) : "")
+                        << (catchUpCount_.load() > 0
+                                ? QString(" catchup=%1/%2").arg(catchUpCount_.load()).arg(catchUpDroppedFrames_.load())
+                                : "");
 
-                    metricQueue_.reset();
-                    metricDecode_.reset();
-                    metricCopy_.reset();
-                    metricTotal_.reset();
                     framesSinceLog_ = 0;
                     lastLogTime_ = now;
                 }
@@ -642,7 +682,77 @@ void VideoDecoder::processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs
 }
 
 
-void VideoDecoder::DecodeWorker::enqueue(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs)
+QVideoFrame VideoDecoder::copyToPooledFrame()
+{
+    // Create or reset frame pool on first frame or resolution change
+    if (!framePool_ ||
+        framePool_->format().frameWidth() != frame_->width ||
+        framePool_->format().frameHeight() != frame_->height) {
+        QVideoFrameFormat fmt(
+            QSize(frame_->width, frame_->height),
+            QVideoFrameFormat::Format_YUV420P);
+        if (framePool_) {
+            framePool_->reset(fmt);
+        } else {
+            framePool_ = std::make_unique<VideoFramePool>(fmt, 5);
+        }
+    }
+
+    const int w = frame_->width;
+    const int h = frame_->height;
+    const int chromaH = h / 2;
+    const int chromaW = w / 2;
+
+    // Recycled buffer path — pool manages raw memory,
+    // destructor returns it when Qt's render thread is done.
+    // Tightly packed strides (no alignment padding).
+    QVideoFrame videoFrame = framePool_->acquireRecycled();
+    // map() to get our buffer pointer (no-op internally, just returns pointers)
+    if (videoFrame.map(QVideoFrame::WriteOnly)) {
+        uint8_t* yDst = videoFrame.bits(0);
+        uint8_t* uDst = videoFrame.bits(1);
+        uint8_t* vDst = videoFrame.bits(2);
+        const int yDstStride = videoFrame.bytesPerLine(0);  // == w
+        const int uDstStride = videoFrame.bytesPerLine(1);  // == w/2
+        const int vDstStride = videoFrame.bytesPerLine(2);  // == w/2
+        // Y plane — bulk copy if strides match
+        if (yDstStride == frame_->linesize[0]) {
+            std::memcpy(yDst, frame_->data[0], frame_->linesize[0] * h);
+        } else {
+            const int rowBytes = std::min(yDstStride, frame_->linesize[0]);
+            for (int y = 0; y < h; ++y)
+                std::memcpy(yDst + y * yDstStride,
+                            frame_->data[0] + y * frame_->linesize[0], rowBytes);
+        }
+
+        // U plane
+        if (uDstStride == frame_->linesize[1]) {
+            std::memcpy(uDst, frame_->data[1], frame_->linesize[1] * chromaH);
+        } else {
+            const int rowBytes = std::min(uDstStride, frame_->linesize[1]);
+            for (int y = 0; y < chromaH; ++y)
+                std::memcpy(uDst + y * uDstStride,
+                            frame_->data[1] + y * frame_->linesize[1], rowBytes);
+        }
+
+        // V plane
+        if (vDstStride == frame_->linesize[2]) {
+            std::memcpy(vDst, frame_->data[2], frame_->linesize[2] * chromaH);
+        } else {
+            const int rowBytes = std::min(vDstStride, frame_->linesize[2]);
+            for (int y = 0; y < chromaH; ++y)
+                std::memcpy(vDst + y * vDstStride,
+                            frame_->data[2] + y * frame_->linesize[2], rowBytes);
+        }
+
+        videoFrame.unmap();
+        return videoFrame;
+    }
+    return {};
+}
+
+void VideoDecoder::DecodeWorker::enqueue(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs,
+                                         qint64 phoneTimestampUs)
 {
     QMutexLocker locker(&mutex_);
     if (!decoder_->acceptingFrames_.load())
@@ -656,7 +766,9 @@ void VideoDecoder::DecodeWorker::enqueue(std::shared_ptr<const QByteArray> data,
     //      output when the queue is deep, reducing CPU while keeping refs intact.
     //   2. The display-side "latest-frame-wins" slot naturally discards stale
     //      decoded frames — only the newest frame is ever shown.
-    queue_.push({WorkKind::Frame, std::move(data), enqueueTimeNs, 0});
+    // The one exception is skipToKeyframe(), which drops a stale backlog only
+    // up to a keyframe, where the reference chain restarts anyway.
+    queue_.push_back({WorkKind::Frame, std::move(data), enqueueTimeNs, 0, phoneTimestampUs});
     condition_.wakeOne();
 }
 
@@ -667,16 +779,14 @@ quint64 VideoDecoder::DecodeWorker::beginStream()
     // Drop compressed frames but preserve already-ordered stream boundaries.
     // This keeps every accepted begin/end completion observable even when the
     // owner transitions again before the worker reaches the prior boundary.
-    std::queue<WorkItem> boundaries;
-    while (!queue_.empty()) {
-        WorkItem item = std::move(queue_.front());
-        queue_.pop();
+    std::deque<WorkItem> boundaries;
+    for (WorkItem& item : queue_) {
         if (item.kind != WorkKind::Frame)
-            boundaries.push(std::move(item));
+            boundaries.push_back(std::move(item));
     }
     queue_.swap(boundaries);
     const quint64 generation = ++nextGeneration_;
-    queue_.push({WorkKind::BeginStream, {}, 0, generation});
+    queue_.push_back({WorkKind::BeginStream, {}, 0, generation});
     condition_.wakeOne();
     return generation;
 }
@@ -685,15 +795,13 @@ void VideoDecoder::DecodeWorker::endStream()
 {
     QMutexLocker locker(&mutex_);
 
-    std::queue<WorkItem> boundaries;
-    while (!queue_.empty()) {
-        WorkItem item = std::move(queue_.front());
-        queue_.pop();
+    std::deque<WorkItem> boundaries;
+    for (WorkItem& item : queue_) {
         if (item.kind != WorkKind::Frame)
-            boundaries.push(std::move(item));
+            boundaries.push_back(std::move(item));
     }
     queue_.swap(boundaries);
-    queue_.push({WorkKind::EndStream, {}, 0, nextGeneration_});
+    queue_.push_back({WorkKind::EndStream, {}, 0, nextGeneration_});
     condition_.wakeOne();
 }
 
@@ -709,17 +817,31 @@ void VideoDecoder::DecodeWorker::run()
     while (true) {
         WorkItem item;
         int depth = 0;
+        bool keyframeNeeded = false;
         {
             QMutexLocker locker(&mutex_);
             while (queue_.empty() && !stopRequested_)
                 condition_.wait(&mutex_);
             if (stopRequested_ && queue_.empty())
                 return;
+            const WorkItem& front = queue_.front();
+            if (decoder_->catchUpAgeNs_ > 0 && front.kind == WorkKind::Frame
+                && front.enqueueTimeNs > 0) {
+                const qint64 nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    PerfStats::Clock::now().time_since_epoch()).count();
+                if (nowNs - front.enqueueTimeNs > decoder_->catchUpAgeNs_)
+                    keyframeNeeded = skipToKeyframe(nowNs);
+            }
             item = std::move(queue_.front());
-            queue_.pop();
+            queue_.pop_front();
             depth = static_cast<int>(queue_.size());  // remaining after pop
         }
 
+        if (keyframeNeeded) {
+            ++decoder_->keyframeRequestCount_;
+            emit decoder_->keyframeNeeded(decoder_->streamGeneration_);
+        }
+
         if (item.kind == WorkKind::BeginStream) {
             decoder_->resetForNewStream(item.generation);
             continue;
@@ -741,8 +863,120 @@ void VideoDecoder::DecodeWorker::run()
         }
 
         if (item.data)
-            decoder_->processFrame(*item.data, item.enqueueTimeNs);
+            decoder_->processFrame(*item.data, item.enqueueTimeNs, item.phoneTimestampUs);
+    }
+}
+
+uint8_t VideoDecoder::DecodeWorker::accessUnitFlags(WorkItem& item) const
+{
+    if (item.accessUnit < 0)
+        item.accessUnit = item.data ? scanAccessUnit(*item.data, decoder_->activeCodecId_) : 0;
+    return static_cast<uint8_t>(item.accessUnit);
+}
+
+bool VideoDecoder::DecodeWorker::skipToKeyframe(qint64 nowNs)
+{
+    // Until the first packet has been seen the codec, and so the NAL syntax,
+    // is not known.
+    if (!decoder_->codecDetected_)
+        return false;
+
+    // Frames up to the next stream boundary belong to the current stream.
+    size_t streamEnd = 0;
+    while (streamEnd < queue_.size() && queue_[streamEnd].kind == WorkKind::Frame)
+        ++streamEnd;
+
+    // Jump to the newest keyframe rather than the next one: everything before
+    // it is already older than the threshold would allow once it decodes.
+    size_t keyframe = 0;
+    for (size_t i = streamEnd; i-- > 1;) {
+        if (accessUnitFlags(queue_[i]) & kRandomAccess) {
+            keyframe = i;
+            break;
+        }
+    }
+
+    if (keyframe == 0) {
+        // Decoding from the head is already a clean start, and it is the
+        // keyframe a request would have produced: the frames behind it wait
+        // out the request interval like those behind a requested one.
+        if (accessUnitFlags(queue_.front()) & kRandomAccess) {
+            lastKeyframeRequestNs_ = nowNs;
+            return false;
+        }
+        if (!decoder_->requestKeyframes_
+            || (lastKeyframeRequestNs_ != 0
+                && nowNs - lastKeyframeRequestNs_ < KEYFRAME_REQUEST_INTERVAL_NS)) {
+            return false;
+        }
+        lastKeyframeRequestNs_ = nowNs;
+        return true;
+    }
+
+    // Parameter sets may arrive in their own access unit ahead of the
+    // keyframe; the keyframe cannot decode without them, so they stay. One
+    // that also carries a picture is as stale as the rest and goes.
+    const qint64 savedNs = queue_[keyframe].enqueueTimeNs - queue_.front().enqueueTimeNs;
+    size_t kept = 0;
+    for (size_t i = 0; i < keyframe; ++i) {
+        if ((accessUnitFlags(queue_[i]) & (kParameterSets | kPicture)) != kParameterSets)
+            continue;
+        if (kept != i)
+            queue_[kept] = std::move(queue_[i]);
+        ++kept;
+    }
+    const size_t dropped = keyframe - kept;
+    queue_.erase(queue_.begin() + kept, queue_.begin() + keyframe);
+
+    ++decoder_->catchUpCount_;
+    decoder_->catchUpDroppedFrames_ += dropped;
+    decoder_->metricCatchUpSaved_.record(static_cast<uint64_t>(std::max<qint64>(0, savedNs / 1000)));
+    qCInfo(lcAA).noquote() << decoder_->diagnosticLabel_
+                           << "video backlog stale, skipped" << dropped
+                           << "frames to keyframe, saved"
+                           << QString::number(savedNs / 1e6, 'f', 1) << "ms";
+    return false;
+}
+
+uint8_t VideoDecoder::scanAccessUnit(const QByteArray& data, AVCodecID codecId)
+{
+    if (codecId != AV_CODEC_ID_H264 && codecId != AV_CODEC_ID_H265)
+        return 0;
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.constData());
+    const int size = data.size();
+    uint8_t flags = 0;
+    // A 4-byte start code is a zero byte followed by the 3-byte one.
+    for (int i = 0; i + 3 < size; ++i) {
+        if (bytes[i] != 0 || bytes[i + 1] != 0 || bytes[i + 2] != 1)
+            continue;
+        const uint8_t header = bytes[i + 3];
+        i += 3;
+        if (codecId == AV_CODEC_ID_H265) {
+            const int type = (header >> 1) & 0x3f;
+            if (type >= 32 && type <= 34) {          // VPS, SPS, PPS
+                flags |= kParameterSets;
+            } else if (type < 32) {                  // first slice decides
+                flags |= kPicture;
+                // BLA_W_LP..IDR_N_LP. CRA (21) is left out: its leading
+                // pictures reference frames that would have been dropped.
+                if (type >= 16 && type <= 20)
+                    flags |= kRandomAccess;
+                return flags;
+            }
+        } else {
+            const int type = header & 0x1f;
+            if (type == 7 || type == 8) {            // SPS, PPS
+                flags |= kParameterSets;
+            } else if (type >= 1 && type <= 5) {     // first slice decides
+                flags |= kPicture;
+                if (type == 5)
+                    flags |= kRandomAccess;
+                return flags;
+            }
+        }
     }
+    return flags;
 }
 
 } // namespace aa
@@ -13,11 +13,12 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <deque>
 #include <cstdint>
 
 #include "PerfStats.hpp"
 #include "VideoFramePool.hpp"
+#include "core/MetricsRegistry.hpp"
 
 // FFmpeg C headers
 extern "C" {
@@ -44,12 +45,49 @@ public:
 
     QVideoSink* videoSink() const { return videoSink_.loadRelaxed(); }
     void setVideoSink(QVideoSink* sink);
-    void setYamlConfig(oap::YamlConfig* config) { yamlConfig_ = config; }
+    /// Call before the first stream: the catch-up settings are read here,
+    /// the codec settings at each codec init.
+    void setYamlConfig(oap::YamlConfig* config);
     /// True when construction produced a worker capable of starting streams.
     /// Unlike isOperational(), this is not cleared by a recoverable stream error.
     bool isAvailable() const { return worker_ != nullptr; }
     bool isOperational() const { return operational_.load(); }
-    void setDiagnosticLabel(const QString& label) { diagnosticLabel_ = label; }
+    /// Compressed frames waiting for the decode worker. Thread-safe.
+    int queueDepth() const { return worker_ ? worker_->queueDepth() : 0; }
+    /// Prefixes log lines and labels this decoder's entries in MetricsRegistry.
+    void setDiagnosticLabel(const QString& label);
+    /// Height the phone was asked to encode at; sizes the slice-thread pool
+    /// until a stream has decoded and its real height is known.
+    void setExpectedFrameHeight(int height) { expectedFrameHeight_.store(height); }
+
+    /// Slice-thread policy for software decode: roughly one thread per
+    /// kSliceRowsPerThread luma rows, leaving one core for the UI, audio and
+    /// protocol threads. Always 1 on one- and two-core hosts.
+    static int sliceThreadCount(int cores, int frameHeight);
+    static constexpr int kSliceRowsPerThread = 360;
+
+    /// What an Annex-B access unit carries, from the NAL headers up to its
+    /// first slice. Only H.264 and H.265 are recognised; other codecs scan as 0.
+    enum AccessUnitFlag : uint8_t {
+        /// Starts at an IDR (H.264) or IDR/BLA (H.265) picture: nothing after
+        /// it references anything before it.
+        kRandomAccess = 0x1,
+        /// Carries SPS/PPS (and VPS for H.265).
+        kParameterSets = 0x2,
+        /// Carries a slice, i.e. a picture; parameter sets without one can be
+        /// kept through a catch-up without decoding anything stale.
+        kPicture = 0x4,
+    };
+    static uint8_t scanAccessUnit(const QByteArray& data, AVCodecID codecId);
+
+    /// Times the worker skipped a stale backlog forward to a keyframe, the
+    /// compressed frames it discarded doing so, and keyframes it asked for
+    /// when no keyframe was queued. Thread-safe.
+    uint64_t catchUpCount() const { return catchUpCount_.load(); }
+    uint64_t catchUpDroppedFrames() const { return catchUpDroppedFrames_.load(); }
+    uint64_t keyframeRequestCount() const { return keyframeRequestCount_.load(); }
+    /// Queue time each catch-up removed, microseconds (video.catchup_saved).
+    const LatencyHistogram& catchUpSaved() const { return metricCatchUpSaved_; }
 
     /// Returns the latest decoded frame if available, otherwise invalid QVideoFrame
     QVideoFrame takeLatestFrame();
@@ -71,9 +109,15 @@ signals:
     void streamCodecDetected(quint64 generation, int codecId);
     void streamEnded(quint64 generation);
     void streamError(quint64 generation, const QString& message);
+    /// Emitted from the decode worker when the backlog is older than
+    /// video.catch_up_age_ms and holds no keyframe to skip to. Rate-limited.
+    void keyframeNeeded(quint64 generation);
 
 public slots:
-    void decodeFrame(std::shared_ptr<const QByteArray> h264Data, qint64 enqueueTimeNs = 0);
+    /// @p phoneTimestampUs (-1 if none) comes back as the decoded frame's
+    /// QVideoFrame::startTime().
+    void decodeFrame(std::shared_ptr<const QByteArray> h264Data, qint64 enqueueTimeNs = 0,
+                     qint64 phoneTimestampUs = -1);
 
 private:
     // Decode worker thread
@@ -81,12 +125,14 @@ private:
     public:
         explicit DecodeWorker(VideoDecoder* decoder) : decoder_(decoder) {}
         void run() override;
-        void enqueue(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs);
+        void enqueue(std::shared_ptr<const QByteArray> data, qint64 enqueueTimeNs,
+                     qint64 phoneTimestampUs);
         quint64 beginStream();
         void endStream();
         void requestStop();
         int queueDepth() const { QMutexLocker lock(&mutex_); return static_cast<int>(queue_.size()); }
     private:
+        friend class VideoDecoderTestAccess;
         VideoDecoder* decoder_;
         mutable QMutex mutex_;
         QWaitCondition condition_;
@@ -96,21 +142,34 @@ private:
             std::shared_ptr<const QByteArray> data;
             qint64 enqueueTimeNs = 0;
             quint64 generation = 0;
+            qint64 phoneTimestampUs = -1;
+            // scanAccessUnit() result, computed the first time a catch-up
+            // looks at this frame; -1 until then.
+            int16_t accessUnit = -1;
         };
-        std::queue<WorkItem> queue_;
+        /// Called with mutex_ held when the oldest queued frame is stale.
+        /// Returns true when a keyframe should be requested.
+        bool skipToKeyframe(qint64 nowNs);
+        uint8_t accessUnitFlags(WorkItem& item) const;
+        std::deque<WorkItem> queue_;
         bool stopRequested_ = false;
         quint64 nextGeneration_ = 0;
         // When queue depth exceeds this, skip non-reference frames
         // (AVDISCARD_NONREF — B-frames only) to reduce CPU.
         // Never use AVDISCARD_NONKEY — it skips P-frames and breaks refs.
         static constexpr int SKIP_THRESHOLD = 3;
+        // Minimum spacing between keyframeNeeded signals.
+        static constexpr qint64 KEYFRAME_REQUEST_INTERVAL_NS = 1000000000;
+        qint64 lastKeyframeRequestNs_ = 0;
     };
 
     DecodeWorker* worker_ = nullptr;
-    void processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs);
+    void processFrame(const QByteArray& h264Data, qint64 enqueueTimeNs, qint64 phoneTimestampUs);
     void resetForNewStream(quint64 generation);
     void finishStream(quint64 generation);
     void clearBufferedFrames();
+    /// Copy frame_ into a recycled pool frame; invalid frame if mapping fails.
+    QVideoFrame copyToPooledFrame();
     void reportStreamError(quint64 generation, const QString& message);
 
     void cleanup();
@@ -135,12 +194,24 @@ private:
     bool codecDetected_ = false;
     bool usingHardware_ = false;
     bool firstFrameDecoded_ = false;
+    // video.software_output: hand software frames to Qt by AVFrame ref
+    // (zero_copy) instead of copying them into framePool_ (copy).
+    bool softwareZeroCopy_ = true;
+    // Threads the open codec decodes with; >1 only with FF_THREAD_SLICE.
+    int decodeThreads_ = 1;
+    int lastFrameHeight_ = 0;
+    std::atomic<int> expectedFrameHeight_{720};
+    // video.catch_up_age_ms: queue age that triggers a skip to the newest
+    // queued keyframe; 0 disables. Read in setYamlConfig(), used by the worker.
+    qint64 catchUpAgeNs_ = 0;
+    bool requestKeyframes_ = false;
     quint64 streamGeneration_ = 0;
     oap::YamlConfig* yamlConfig_ = nullptr;
 
     bool initCodec(AVCodecID codecId);
     bool initializeCodec(AVCodecID codecId);
     bool tryOpenCodec(const AVCodec* codec, AVCodecID codecId);
+    int decodeThreadCount(const AVCodec* codec, AVCodecID codecId) const;
     void cleanupCodec();
     AVCodecID detectCodec(const QByteArray& data) const;
     static bool isHardwareDecoder(const AVCodec* codec);
@@ -155,13 +226,24 @@ private:
     static std::atomic<bool> failCodecInitForTest_;
     QString diagnosticLabel_;
 
-    // Performance instrumentation
-    PerfStats::Metric metricQueue_;    // signal emit → decode start
-    PerfStats::Metric metricDecode_;   // decode start → avcodec_receive_frame
-    PerfStats::Metric metricCopy_;     // receive_frame → copy done
-    PerfStats::Metric metricTotal_;    // signal emit → setVideoFrame
+    // Performance instrumentation, microseconds. Recorded on the decode
+    // worker, which also logs the 5 s windows; registered as video.* metrics.
+    LatencyHistogram metricQueue_;    // signal emit → decode start
+    LatencyHistogram metricDecode_;   // decode start → avcodec_receive_frame
+    LatencyHistogram metricCopy_;     // receive_frame → copy done
+    LatencyHistogram metricTotal_;    // signal emit → setVideoFrame
+    LatencyWindow windowQueue_{metricQueue_};
+    LatencyWindow windowDecode_{metricDecode_};
+    LatencyWindow windowCopy_{metricCopy_};
+    LatencyWindow windowTotal_{metricTotal_};
+    LatencyHistogram metricCatchUpSaved_;  // front-of-queue age a catch-up removed
+    MetricsRegistry::Registration metricsRegistrations_[5];
     PerfStats::TimePoint lastLogTime_ = PerfStats::Clock::now();
     uint64_t framesSinceLog_ = 0;
+    uint64_t zeroCopyFrames_ = 0;
+    std::atomic<uint64_t> catchUpCount_{0};
+    std::atomic<uint64_t> catchUpDroppedFrames_{0};
+    std::atomic<uint64_t> keyframeRequestCount_{0};
     static constexpr double LOG_INTERVAL_SEC = 5.0;
 
     // Frame pool — owns the cached format and allocates QVideoFrames
@@ -0,0 +1,84 @@
+#include "VideoPresentationScheduler.hpp"
+
+#include <algorithm>
+
+namespace oap {
+namespace aa {
+
+void VideoPresentationScheduler::reset()
+{
+    queue_.clear();
+    transit_.reset();
+    stats_.targetDelayUs = 0;
+}
+
+void VideoPresentationScheduler::push(QVideoFrame frame, int64_t readyUs)
+{
+    const bool timed = frame.startTime() >= 0;
+    int64_t dueUs = mapDue(frame.startTime(), readyUs);
+    if (timed) {
+        // Keep presentation order even when the target delay shrinks.
+        if (!queue_.empty())
+            dueUs = std::max(dueUs, queue_.back().dueUs);
+    } else {
+        // An untimed frame is due when ready and never waits behind timed
+        // ones: those queued ahead become due with it and it supersedes them.
+        for (Pending& pending : queue_)
+            pending.dueUs = std::min(pending.dueUs, dueUs);
+    }
+
+    if (queue_.size() >= kMaxQueued) {
+        queue_.pop_front();
+        ++stats_.droppedOverflow;
+    }
+    queue_.push_back({std::move(frame), dueUs});
+}
+
+QVideoFrame VideoPresentationScheduler::takeDue(int64_t vsyncUs, int64_t periodUs)
+{
+    const int64_t halfPeriodUs = periodUs / 2;
+    QVideoFrame out;
+    int64_t outDueUs = 0;
+    bool have = false;
+
+    while (!queue_.empty()
+           && (mode_ == Mode::LowestLatency || queue_.front().dueUs <= vsyncUs + halfPeriodUs)) {
+        if (have) {
+            if (mode_ == Mode::Smooth && outDueUs < vsyncUs - halfPeriodUs)
+                ++stats_.droppedLate;
+            else
+                ++stats_.droppedSuperseded;
+        }
+        out = std::move(queue_.front().frame);
+        outDueUs = queue_.front().dueUs;
+        have = true;
+        queue_.pop_front();
+    }
+
+    if (have) {
+        ++stats_.presented;
+        const int64_t lateUs = vsyncUs - outDueUs;
+        lateness_.record(lateUs > 0 ? uint64_t(lateUs) : 0);
+        if (periodUs > 0 && lateUs >= periodUs)
+            ++stats_.presentedLate;
+    }
+    return out;
+}
+
+int64_t VideoPresentationScheduler::mapDue(int64_t ptsUs, int64_t readyUs)
+{
+    if (ptsUs < 0) {
+        ++stats_.untimed;
+        return readyUs;
+    }
+
+    const TransitJitterEstimator::Observation observation = transit_.observe(ptsUs, readyUs);
+    jitter_.record(uint64_t(observation.jitterUs));
+    if (observation.retarget)
+        stats_.targetDelayUs = std::min(transit_.recentP95Us(), maxDelayUs_);
+
+    return ptsUs + transit_.offsetUs() + (mode_ == Mode::Smooth ? stats_.targetDelayUs : 0);
+}
+
+} // namespace aa
+} // namespace oap
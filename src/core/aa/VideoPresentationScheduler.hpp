@@ -0,0 +1,103 @@
+#pragma once
+
+#include <QVideoFrame>
+
+#include <cstdint>
+#include <deque>
+
+#include "core/LatencyHistogram.hpp"
+#include "core/TransitJitterEstimator.hpp"
+
+namespace oap {
+namespace aa {
+
+/// Decides which decoded frame a projected display shows at each vsync.
+///
+/// Frames carry the phone's AV_MEDIA_WITH_TIMESTAMP value (microseconds) as
+/// QVideoFrame::startTime(). TransitJitterEstimator maps that clock onto the
+/// local monotonic clock from (ready, pts) pairs; how far a frame lands above
+/// the mapping is its jitter.
+///
+/// LowestLatency shows the newest decoded frame at the next vsync; older
+/// frames still waiting are dropped as superseded. This is the
+/// latest-frame-wins behaviour the display always had. Smooth holds each
+/// frame until its mapped phone time plus an adaptive delay (the recent p95
+/// jitter, capped at maxDelayUs), so frames keep the phone's cadence when
+/// arrival is bursty. A frame whose vsync has already passed when a newer
+/// one is due is dropped as late. Frames without a timestamp are shown as
+/// soon as they are ready in both modes, superseding any timed frames still
+/// queued ahead of them.
+///
+/// Single-threaded: owned and driven by the display session's thread.
+class VideoPresentationScheduler {
+public:
+    enum class Mode {
+        LowestLatency,
+        Smooth,
+    };
+
+    struct Stats {
+        uint64_t presented = 0;
+        /// Presented at least one vsync period after their due time.
+        uint64_t presentedLate = 0;
+        /// Missed their vsync and were replaced by a newer due frame.
+        uint64_t droppedLate = 0;
+        /// Replaced before their vsync by a newer frame (more frames than
+        /// vsyncs, or LowestLatency catching up).
+        uint64_t droppedSuperseded = 0;
+        /// Pushed out unshown because kMaxQueued frames were already waiting.
+        uint64_t droppedOverflow = 0;
+        /// Frames without a phone timestamp.
+        uint64_t untimed = 0;
+        int64_t targetDelayUs = 0;
+    };
+
+    static constexpr int64_t kDefaultMaxDelayUs = 60000;
+    /// Decoded frames hold decoder buffers; beyond this the oldest is dropped.
+    static constexpr size_t kMaxQueued = 8;
+
+    void setMode(Mode mode) { mode_ = mode; }
+    Mode mode() const { return mode_; }
+    void setMaxDelayUs(int64_t maxDelayUs) { maxDelayUs_ = maxDelayUs > 0 ? maxDelayUs : 0; }
+
+    /// Forget queued frames and the clock mapping, e.g. on a new stream.
+    /// Statistics and histograms are kept.
+    void reset();
+
+    /// Queue a decoded frame that became ready at local time @p readyUs.
+    void push(QVideoFrame frame, int64_t readyUs);
+
+    /// The frame to hand to the sink for the vsync at @p vsyncUs, or an
+    /// invalid frame to keep showing the current one.
+    QVideoFrame takeDue(int64_t vsyncUs, int64_t periodUs);
+
+    bool hasPending() const { return !queue_.empty(); }
+    /// Local time the oldest queued frame becomes due, or -1 if none.
+    int64_t nextDueUs() const { return queue_.empty() ? -1 : queue_.front().dueUs; }
+
+    const Stats& stats() const { return stats_; }
+    /// Per-frame jitter above the clock mapping, microseconds.
+    const LatencyHistogram& jitter() const { return jitter_; }
+    /// How far past its due time each presented frame was shown, microseconds.
+    const LatencyHistogram& lateness() const { return lateness_; }
+
+private:
+    struct Pending {
+        QVideoFrame frame;
+        int64_t dueUs = 0;
+    };
+
+    int64_t mapDue(int64_t ptsUs, int64_t readyUs);
+
+    Mode mode_ = Mode::LowestLatency;
+    int64_t maxDelayUs_ = kDefaultMaxDelayUs;
+    std::deque<Pending> queue_;
+    TransitJitterEstimator transit_;
+
+    Stats stats_;
+    LatencyHistogram jitter_;
+    LatencyHistogram lateness_;
+};
+
+} // namespace aa
+} // namespace oap
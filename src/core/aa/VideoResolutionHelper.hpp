@@ -0,0 +1,19 @@
+#pragma once
+
+#include <QSize>
+#include <QString>
+
+namespace oap {
+namespace aa {
+
+/// Encoded frame size for the main display's video.resolution setting.
+/// Anything other than "1080p" or "480p" is the 720p default.
+inline QSize videoResolutionSize(const QString& resolution)
+{
+    if (resolution == QLatin1String("1080p")) return {1920, 1080};
+    if (resolution == QLatin1String("480p")) return {800, 480};
+    return {1280, 720};
+}
+
+} // namespace aa
+} // namespace oap
@@ -8,6 +8,8 @@
 
 #include <optional>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace pb = prodigy::api::v1;
 namespace data = oap::data;
@@ -15,6 +17,11 @@ namespace data = oap::data;
 namespace oap::api {
 namespace {
 
+// History replies: the bucket count when the query names none, and the cap
+// on points or buckets in one response.
+constexpr int kDefaultHistoryPoints = 240;
+constexpr int kMaxHistoryPoints = data::HistoryRing::kMaxQueryPoints;
+
 data::ProviderDefinition fromProto(const pb::DataProviderDefinition& source) {
     data::ProviderDefinition result;
     result.providerNamespace = QString::fromStdString(source.provider_namespace());
@@ -72,6 +79,8 @@ data::ChannelDefinition fromProto(const pb::DataChannelDefinition& source) {
         result.enumOptions.append(
             {option.value(), QString::fromStdString(option.label())});
     }
+    if (source.has_history_retention_ms())
+        result.historyRetentionMs = source.history_retention_ms();
     return result;
 }
 
@@ -105,6 +114,22 @@ void toProto(const data::ChannelDefinition& source,
         output->set_value(option.value);
         output->set_label(option.label.toStdString());
     }
+    if (source.historyRetentionMs)
+        target->set_history_retention_ms(*source.historyRetentionMs);
+}
+
+void toProto(const data::HistoryPoint& source, pb::DataHistoryPoint* target) {
+    target->set_observed_at_unix_ms(source.observedAtUnixMs);
+    if (!std::isnan(source.value)) target->set_value(source.value);
+}
+
+void toProto(const data::HistoryBucket& source, pb::DataHistoryBucket* target) {
+    target->set_start_unix_ms(source.startUnixMs);
+    target->set_end_unix_ms(source.endUnixMs);
+    target->set_minimum(source.minimum);
+    target->set_maximum(source.maximum);
+    target->set_last(source.last);
+    target->set_count(source.count);
 }
 
 void toProto(const data::Catalog& source, pb::DataCatalog* target) {
@@ -184,6 +209,15 @@ data::ChannelRef fromProto(const pb::DataChannelRef& source) {
             QString::fromStdString(source.channel_name())};
 }
 
+DataDeliveryOptions fromProto(const pb::DataSubscriptionOptions& source) {
+    DataDeliveryOptions result;
+    result.minIntervalMs = source.min_interval_ms();
+    if (std::isfinite(source.min_delta()) && source.min_delta() > 0.0)
+        result.minDelta = source.min_delta();
+    result.latestOnly = source.latest_only();
+    return result;
+}
+
 std::optional<data::Quality> fromProto(pb::DataQuality quality) {
     switch (quality) {
     case pb::DATA_QUALITY_UNSPECIFIED: return data::Quality::Unknown;
@@ -238,12 +272,37 @@ bool isServerOnlyDataPayload(pb::ApiMessage::PayloadCase payload) {
     case pb::ApiMessage::kDataValuesEvent:
     case pb::ApiMessage::kDataCatalogEvent:
     case pb::ApiMessage::kDataChannelAvailabilityEvent:
+    case pb::ApiMessage::kQueryDataHistoryResponse:
         return true;
     default:
         return false;
     }
 }
 
+pb::ApiMessage catalogEvent(const data::Catalog& catalog) {
+    pb::ApiMessage message;
+    toProto(catalog, message.mutable_data_catalog_event()->mutable_catalog());
+    return message;
+}
+
+pb::ApiMessage valuesEvent(const QString& providerNamespace,
+                           const QList<data::Sample>& samples) {
+    pb::ApiMessage message;
+    auto* event = message.mutable_data_values_event();
+    event->set_provider_namespace(providerNamespace.toStdString());
+    for (const data::Sample& sample : samples)
+        toProto(sample, event->add_samples());
+    return message;
+}
+
+// Fan-out events carry request_id 0, so one serialization serves every
+// recipient.
+ApiFrame eventFrame(const pb::ApiMessage& message) {
+    std::string bytes;
+    message.SerializeToString(&bytes);
+    return ApiFrame::fromPayload(QByteArray::fromStdString(bytes));
+}
+
 } // namespace
 
 ApiDataBridge::ApiDataBridge(data::DataRegistry* registry, QObject* parent)
@@ -263,6 +322,10 @@ ApiDataBridge::ApiDataBridge(data::DataRegistry* registry, QObject* parent)
             });
     connect(registry_, &data::DataRegistry::valuesAccepted,
             this, &ApiDataBridge::fanOutValues);
+    clock_.start();
+    heldValuesTimer_.setSingleShot(true);
+    connect(&heldValuesTimer_, &QTimer::timeout,
+            this, &ApiDataBridge::flushHeldValues);
 }
 
 data::OwnerToken ApiDataBridge::ownerToken(ApiSession* session) {
@@ -310,6 +373,10 @@ bool ApiDataBridge::handleRequest(ApiSession* session, quint64 requestId,
         if (requireRequestId(session, requestId))
             handleUnsubscribe(session, requestId, message);
         return true;
+    case pb::ApiMessage::kQueryDataHistoryRequest:
+        if (requireRequestId(session, requestId))
+            handleQueryHistory(session, requestId, message);
+        return true;
     default:
         if (!isServerOnlyDataPayload(message.payload_case())) return false;
         session->closeWithError(requestId, pb::ERROR_CODE_INVALID_REQUEST,
@@ -433,10 +500,7 @@ void ApiDataBridge::handleWatchCatalog(ApiSession* session, quint64 requestId,
 
 void ApiDataBridge::sendCatalogEvent(ApiSession* session,
                                      const data::Catalog& catalog) {
-    PbMessage event;
-    toProto(catalog,
-            event.mutable_data_catalog_event()->mutable_catalog());
-    session->sendMessage(0, event);
+    session->sendMessage(0, catalogEvent(catalog));
 }
 
 void ApiDataBridge::fanOutCatalog(const data::Catalog& catalog) {
@@ -454,11 +518,13 @@ void ApiDataBridge::fanOutCatalog(const data::Catalog& catalog) {
                 destinations.append(QPointer<ApiSession>(it.key()));
         }
 
+        std::optional<ApiFrame> frame;
         for (const QPointer<ApiSession>& session : destinations) {
             if (!session || session->state() != ApiSession::State::Ready) continue;
             const auto state = sessions_.constFind(session.data());
             if (state == sessions_.cend() || !state->watchesCatalog) continue;
-            sendCatalogEvent(session.data(), catalog);
+            if (!frame) frame = eventFrame(catalogEvent(catalog));
+            session->sendFrame(*frame);
         }
     }
     catalogFanOutActive_ = false;
@@ -470,6 +536,8 @@ void ApiDataBridge::handleSubscribe(ApiSession* session, quint64 requestId,
     PbMessage response;
     auto* payload = response.mutable_subscribe_data_channels_response();
     SessionState& state = sessions_[session];
+    const DataDeliveryOptions options =
+        fromProto(message.subscribe_data_channels_request().options());
     for (const pb::DataChannelRef& source :
          message.subscribe_data_channels_request().channels()) {
         const data::ChannelRef ref = fromProto(source);
@@ -483,6 +551,11 @@ void ApiDataBridge::handleSubscribe(ApiSession* session, quint64 requestId,
             continue;
         }
         state.subscriptions.insert(ref);
+        if (options.shapes())
+            state.deliveryOptions.insert(ref, options);
+        else
+            state.deliveryOptions.remove(ref);
+        state.gates.remove(ref);
         accepted.append(ref);
     }
 
@@ -500,8 +573,12 @@ void ApiDataBridge::handleSubscribe(ApiSession* session, quint64 requestId,
         if (!guarded || guarded->state() != ApiSession::State::Ready) return;
         if (!boundary.available) continue;
         const std::optional<data::Sample> retained = registry_->latestSample(ref);
-        if (retained)
-            sendValues(guarded.data(), ref.providerNamespace, {*retained});
+        if (!retained) continue;
+        stateIt = sessions_.find(guarded.data());
+        if (stateIt == sessions_.end()) continue;
+        if (DataDeliveryGate* gate = gateFor(*stateIt, ref))
+            gate->delivered(*retained, clock_.elapsed());
+        sendValues(guarded.data(), ref.providerNamespace, {*retained});
     }
 }
 
@@ -514,6 +591,8 @@ void ApiDataBridge::handleUnsubscribe(ApiSession* session, quint64 requestId,
             const data::ChannelRef ref = fromProto(source);
             state->subscriptions.remove(ref);
             state->lastAvailability.remove(ref);
+            state->deliveryOptions.remove(ref);
+            state->gates.remove(ref);
         }
     }
     PbMessage response;
@@ -521,6 +600,51 @@ void ApiDataBridge::handleUnsubscribe(ApiSession* session, quint64 requestId,
     session->sendMessage(requestId, response);
 }
 
+void ApiDataBridge::handleQueryHistory(ApiSession* session, quint64 requestId,
+                                       const PbMessage& message) {
+    const pb::QueryDataHistoryRequest& request = message.query_data_history_request();
+    PbMessage response;
+    auto* payload = response.mutable_query_data_history_response();
+    const data::ChannelRef ref = fromProto(request.channel());
+    const data::HistoryRing* history = registry_->history(ref);
+    const qint64 fromUnixMs = request.has_from_unix_ms()
+        ? request.from_unix_ms() : std::numeric_limits<qint64>::min();
+    const qint64 toUnixMs = request.has_to_unix_ms()
+        ? request.to_unix_ms() : std::numeric_limits<qint64>::max();
+    const int maxPoints = request.max_points() == 0
+        ? kDefaultHistoryPoints
+        : int(qMin<quint32>(request.max_points(), kMaxHistoryPoints));
+
+    if (!registry_->definition(ref)) {
+        payload->set_reason("channel not declared");
+    } else if (!history) {
+        payload->set_reason("channel keeps no history");
+    } else if (request.mode() == pb::DATA_HISTORY_MODE_MIN_MAX) {
+        payload->set_accepted(true);
+        for (const data::HistoryBucket& bucket :
+             history->buckets(fromUnixMs, toUnixMs, maxPoints)) {
+            toProto(bucket, payload->add_buckets());
+        }
+    } else if (request.mode() == pb::DATA_HISTORY_MODE_DECIMATED) {
+        payload->set_accepted(true);
+        for (const data::HistoryPoint& point :
+             history->decimated(fromUnixMs, toUnixMs, maxPoints)) {
+            toProto(point, payload->add_points());
+        }
+    } else if (request.mode() == pb::DATA_HISTORY_MODE_RAW) {
+        payload->set_accepted(true);
+        const QList<data::HistoryPoint> points =
+            history->range(fromUnixMs, toUnixMs, kMaxHistoryPoints);
+        payload->set_truncated(history->count(fromUnixMs, toUnixMs) > points.size());
+        for (const data::HistoryPoint& point : points)
+            toProto(point, payload->add_points());
+    } else {
+        payload->set_reason("unsupported history mode");
+    }
+    if (history) payload->set_capacity(quint32(history->capacity()));
+    session->sendMessage(requestId, response);
+}
+
 ApiDataBridge::AvailabilityBoundary ApiDataBridge::currentBoundary(
     const data::ChannelRef& ref) const {
     AvailabilityBoundary result;
@@ -541,6 +665,12 @@ ApiDataBridge::AvailabilityBoundary ApiDataBridge::currentBoundary(
 void ApiDataBridge::sendAvailability(
     ApiSession* session, const data::ChannelRef& ref,
     const AvailabilityBoundary& boundary, quint64 revision) {
+    session->sendMessage(0, availabilityEvent(ref, boundary, revision));
+}
+
+ApiDataBridge::PbMessage ApiDataBridge::availabilityEvent(
+    const data::ChannelRef& ref, const AvailabilityBoundary& boundary,
+    quint64 revision) {
     PbMessage message;
     auto* event = message.mutable_data_channel_availability_event();
     toProto(ref, event->mutable_channel());
@@ -553,19 +683,14 @@ void ApiDataBridge::sendAvailability(
         event->set_availability(pb::DATA_CHANNEL_AVAILABILITY_UNAVAILABLE);
         event->set_unavailable_reason(toProto(boundary.reason));
     }
-    session->sendMessage(0, message);
+    return message;
 }
 
 void ApiDataBridge::sendValues(ApiSession* session,
                                const QString& providerNamespace,
                                const QList<data::Sample>& samples) {
     if (samples.isEmpty()) return;
-    PbMessage message;
-    auto* event = message.mutable_data_values_event();
-    event->set_provider_namespace(providerNamespace.toStdString());
-    for (const data::Sample& sample : samples)
-        toProto(sample, event->add_samples());
-    session->sendMessage(0, message);
+    session->sendMessage(0, valuesEvent(providerNamespace, samples));
 }
 
 void ApiDataBridge::reconcileAvailability() {
@@ -622,6 +747,7 @@ void ApiDataBridge::fanOutAvailability(
                 destinations.append(QPointer<ApiSession>(state.key()));
         }
 
+        std::optional<ApiFrame> frame;
         for (const QPointer<ApiSession>& session : destinations) {
             if (!session || session->state() != ApiSession::State::Ready) continue;
             auto state = sessions_.find(session.data());
@@ -635,8 +761,12 @@ void ApiDataBridge::fanOutAvailability(
                 continue;
             }
             state->lastAvailability.insert(work.ref, work.boundary);
-            sendAvailability(session.data(), work.ref, work.boundary,
-                             work.revision);
+            state->gates.remove(work.ref);
+            if (!frame) {
+                frame = eventFrame(
+                    availabilityEvent(work.ref, work.boundary, work.revision));
+            }
+            session->sendFrame(*frame);
         }
     }
     availabilityFanOutActive_ = false;
@@ -644,6 +774,30 @@ void ApiDataBridge::fanOutAvailability(
 
 void ApiDataBridge::fanOutValues(
     const QString& providerNamespace, const QList<data::Sample>& samples) {
+    // Each destination's share of the batch, as a mask over samples, after
+    // its delivery gates. Sessions with the same mask get the same event,
+    // serialized once.
+    const qint64 nowMs = clock_.elapsed();
+    qint64 heldDueMs = -1;
+    auto deliveryMask = [&](SessionState& state) {
+        QByteArray mask(samples.size(), '\0');
+        bool any = false;
+        for (qsizetype i = 0; i < samples.size(); ++i) {
+            const data::ChannelRef ref{providerNamespace, samples.at(i).channelName};
+            if (!state.subscriptions.contains(ref)) continue;
+            if (DataDeliveryGate* gate = gateFor(state, ref)) {
+                const bool now = gate->offer(samples.at(i), nowMs);
+                const qint64 dueAtMs = gate->dueAtMs();
+                if (dueAtMs >= 0 && (heldDueMs < 0 || dueAtMs < heldDueMs))
+                    heldDueMs = dueAtMs;
+                if (!now) continue;
+            }
+            mask[i] = 1;
+            any = true;
+        }
+        return any ? mask : QByteArray();
+    };
+
     QList<QPointer<ApiSession>> destinations;
     for (auto state = sessions_.cbegin(); state != sessions_.cend(); ++state) {
         bool interested = false;
@@ -657,20 +811,75 @@ void ApiDataBridge::fanOutValues(
         if (interested) destinations.append(QPointer<ApiSession>(state.key()));
     }
 
+    QHash<QByteArray, ApiFrame> frames;
     for (const QPointer<ApiSession>& session : destinations) {
         if (!session || session->state() != ApiSession::State::Ready) continue;
-        const auto state = sessions_.constFind(session.data());
-        if (state == sessions_.cend()) continue;
-        QList<data::Sample> filtered;
-        for (const data::Sample& sample : samples) {
-            if (state->subscriptions.contains(
-                    {providerNamespace, sample.channelName})) {
-                filtered.append(sample);
+        const auto state = sessions_.find(session.data());
+        if (state == sessions_.end()) continue;
+        const QByteArray mask = deliveryMask(*state);
+        if (mask.isEmpty()) continue;
+        auto frame = frames.find(mask);
+        if (frame == frames.end()) {
+            QList<data::Sample> filtered;
+            for (qsizetype i = 0; i < samples.size(); ++i)
+                if (mask.at(i)) filtered.append(samples.at(i));
+            frame = frames.insert(
+                mask, eventFrame(valuesEvent(providerNamespace, filtered)));
+        }
+        session->sendFrame(*frame);
+    }
+    if (heldDueMs >= 0) scheduleHeldValues(heldDueMs);
+}
+
+DataDeliveryGate* ApiDataBridge::gateFor(SessionState& state,
+                                         const data::ChannelRef& ref) {
+    const auto options = state.deliveryOptions.constFind(ref);
+    if (options == state.deliveryOptions.cend()) return nullptr;
+    auto gate = state.gates.find(ref);
+    if (gate == state.gates.end())
+        gate = state.gates.insert(ref, DataDeliveryGate(*options, registry_->definition(ref)));
+    return &gate.value();
+}
+
+void ApiDataBridge::scheduleHeldValues(qint64 dueAtMs) {
+    if (heldValuesTimer_.isActive() && heldValuesDueMs_ <= dueAtMs) return;
+    heldValuesDueMs_ = dueAtMs;
+    heldValuesTimer_.start(int(qMax<qint64>(0, dueAtMs - clock_.elapsed())));
+}
+
+void ApiDataBridge::flushHeldValues() {
+    const qint64 nowMs = clock_.elapsed();
+    heldValuesDueMs_ = -1;
+    qint64 nextDueMs = -1;
+
+    QList<QPointer<ApiSession>> destinations;
+    for (auto state = sessions_.cbegin(); state != sessions_.cend(); ++state)
+        if (!state->gates.isEmpty())
+            destinations.append(QPointer<ApiSession>(state.key()));
+
+    for (const QPointer<ApiSession>& session : destinations) {
+        if (!session || session->state() != ApiSession::State::Ready) continue;
+        auto state = sessions_.find(session.data());
+        if (state == sessions_.end()) continue;
+        // Held samples go out per provider, in one event each.
+        QHash<QString, QList<data::Sample>> due;
+        QStringList order;
+        for (auto gate = state->gates.begin(); gate != state->gates.end(); ++gate) {
+            if (std::optional<data::Sample> sample = gate->takeDue(nowMs)) {
+                const QString& providerNamespace = gate.key().providerNamespace;
+                if (!due.contains(providerNamespace)) order.append(providerNamespace);
+                due[providerNamespace].append(std::move(*sample));
             }
+            const qint64 dueAtMs = gate->dueAtMs();
+            if (dueAtMs >= 0 && (nextDueMs < 0 || dueAtMs < nextDueMs))
+                nextDueMs = dueAtMs;
+        }
+        for (const QString& providerNamespace : order) {
+            if (!session || session->state() != ApiSession::State::Ready) break;
+            sendValues(session.data(), providerNamespace, due.value(providerNamespace));
         }
-        if (!filtered.isEmpty())
-            sendValues(session.data(), providerNamespace, filtered);
     }
+    if (nextDueMs >= 0) scheduleHeldValues(nextDueMs);
 }
 
 void ApiDataBridge::sessionClosed(ApiSession* session) {
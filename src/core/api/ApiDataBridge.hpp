@@ -5,12 +5,15 @@
 // owns per-session consumer state, and serializes direct request/event replies.
 // Main thread only.
 
+#include <QElapsedTimer>
 #include <QHash>
 #include <QList>
 #include <QObject>
 #include <QSet>
+#include <QTimer>
 
 #include "api/api.pb.h"
+#include "core/api/ApiDataDelivery.hpp"
 #include "core/services/DataRegistry.hpp"
 
 #include <optional>
@@ -49,6 +52,11 @@ private:
         QHash<oap::data::ChannelRef, AvailabilityBoundary> lastAvailability;
         bool watchesCatalog = false;
         QString providerNamespace;
+        // Shaped subscriptions only. A gate is built from the channel's
+        // current definition on first use and dropped at every availability
+        // change.
+        QHash<oap::data::ChannelRef, DataDeliveryOptions> deliveryOptions;
+        QHash<oap::data::ChannelRef, DataDeliveryGate> gates;
     };
 
     struct AvailabilityWork {
@@ -75,6 +83,8 @@ private:
                          const PbMessage& message);
     void handleUnsubscribe(ApiSession* session, quint64 requestId,
                            const PbMessage& message);
+    void handleQueryHistory(ApiSession* session, quint64 requestId,
+                            const PbMessage& message);
     void sendCatalogEvent(ApiSession* session,
                           const oap::data::Catalog& catalog);
     void fanOutCatalog(const oap::data::Catalog& catalog);
@@ -84,6 +94,9 @@ private:
                           quint64 revision);
     void sendValues(ApiSession* session, const QString& providerNamespace,
                     const QList<oap::data::Sample>& samples);
+    static PbMessage availabilityEvent(const oap::data::ChannelRef& ref,
+                                       const AvailabilityBoundary& boundary,
+                                       quint64 revision);
     AvailabilityBoundary currentBoundary(
         const oap::data::ChannelRef& ref) const;
     void reconcileAvailability();
@@ -92,6 +105,10 @@ private:
                             quint64 revision);
     void fanOutValues(const QString& providerNamespace,
                       const QList<oap::data::Sample>& samples);
+    DataDeliveryGate* gateFor(SessionState& state,
+                              const oap::data::ChannelRef& ref);
+    void scheduleHeldValues(qint64 dueAtMs);
+    void flushHeldValues();
 
     static oap::data::OwnerToken ownerToken(ApiSession* session);
 
@@ -101,6 +118,9 @@ private:
     bool catalogFanOutActive_ = false;
     QList<AvailabilityWork> pendingAvailability_;
     bool availabilityFanOutActive_ = false;
+    QElapsedTimer clock_;
+    QTimer heldValuesTimer_;
+    qint64 heldValuesDueMs_ = -1;
 };
 
 } // namespace oap::api
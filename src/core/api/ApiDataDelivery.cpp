@@ -0,0 +1,83 @@
+#include "core/api/ApiDataDelivery.hpp"
+
+#include <cmath>
+
+namespace oap::api {
+
+namespace data = oap::data;
+
+namespace {
+
+std::optional<double> numeric(const std::optional<data::Scalar>& value) {
+    if (!value) return std::nullopt;
+    if (const auto* real = std::get_if<double>(&*value)) return *real;
+    if (const auto* integer = std::get_if<qint64>(&*value)) return double(*integer);
+    if (const auto* unsignedInteger = std::get_if<quint64>(&*value))
+        return double(*unsignedInteger);
+    return std::nullopt;
+}
+
+} // namespace
+
+DataDeliveryGate::DataDeliveryGate(
+    const DataDeliveryOptions& options,
+    const std::optional<data::ChannelDefinition>& definition)
+    : intervalMs_(options.minIntervalMs),
+      minDelta_(options.minDelta > 0.0 ? options.minDelta : 0.0),
+      latestOnly_(options.latestOnly) {
+    if (!definition) return;
+    if (intervalMs_ == 0 && latestOnly_ && definition->nominalIntervalMs)
+        intervalMs_ = *definition->nominalIntervalMs;
+    if (definition->staleAfterMs && *definition->staleAfterMs > 0) {
+        refreshMs_ = qMax<qint64>(1, *definition->staleAfterMs / 2);
+        // Never throttle a subscriber into seeing the channel go stale.
+        if (intervalMs_ > refreshMs_) intervalMs_ = refreshMs_;
+    }
+}
+
+bool DataDeliveryGate::withinDelta(const data::Sample& sample,
+                                   qint64 nowMs) const {
+    if (minDelta_ <= 0.0 || !lastSent_) return false;
+    if (sample.quality != lastSent_->quality) return false;
+    if (refreshMs_ > 0 && nowMs - lastSentMs_ >= refreshMs_) return false;
+    const std::optional<double> value = numeric(sample.value);
+    const std::optional<double> last = numeric(lastSent_->value);
+    return value && last && std::fabs(*value - *last) < minDelta_;
+}
+
+bool DataDeliveryGate::offer(const data::Sample& sample, qint64 nowMs) {
+    if (withinDelta(sample, nowMs)) {
+        // The subscriber's view is already close to this value; anything
+        // held from before is older news.
+        held_.reset();
+        return false;
+    }
+    // A quality change is news the subscriber must not wait an interval for.
+    const bool qualityChanged = lastSent_ && sample.quality != lastSent_->quality;
+    if (!qualityChanged && intervalMs_ > 0 && lastSentMs_ >= 0
+        && nowMs - lastSentMs_ < intervalMs_) {
+        if (latestOnly_) held_ = sample;
+        return false;
+    }
+    delivered(sample, nowMs);
+    return true;
+}
+
+void DataDeliveryGate::delivered(const data::Sample& sample, qint64 nowMs) {
+    lastSent_ = sample;
+    lastSentMs_ = nowMs;
+    held_.reset();
+}
+
+std::optional<data::Sample> DataDeliveryGate::takeDue(qint64 nowMs) {
+    if (!held_ || nowMs < dueAtMs()) return std::nullopt;
+    std::optional<data::Sample> due = std::move(held_);
+    delivered(*due, nowMs);
+    return due;
+}
+
+qint64 DataDeliveryGate::dueAtMs() const {
+    return held_ ? lastSentMs_ + intervalMs_ : -1;
+}
+
+} // namespace oap::api
@@ -0,0 +1,67 @@
+#pragma once
+
+// ApiDataDelivery — per-subscriber shaping of one data channel's samples
+// (DataSubscriptionOptions in proto/api/data.proto). Pure logic on a caller-
+// supplied monotonic clock; ApiDataBridge owns one gate per shaped
+// subscription and a timer for held samples.
+
+#include <QtGlobal>
+
+#include "core/services/DataRegistry.hpp"
+
+#include <optional>
+
+namespace oap::api {
+
+struct DataDeliveryOptions {
+    quint32 minIntervalMs = 0;
+    double minDelta = 0.0;
+    bool latestOnly = false;
+
+    bool shapes() const { return minIntervalMs > 0 || minDelta > 0.0 || latestOnly; }
+
+    friend bool operator==(const DataDeliveryOptions& left,
+                           const DataDeliveryOptions& right) {
+        return left.minIntervalMs == right.minIntervalMs
+            && left.minDelta == right.minDelta
+            && left.latestOnly == right.latestOnly;
+    }
+};
+
+// Decides, sample by sample, what one subscriber receives from one channel.
+// The channel's hints set the defaults: latestOnly without an interval
+// coalesces to nominalIntervalMs, and staleAfterMs caps suppression so the
+// subscriber hears from the channel at least every staleAfterMs / 2. A
+// change of quality from the last delivered sample always goes out at once.
+class DataDeliveryGate {
+public:
+    DataDeliveryGate() = default;
+    DataDeliveryGate(const DataDeliveryOptions& options,
+                     const std::optional<oap::data::ChannelDefinition>& definition);
+
+    // True when the sample goes out now. Otherwise it was dropped, or held
+    // for takeDue() when latestOnly is set.
+    bool offer(const oap::data::Sample& sample, qint64 nowMs);
+    // Records a sample sent outside offer() (the retained snapshot).
+    void delivered(const oap::data::Sample& sample, qint64 nowMs);
+    // The held sample, once its interval has ended.
+    std::optional<oap::data::Sample> takeDue(qint64 nowMs);
+    // When takeDue() will yield, or -1 with nothing held.
+    qint64 dueAtMs() const;
+
+    qint64 intervalMs() const { return intervalMs_; }
+
+private:
+    bool withinDelta(const oap::data::Sample& sample, qint64 nowMs) const;
+
+    qint64 intervalMs_ = 0;
+    double minDelta_ = 0.0;
+    bool latestOnly_ = false;
+    qint64 refreshMs_ = 0;
+
+    std::optional<oap::data::Sample> lastSent_;
+    qint64 lastSentMs_ = -1;
+    std::optional<oap::data::Sample> held_;
+};
+
+} // namespace oap::api
@@ -16,24 +16,52 @@ QByteArray ApiFramer::encode(const QByteArray& payload) {
     return out;
 }
 
+ApiFrame ApiFrame::fromPayload(const QByteArray& payload, int topic) {
+    return ApiFrame{payload, ApiFramer::encode(payload), topic};
+}
+
 QList<QByteArray> ApiFramer::feed(const QByteArray& chunk) {
     QList<QByteArray> frames;
-    if (violated_) return frames;
+    append(chunk);
+    QByteArrayView frame;
+    while (next(frame))
+        frames.append(frame.toByteArray());
+    return frames;
+}
+
+void ApiFramer::append(const QByteArray& chunk) {
+    if (violated_) return;
+    if (head_ == buffer_.size()) {
+        // Everything consumed: adopt the chunk by reference.
+        buffer_ = chunk;
+        head_ = 0;
+        return;
+    }
+    // Moving the tail down costs no more than the bytes already consumed.
+    if (head_ * 2 >= buffer_.size()) {
+        buffer_.remove(0, head_);
+        head_ = 0;
+    }
     buffer_.append(chunk);
-    while (buffer_.size() >= 4) {
-        const auto* d = reinterpret_cast<const unsigned char*>(buffer_.constData());
-        const quint32 len = (quint32(d[0]) << 24) | (quint32(d[1]) << 16)
-                          | (quint32(d[2]) << 8) | quint32(d[3]);
-        if (len == 0 || len > maxFrameBytes_) {
-            violated_ = true;
-            buffer_.clear();
-            return frames;
-        }
-        if (quint32(buffer_.size()) < 4 + len) break;
-        frames.append(buffer_.mid(4, len));
-        buffer_.remove(0, 4 + int(len));
+}
+
+bool ApiFramer::next(QByteArrayView& frame) {
+    if (violated_) return false;
+    const qsizetype available = buffer_.size() - head_;
+    if (available < 4) return false;
+    const auto* d = reinterpret_cast<const unsigned char*>(buffer_.constData()) + head_;
+    const quint32 len = (quint32(d[0]) << 24) | (quint32(d[1]) << 16)
+                      | (quint32(d[2]) << 8) | quint32(d[3]);
+    if (len == 0 || len > maxFrameBytes_) {
+        violated_ = true;
+        buffer_.clear();
+        head_ = 0;
+        return false;
     }
-    return frames;
+    if (quint64(available) < 4 + quint64(len)) return false;
+    frame = QByteArrayView(buffer_.constData() + head_ + 4, qsizetype(len));
+    head_ += 4 + qsizetype(len);
+    return true;
 }
 
 bool ApiFramer::violated() const { return violated_; }
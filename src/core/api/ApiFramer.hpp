@@ -1,20 +1,45 @@
 #pragma once
 
 #include <QByteArray>
+#include <QByteArrayView>
 #include <QList>
 #include <QtGlobal>
 
 namespace oap::api {
 
+// One outbound message, serialized once and shared by every session that
+// sends it. QByteArray is implicitly shared, so copying a frame bumps
+// reference counts instead of copying bytes. The length-prefixed TCP form is
+// built with it, so N TCP sessions write the same buffer instead of framing
+// N copies. topic tags status frames (prodigy::api::v1::Topic) so delivery
+// can gate on subscriptions without parsing; 0 for untagged frames.
+struct ApiFrame {
+    QByteArray payload;   // serialized ApiMessage; the WebSocket message body
+    QByteArray framed;    // ApiFramer::encode(payload)
+    int topic = 0;
+
+    static ApiFrame fromPayload(const QByteArray& payload, int topic = 0);
+};
+
+// Splits a length-prefixed byte stream into frames. Consumed bytes are
+// skipped with a read cursor rather than removed, and the buffer is compacted
+// only once the consumed prefix outweighs what is left, so a read carrying
+// many small frames costs time linear in its size.
 class ApiFramer {
 public:
     explicit ApiFramer(quint32 maxFrameBytes = 262144);
     QList<QByteArray> feed(const QByteArray& chunk);
+    // Zero-copy form of feed(): append() buffers a read, then next() yields
+    // each complete frame as a view into the buffer. A view stays valid until
+    // the next append().
+    void append(const QByteArray& chunk);
+    bool next(QByteArrayView& frame);
     bool violated() const;
     static QByteArray encode(const QByteArray& payload);
 
 private:
     QByteArray buffer_;
+    qsizetype head_ = 0;   // start of the first unconsumed byte in buffer_
     quint32 maxFrameBytes_;
     bool violated_ = false;
 };
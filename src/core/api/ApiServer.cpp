@@ -329,6 +329,9 @@ void ApiServer::wirePublisher(TopicPublisher* pub) {
     publishers_.append(pub);
     connect(pub, &TopicPublisher::statusReady, this,
             [this](pb::Topic topic, const QByteArray& bytes) {
+        // Serialized once by the publisher and framed once here; every
+        // subscriber writes the same shared buffer.
+        const ApiFrame frame = ApiFrame::fromPayload(bytes, topic);
         // Iterate a COPY: deliver() may tear a slow session down, whose
         // terminated() handler mutates sessions_ mid-fan-out. A torn-down
         // session lingers (deleteLater) so its pointer stays valid this turn,
@@ -337,7 +340,7 @@ void ApiServer::wirePublisher(TopicPublisher* pub) {
         const QList<ApiSession*> targets = sessions_;
         for (ApiSession* s : targets)
             if (s->state() == ApiSession::State::Ready && s->subscribedTo(topic))
-                s->deliver(bytes);
+                s->deliver(frame);
     });
 }
 
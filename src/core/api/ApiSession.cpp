@@ -331,6 +331,16 @@ void ApiSession::forwardToSink(const pb::ApiMessage& m) {
 
 // ---- Outbound status delivery ----------------------------------------------
 
+void ApiSession::deliver(const ApiFrame& frame) {
+    if (state_ != State::Ready) return;
+
+    const auto t = static_cast<pb::Topic>(frame.topic);
+    if (t == pb::TOPIC_UNSPECIFIED || !subscribedTo(t))
+        return;
+
+    writeOrTeardown(frame);
+}
+
 void ApiSession::deliver(const QByteArray& envelopeBytes) {
     if (state_ != State::Ready) return;
 
@@ -338,11 +348,11 @@ void ApiSession::deliver(const QByteArray& envelopeBytes) {
     if (!m.ParseFromArray(envelopeBytes.constData(), envelopeBytes.size()))
         return;
 
-    pb::Topic t = topicForPayload(m.payload_case());
-    if (t == pb::TOPIC_UNSPECIFIED || !subscribedTo(t))
-        return;
+    deliver(ApiFrame::fromPayload(envelopeBytes, topicForPayload(m.payload_case())));
+}
 
-    writeOrTeardown(envelopeBytes);
+void ApiSession::sendFrame(const ApiFrame& frame) {
+    writeOrTeardown(frame);
 }
 
 // ---- Writes ----------------------------------------------------------------
@@ -354,14 +364,23 @@ void ApiSession::sendMessage(quint64 requestId, pb::ApiMessage msg) {
     writeOrTeardown(QByteArray::fromStdString(bytes));
 }
 
-void ApiSession::writeOrTeardown(const QByteArray& bytes) {
-    if (tornDown_ || !transport_) return;
-    if (transport_->bytesToWrite() + static_cast<qint64>(bytes.size())
-            > deps_.maxQueueBytes) {
+bool ApiSession::admitWrite(qint64 size) {
+    if (tornDown_ || !transport_) return false;
+    if (transport_->bytesToWrite() + size > deps_.maxQueueBytes) {
         teardown(CloseMode::Discard);   // slow consumer — disconnect NOW,
-        return;                          // never wait behind its full buffer
+        return false;                    // never wait behind its full buffer
     }
-    transport_->sendMessage(bytes);
+    return true;
+}
+
+void ApiSession::writeOrTeardown(const QByteArray& bytes) {
+    if (admitWrite(bytes.size()))
+        transport_->sendMessage(bytes);
+}
+
+void ApiSession::writeOrTeardown(const ApiFrame& frame) {
+    if (admitWrite(frame.payload.size()))
+        transport_->sendFrame(frame);
 }
 
 void ApiSession::sendRaw(const pb::ApiMessage& msg) {
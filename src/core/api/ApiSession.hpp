@@ -24,6 +24,7 @@
 #include <optional>
 
 #include "api/api.pb.h"
+#include "core/api/ApiFramer.hpp"
 
 class QTimer;
 
@@ -78,7 +79,14 @@ public:
     QString peerHost() const;    // transport peer address, "" if no transport
     bool subscribedTo(prodigy::api::v1::Topic t) const;
 
-    void deliver(const QByteArray& envelopeBytes);           // enforces queue cap
+    // Status fan-out. The frame's topic tag gates delivery on this session's
+    // subscriptions; the bytes are shared with every other recipient.
+    void deliver(const ApiFrame& frame);                     // enforces queue cap
+    // Untagged form: parses the envelope once to find its topic.
+    void deliver(const QByteArray& envelopeBytes);
+    // A server-initiated event (request_id 0) serialized once for several
+    // sessions. Not subscription-gated; enforces the queue cap.
+    void sendFrame(const ApiFrame& frame);
     void sendMessage(quint64 requestId, prodigy::api::v1::ApiMessage msg);
     void closeWithError(quint64 requestId, prodigy::api::v1::ErrorCode code,
                         const QString& text);
@@ -125,6 +133,10 @@ private:
     // Low-level writes. writeOrTeardown enforces the queue cap; sendRaw is a
     // best-effort terminal write (Error / AuthReject) that never re-tears-down.
     void writeOrTeardown(const QByteArray& bytes);
+    void writeOrTeardown(const ApiFrame& frame);
+    // The cap check both writeOrTeardown overloads share: false (after a
+    // Discard teardown if over the cap) when @p size bytes must not be queued.
+    bool admitWrite(qint64 size);
     void sendRaw(const prodigy::api::v1::ApiMessage& msg);
 
     bool trusted() const;
@@ -18,6 +18,10 @@ void TcpApiTransport::sendMessage(const QByteArray& serialized) {
     socket_->write(ApiFramer::encode(serialized));
 }
 
+void TcpApiTransport::sendFrame(const ApiFrame& frame) {
+    socket_->write(frame.framed);
+}
+
 qint64 TcpApiTransport::bytesToWrite() const {
     return socket_->bytesToWrite();
 }
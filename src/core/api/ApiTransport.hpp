@@ -22,6 +22,9 @@ public:
     ~IApiTransport() override = default;
 
     virtual void sendMessage(const QByteArray& serialized) = 0;
+    // Shared fan-out path: the frame is already serialized (and, for TCP,
+    // already length-prefixed). The default sends the payload.
+    virtual void sendFrame(const ApiFrame& frame) { sendMessage(frame.payload); }
     virtual qint64 bytesToWrite() const = 0;
     // Graceful: pending frames (e.g. a terminal Error) reach the wire first.
     virtual void close() = 0;
@@ -43,6 +46,7 @@ public:
     TcpApiTransport(QTcpSocket* socket, quint32 maxFrameBytes, QObject* parent = nullptr);
 
     void sendMessage(const QByteArray& serialized) override;
+    void sendFrame(const ApiFrame& frame) override;
     qint64 bytesToWrite() const override;
     void close() override;
     void abort() override;
@@ -0,0 +1,249 @@
+#include "AudioJitterBuffer.hpp"
+
+#include "AudioRingBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oap {
+
+namespace {
+
+uint32_t framesForMs(int sampleRate, int ms)
+{
+    return static_cast<uint32_t>(int64_t(sampleRate) * ms / 1000);
+}
+
+} // namespace
+
+AudioJitterBuffer::AudioJitterBuffer(AudioRingBuffer& ring, int sampleRate, int channels,
+                                     int minDelayMs, int maxDelayMs)
+    : ring_(ring)
+    , sampleRate_(sampleRate > 0 ? sampleRate : 48000)
+    , channels_(channels > 0 ? channels : 1)
+    , bytesPerFrame_(static_cast<uint32_t>(channels_) * sizeof(int16_t))
+    , minDelayUs_(int64_t(std::max(minDelayMs, 0)) * 1000)
+    , maxDelayUs_(int64_t(std::max(maxDelayMs, std::max(minDelayMs, 0))) * 1000)
+    , concealFrames_(std::max<uint32_t>(framesForMs(sampleRate_, kConcealMs), 1))
+    , fadeFrames_(std::max<uint32_t>(framesForMs(sampleRate_, kFadeMs), 1))
+    , trimSlackFrames_(framesForMs(sampleRate_, kTrimSlackMs))
+    , history_(size_t(concealFrames_) * channels_, 0)
+{
+    setTargetUs(minDelayUs_);
+}
+
+// ---- Producer ----
+
+uint32_t AudioJitterBuffer::push(const uint8_t* data, uint32_t size, uint64_t timestampUs,
+                                 int64_t arrivalUs)
+{
+    const uint32_t whole = size - size % bytesPerFrame_;
+    if (!data || whole == 0)
+        return 0;
+
+    const int64_t packetUs = int64_t(whole / bytesPerFrame_) * 1000000 / sampleRate_;
+    int64_t ptsUs = static_cast<int64_t>(timestampUs);
+    if (timestampUs == 0)
+        ptsUs = haveNextPts_ ? nextPtsUs_ : arrivalUs;
+    nextPtsUs_ = ptsUs + packetUs;
+    haveNextPts_ = true;
+
+    observe(ptsUs, arrivalUs, packetUs);
+    return ring_.write(data, whole);
+}
+
+void AudioJitterBuffer::observe(int64_t ptsUs, int64_t arrivalUs, int64_t packetUs)
+{
+    packetUs_ = packetUs;
+    sourceClock_.add(arrivalUs, ptsUs);
+    sourceDriftPpm_.store(static_cast<float>(sourceClock_.ppm()), std::memory_order_relaxed);
+    sourceDriftValid_.store(sourceClock_.valid(), std::memory_order_relaxed);
+
+    const TransitJitterEstimator::Observation observation = transit_.observe(ptsUs, arrivalUs);
+    jitter_.record(uint64_t(observation.jitterUs));
+
+    // Fast attack: this packet alone says the buffer must be deeper.
+    const int64_t neededUs = observation.jitterUs + packetUs_ + kGuardUs;
+    if (neededUs > targetUs_)
+        setTargetUs(neededUs);
+    if (observation.retarget)
+        retarget();
+}
+
+void AudioJitterBuffer::retarget()
+{
+    const int64_t wantedUs = transit_.recentP95Us() + packetUs_ + kGuardUs;
+    // Slow release: close a quarter of the gap per retarget, so one quiet
+    // stretch does not drop the delay just before the next burst.
+    if (wantedUs < targetUs_)
+        setTargetUs(targetUs_ - (targetUs_ - wantedUs) / 4);
+    else
+        setTargetUs(wantedUs);
+}
+
+void AudioJitterBuffer::setTargetUs(int64_t targetUs)
+{
+    targetUs_ = std::clamp(targetUs, minDelayUs_, maxDelayUs_);
+    // Leave half the ring as headroom for bursts above the target.
+    const uint32_t ringFrames = ring_.capacity() / bytesPerFrame_;
+    const uint32_t frames = static_cast<uint32_t>(targetUs_ * sampleRate_ / 1000000);
+    targetFrames_.store(std::min(frames, ringFrames / 2), std::memory_order_relaxed);
+}
+
+// ---- Consumer ----
+
+uint32_t AudioJitterBuffer::availableFrames() const
+{
+    return ring_.available() / bytesPerFrame_;
+}
+
+uint32_t AudioJitterBuffer::pull(int16_t* out, uint32_t frames)
+{
+    const size_t channels = static_cast<size_t>(channels_);
+    uint32_t produced = 0;
+    uint32_t fromRing = 0;
+
+    if (state_ == State::Playing && fadeInLeft_ == 0 && fadeOutLeft_ == 0
+        && availableFrames() > 2 * targetFrames() + trimSlackFrames_) {
+        fadeOutLeft_ = fadeFrames_;
+    }
+
+    while (produced < frames) {
+        int16_t* dst = out + produced * channels;
+        const uint32_t want = frames - produced;
+        switch (state_) {
+        case State::Buffering:
+            if (availableFrames() >= std::max<uint32_t>(targetFrames(), 1)) {
+                state_ = State::Playing;
+                fadeInLeft_ = fadeFrames_;
+                break;
+            }
+            std::memset(dst, 0, size_t(want) * bytesPerFrame_);
+            produced = frames;
+            break;
+
+        case State::Concealing: {
+            const uint32_t count = std::min(want, concealFrames_ - concealPos_);
+            conceal(dst, count);
+            produced += count;
+            if (concealPos_ >= concealFrames_) {
+                state_ = State::Buffering;
+                historyFrames_ = 0;
+            }
+            break;
+        }
+
+        case State::Playing: {
+            const uint32_t chunk = fadeOutLeft_ > 0 ? std::min(want, fadeOutLeft_) : want;
+            const uint32_t got = ring_.read(reinterpret_cast<uint8_t*>(dst),
+                                            chunk * bytesPerFrame_) / bytesPerFrame_;
+            const bool trimming = fadeOutLeft_ > 0;
+            shape(dst, got);
+            remember(dst, got);
+            produced += got;
+            fromRing += got;
+
+            if (got < chunk) {
+                state_ = State::Concealing;
+                concealPos_ = 0;
+                fadeInLeft_ = 0;
+                fadeOutLeft_ = 0;
+                concealEvents_.fetch_add(1, std::memory_order_relaxed);
+            } else if (trimming && fadeOutLeft_ == 0) {
+                // Faded to zero: drop the backlog down to the target and
+                // fade back in from there.
+                const uint32_t available = availableFrames();
+                const uint32_t target = targetFrames();
+                if (available > target) {
+                    const uint32_t skipped =
+                        ring_.skip((available - target) * bytesPerFrame_) / bytesPerFrame_;
+                    trimmedFrames_.fetch_add(skipped, std::memory_order_relaxed);
+                }
+                trims_.fetch_add(1, std::memory_order_relaxed);
+                fadeInLeft_ = fadeFrames_;
+            }
+            break;
+        }
+        }
+    }
+    return fromRing;
+}
+
+void AudioJitterBuffer::shape(int16_t* frames, uint32_t count)
+{
+    const size_t channels = static_cast<size_t>(channels_);
+    const float scale = 1.0f / static_cast<float>(fadeFrames_);
+    for (uint32_t f = 0; f < count && (fadeInLeft_ > 0 || fadeOutLeft_ > 0); ++f) {
+        float gain;
+        if (fadeInLeft_ > 0)
+            gain = 1.0f - static_cast<float>(fadeInLeft_--) * scale;
+        else
+            gain = static_cast<float>(--fadeOutLeft_) * scale;
+        int16_t* frame = frames + f * channels;
+        for (size_t c = 0; c < channels; ++c)
+            frame[c] = static_cast<int16_t>(frame[c] * gain);
+    }
+}
+
+void AudioJitterBuffer::remember(const int16_t* frames, uint32_t count)
+{
+    const size_t channels = static_cast<size_t>(channels_);
+    if (count >= concealFrames_) {
+        std::memcpy(history_.data(), frames + size_t(count - concealFrames_) * channels,
+                    size_t(concealFrames_) * bytesPerFrame_);
+        historyFrames_ = concealFrames_;
+        return;
+    }
+    const uint32_t keep = std::min(historyFrames_, concealFrames_ - count);
+    std::memmove(history_.data(), history_.data() + size_t(historyFrames_ - keep) * channels,
+                 size_t(keep) * bytesPerFrame_);
+    std::memcpy(history_.data() + size_t(keep) * channels, frames, size_t(count) * bytesPerFrame_);
+    historyFrames_ = keep + count;
+}
+
+void AudioJitterBuffer::conceal(int16_t* out, uint32_t count)
+{
+    const size_t channels = static_cast<size_t>(channels_);
+    const float scale = 1.0f / static_cast<float>(concealFrames_);
+    for (uint32_t f = 0; f < count; ++f, ++concealPos_) {
+        int16_t* frame = out + f * channels;
+        if (historyFrames_ == 0) {
+            std::memset(frame, 0, bytesPerFrame_);
+            continue;
+        }
+        // Ping-pong through the history starting at its newest frame.
+        const uint32_t pos = concealPos_ % (2 * historyFrames_);
+        const uint32_t src = pos < historyFrames_ ? historyFrames_ - 1 - pos : pos - historyFrames_;
+        const float gain = static_cast<float>(concealFrames_ - concealPos_ - 1) * scale;
+        const int16_t* from = history_.data() + size_t(src) * channels;
+        for (size_t c = 0; c < channels; ++c)
+            frame[c] = static_cast<int16_t>(from[c] * gain);
+    }
+    concealedFrames_.fetch_add(count, std::memory_order_relaxed);
+}
+
+// ---- Any thread ----
+
+int64_t AudioJitterBuffer::targetDelayUs() const
+{
+    return int64_t(targetFrames()) * 1000000 / sampleRate_;
+}
+
+bool AudioJitterBuffer::sourceDrift(double& ppm) const
+{
+    ppm = sourceDriftPpm_.load(std::memory_order_relaxed);
+    return sourceDriftValid_.load(std::memory_order_relaxed);
+}
+
+AudioJitterBuffer::Stats AudioJitterBuffer::takeStats()
+{
+    Stats stats;
+    stats.concealEvents = concealEvents_.exchange(0, std::memory_order_relaxed);
+    stats.concealedFrames = concealedFrames_.exchange(0, std::memory_order_relaxed);
+    stats.trims = trims_.exchange(0, std::memory_order_relaxed);
+    stats.trimmedFrames = trimmedFrames_.exchange(0, std::memory_order_relaxed);
+    stats.jitter = jitterWindow_.take();
+    return stats;
+}
+
+} // namespace oap
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "ClockDriftEstimator.hpp"
+#include "core/LatencyHistogram.hpp"
+#include "core/TransitJitterEstimator.hpp"
+
+namespace oap {
+
+class AudioRingBuffer;
+
+/// Adaptive jitter buffer in front of a playback stream's ring, for sources
+/// that deliver timestamped packets over the network (AA audio channels).
+///
+/// Producer side (the one thread that writes packets): push() writes whole
+/// frames to the ring and measures how late each packet arrived against its
+/// media timestamp with TransitJitterEstimator, as VideoPresentationScheduler
+/// does for frames. The target delay is the recent p95 jitter plus one packet
+/// and a guard quantum, clamped to [minDelayMs, maxDelayMs] and to half the
+/// ring. A single late packet raises it at once. At each retarget hint it
+/// moves toward the recent p95 again, closing a quarter of the gap when it
+/// has to drop.
+/// The same (arrival, pts) pairs give the source clock's drift against the
+/// local clock, which the rate controller feeds forward.
+///
+/// Consumer side (PW RT thread): pull() always fills the requested frames.
+/// It outputs silence until the ring holds the target (Buffering), then
+/// plays with a short fade-in. When the ring runs dry mid-period, the gap
+/// is concealed: the last kConcealMs of output play backwards from the
+/// break, so the waveform stays continuous, under a linear fade to zero.
+/// After that the buffer refills to the target. A backlog of more than
+/// twice the target plus kTrimSlackMs (a burst after a stall) is faded out,
+/// dropped back to the target and faded in, instead of being played late.
+/// pull() never allocates or locks.
+class AudioJitterBuffer {
+public:
+    static constexpr int kConcealMs = 20;
+    static constexpr int kFadeMs = 5;
+    static constexpr int kTrimSlackMs = 60;
+    /// Room for one PipeWire quantum on top of jitter and packet size.
+    static constexpr int64_t kGuardUs = 10000;
+
+    enum class State : uint8_t { Buffering, Playing, Concealing };
+
+    struct Stats {
+        uint64_t concealEvents = 0;
+        uint64_t concealedFrames = 0;
+        uint64_t trims = 0;
+        uint64_t trimmedFrames = 0;
+        LatencyHistogram::Snapshot jitter;
+    };
+
+    /// @p ring carries interleaved int16 frames and must outlive the buffer.
+    /// Allocates the concealment history; call before the stream connects.
+    AudioJitterBuffer(AudioRingBuffer& ring, int sampleRate, int channels,
+                      int minDelayMs, int maxDelayMs);
+
+    // ---- Producer thread ----
+
+    /// Write one packet that arrived at local time @p arrivalUs. A zero
+    /// @p timestampUs continues the previous packet's timeline. Returns the
+    /// bytes written; a trailing partial frame is not written.
+    uint32_t push(const uint8_t* data, uint32_t size, uint64_t timestampUs, int64_t arrivalUs);
+
+    /// Arrival jitter above the clock mapping, microseconds.
+    const LatencyHistogram& jitter() const { return jitter_; }
+
+    // ---- PW RT thread ----
+
+    /// Fill @p frames interleaved frames at @p out. Returns how many came
+    /// from the ring; the rest is concealment or silence.
+    uint32_t pull(int16_t* out, uint32_t frames);
+
+    State state() const { return state_; }
+
+    // ---- Any thread ----
+
+    uint32_t targetFrames() const { return targetFrames_.load(std::memory_order_relaxed); }
+    int64_t targetDelayUs() const;
+    /// Source sample clock against the local steady clock, ppm; false until
+    /// ClockDriftEstimator has enough history.
+    bool sourceDrift(double& ppm) const;
+    /// Counters and jitter since the previous call (diagnostic timer only).
+    Stats takeStats();
+
+private:
+    uint32_t availableFrames() const;
+    void shape(int16_t* frames, uint32_t count);
+    void remember(const int16_t* frames, uint32_t count);
+    void conceal(int16_t* out, uint32_t count);
+    void observe(int64_t ptsUs, int64_t arrivalUs, int64_t packetUs);
+    void retarget();
+    void setTargetUs(int64_t targetUs);
+
+    AudioRingBuffer& ring_;
+    const int sampleRate_;
+    const int channels_;
+    const uint32_t bytesPerFrame_;
+    const int64_t minDelayUs_;
+    const int64_t maxDelayUs_;
+    const uint32_t concealFrames_;
+    const uint32_t fadeFrames_;
+    const uint32_t trimSlackFrames_;
+
+    // Producer.
+    bool haveNextPts_ = false;
+    int64_t nextPtsUs_ = 0;
+    int64_t packetUs_ = 0;
+    int64_t targetUs_ = 0;
+    TransitJitterEstimator transit_;
+    LatencyHistogram jitter_;
+    LatencyWindow jitterWindow_{jitter_};
+    ClockDriftEstimator sourceClock_;
+
+    std::atomic<uint32_t> targetFrames_{0};
+    std::atomic<bool> sourceDriftValid_{false};
+    std::atomic<float> sourceDriftPpm_{0.0f};
+
+    // Consumer.
+    State state_ = State::Buffering;
+    uint32_t fadeInLeft_ = 0;
+    uint32_t fadeOutLeft_ = 0;
+    uint32_t concealPos_ = 0;
+    std::vector<int16_t> history_;
+    uint32_t historyFrames_ = 0;
+
+    std::atomic<uint64_t> concealEvents_{0};
+    std::atomic<uint64_t> concealedFrames_{0};
+    std::atomic<uint64_t> trims_{0};
+    std::atomic<uint64_t> trimmedFrames_{0};
+};
+
+} // namespace oap
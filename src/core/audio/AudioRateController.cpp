@@ -0,0 +1,88 @@
+#include "AudioRateController.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oap {
+
+AudioRateController::AudioRateController(int sampleRate)
+    : sampleRate_(sampleRate > 0 ? sampleRate : 48000)
+{
+}
+
+bool AudioRateController::process(const Input& input, Update& update)
+{
+    // With the resampler at rate_, the graph consumed frames / rate_ of its
+    // own frames for the ones handed over.
+    if (input.frames > 0) {
+        graphPositionUs_ += double(input.frames) / rate_ * 1e6 / double(sampleRate_);
+        graphClock_.add(input.nowUs, static_cast<int64_t>(graphPositionUs_));
+    }
+
+    const float msPerFrame = 1000.0f / static_cast<float>(sampleRate_);
+    const float targetMs = static_cast<float>(input.targetFrames) * msPerFrame;
+    if (!filterPrimed_) {
+        filterPrimed_ = true;
+        filteredMs_ = targetMs;
+    }
+    if (input.hadData)
+        ++activeCallbacks_;
+    const float bufferedMs = static_cast<float>(input.bufferedFrames) * msPerFrame;
+    filteredMs_ += kFillAlpha * (bufferedMs - filteredMs_);
+
+    if (++callbacks_ < kUpdateInterval)
+        return false;
+    callbacks_ = 0;
+    const bool active = activeCallbacks_ > 0;
+    activeCallbacks_ = 0;
+    const int64_t elapsedUs = lastUpdateUs_ != 0 ? input.nowUs - lastUpdateUs_ : 0;
+    lastUpdateUs_ = input.nowUs;
+
+    update = Update{};
+    if (!active) {
+        resetLoop(targetMs);
+        rate_ = 1.0;
+        return true;
+    }
+    if (activeSinceUs_ < 0)
+        activeSinceUs_ = input.nowUs;
+
+    const double errorMs = double(filteredMs_) - double(targetMs);
+    integralPpm_ = std::clamp(integralPpm_ + kIntegralPpmPerMsS * errorMs * double(elapsedUs) / 1e6,
+                              -kMaxIntegralPpm, kMaxIntegralPpm);
+
+    double driftPpm = 0.0;
+    if (input.sourceDriftValid && graphClock_.valid()) {
+        driftPpm = std::clamp(input.sourceDriftPpm - graphClock_.ppm(),
+                              -kMaxDriftPpm, kMaxDriftPpm);
+    }
+    const double correctionPpm = std::clamp(
+        driftPpm + kProportionalPpmPerMs * errorMs + integralPpm_,
+        -kMaxCorrectionPpm, kMaxCorrectionPpm);
+    rate_ = 1.0 + correctionPpm * 1e-6;
+
+    if (std::fabs(errorMs) <= kSettledErrorMs) {
+        if (++withinTolerance_ >= kSettledUpdates && convergenceUs_ < 0)
+            convergenceUs_ = input.nowUs - activeSinceUs_;
+    } else {
+        withinTolerance_ = 0;
+    }
+
+    update.rate = rate_;
+    update.active = true;
+    update.errorMs = errorMs;
+    update.correctionPpm = correctionPpm;
+    update.driftPpm = driftPpm;
+    return true;
+}
+
+void AudioRateController::resetLoop(float filteredMs)
+{
+    filteredMs_ = filteredMs;
+    integralPpm_ = 0.0;
+    activeSinceUs_ = -1;
+    convergenceUs_ = -1;
+    withinTolerance_ = 0;
+}
+
+} // namespace oap
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ClockDriftEstimator.hpp"
+
+namespace oap {
+
+/// Rate for PipeWire's adaptive resampler (pw_stream_set_rate()) that keeps
+/// a playback ring at its target depth while the producer's clock and the
+/// graph's clock drift apart.
+///
+/// Two parts add up. The feed-forward term is the measured drift: the
+/// source's sample clock (from media timestamps and sample counts, measured
+/// by the producer) against the graph clock (frames consumed per callback,
+/// measured here) over the local steady clock. It holds the fill level still
+/// by itself once both estimates are valid. A PI loop on the smoothed fill
+/// error, in milliseconds, trims what the estimate misses and restores the
+/// target after a burst. Without a source estimate the PI loop runs alone.
+///
+/// The buffer is settled once the smoothed error stays within
+/// kSettledErrorMs for kSettledUpdates rate updates. The time from the
+/// first active update until then is the convergence time.
+///
+/// process() runs on the PW RT thread only. It never allocates or locks.
+class AudioRateController {
+public:
+    /// Callbacks between rate updates (~170 ms at a 1024-frame quantum).
+    static constexpr int kUpdateInterval = 8;
+    /// Per-callback EMA weight of the fill level (~1 s time constant).
+    static constexpr float kFillAlpha = 0.02f;
+    /// ppm per ms of error: closes an offset with a ~10 s time constant.
+    static constexpr double kProportionalPpmPerMs = 100.0;
+    /// ppm per ms of error per second; damping ~0.7 with the P term.
+    static constexpr double kIntegralPpmPerMsS = 5.0;
+    static constexpr double kMaxIntegralPpm = 1000.0;
+    static constexpr double kMaxDriftPpm = 1000.0;
+    /// ±0.5%, as before the drift estimate.
+    static constexpr double kMaxCorrectionPpm = 5000.0;
+    static constexpr double kSettledErrorMs = 2.0;
+    static constexpr int kSettledUpdates = 16;
+
+    struct Input {
+        int64_t nowUs = 0;
+        /// Frames handed to the resampler by this callback.
+        uint32_t frames = 0;
+        /// True when the callback read real audio from the ring.
+        bool hadData = false;
+        uint32_t bufferedFrames = 0;
+        uint32_t targetFrames = 0;
+        bool sourceDriftValid = false;
+        double sourceDriftPpm = 0.0;
+    };
+
+    struct Update {
+        double rate = 1.0;
+        bool active = false;
+        double errorMs = 0.0;
+        double correctionPpm = 0.0;
+        /// Feed-forward part of the correction; 0 until both estimates hold.
+        double driftPpm = 0.0;
+    };
+
+    explicit AudioRateController(int sampleRate = 48000);
+
+    /// One process callback. Returns true when @p update holds a new rate
+    /// to apply; between updates the previous rate stays in force.
+    bool process(const Input& input, Update& update);
+
+    double rate() const { return rate_; }
+    const ClockDriftEstimator& graphClock() const { return graphClock_; }
+    /// -1 until the buffer settles after becoming active.
+    int64_t convergenceUs() const { return convergenceUs_; }
+    bool settled() const { return convergenceUs_ >= 0; }
+
+private:
+    void resetLoop(float filteredMs);
+
+    int sampleRate_;
+    ClockDriftEstimator graphClock_;
+    double graphPositionUs_ = 0.0;
+    double rate_ = 1.0;
+
+    int callbacks_ = 0;
+    int activeCallbacks_ = 0;
+    float filteredMs_ = 0.0f;
+    bool filterPrimed_ = false;
+    double integralPpm_ = 0.0;
+    int64_t lastUpdateUs_ = 0;
+
+    int64_t activeSinceUs_ = -1;
+    int64_t convergenceUs_ = -1;
+    int withinTolerance_ = 0;
+};
+
+} // namespace oap
@@ -108,6 +108,20 @@ public:
         return toRead;
     }
 
+    // Reader-side discard of up to size bytes, oldest first. Same cursor
+    // ownership as read(); returns the bytes dropped.
+    uint32_t skip(uint32_t size)
+    {
+        uint32_t readIdx;
+        int32_t avail = spa_ringbuffer_get_read_index(&ring_, &readIdx);
+        if (avail <= 0 || size == 0) return 0;
+
+        const uint32_t toSkip = std::min(size, static_cast<uint32_t>(avail));
+        spa_ringbuffer_read_update(&ring_,
+            static_cast<int32_t>(readIdx + toSkip));
+        return toSkip;
+    }
+
     // Full re-init of both indices. NOT writer-safe: the non-atomic reset of
     // write index tears against a live writer. Use ONLY in genuinely-quiescent
     // contexts (e.g. construction) — never while an RT process/capture callback
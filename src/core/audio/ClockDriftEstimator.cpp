@@ -0,0 +1,94 @@
+#include "ClockDriftEstimator.hpp"
+
+#include <cstdlib>
+
+namespace oap {
+
+void ClockDriftEstimator::add(int64_t localUs, int64_t remoteUs)
+{
+    const int64_t offsetUs = localUs - remoteUs;
+    if (binOpen_ && localUs - binStartUs_ >= kBinUs)
+        closeBin();
+    if (!binOpen_) {
+        binOpen_ = true;
+        binStartUs_ = localUs;
+        binMinLocalUs_ = localUs;
+        binMinOffsetUs_ = offsetUs;
+        return;
+    }
+    if (offsetUs < binMinOffsetUs_) {
+        binMinOffsetUs_ = offsetUs;
+        binMinLocalUs_ = localUs;
+    }
+}
+
+void ClockDriftEstimator::reset()
+{
+    count_ = 0;
+    next_ = 0;
+    binOpen_ = false;
+    ppm_ = 0.0;
+}
+
+int64_t ClockDriftEstimator::spanUs() const
+{
+    if (count_ < 2)
+        return 0;
+    const size_t newest = (next_ + kBins - 1) % kBins;
+    const size_t oldest = (next_ + kBins - count_) % kBins;
+    return binLocalUs_[newest] - binLocalUs_[oldest];
+}
+
+void ClockDriftEstimator::closeBin()
+{
+    binOpen_ = false;
+    if (count_ > 0) {
+        const size_t last = (next_ + kBins - 1) % kBins;
+        int64_t step = binMinOffsetUs_ - binOffsetUs_[last];
+        if (std::llabs(step) > kStepUs) {
+            // Keep the skew already measured across the gap; shift away
+            // only the jump itself.
+            step += static_cast<int64_t>(
+                ppm_ * 1e-6 * double(binMinLocalUs_ - binLocalUs_[last]));
+            for (size_t i = 0; i < count_; ++i)
+                binOffsetUs_[(next_ + kBins - count_ + i) % kBins] += step;
+        }
+    }
+    binLocalUs_[next_] = binMinLocalUs_;
+    binOffsetUs_[next_] = binMinOffsetUs_;
+    next_ = (next_ + 1) % kBins;
+    if (count_ < kBins)
+        ++count_;
+    if (valid())
+        fit();
+}
+
+void ClockDriftEstimator::fit()
+{
+    // Relative to the oldest bin, so the sums stay well inside double
+    // precision whatever the clocks' epochs are.
+    const size_t oldest = (next_ + kBins - count_) % kBins;
+    const int64_t x0 = binLocalUs_[oldest];
+    const int64_t y0 = binOffsetUs_[oldest];
+    double sumX = 0.0, sumY = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        const size_t k = (oldest + i) % kBins;
+        sumX += double(binLocalUs_[k] - x0);
+        sumY += double(binOffsetUs_[k] - y0);
+    }
+    const double meanX = sumX / double(count_);
+    const double meanY = sumY / double(count_);
+    double sxx = 0.0, sxy = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        const size_t k = (oldest + i) % kBins;
+        const double dx = double(binLocalUs_[k] - x0) - meanX;
+        sxx += dx * dx;
+        sxy += dx * (double(binOffsetUs_[k] - y0) - meanY);
+    }
+    if (sxx <= 0.0)
+        return;
+    // The offset grows when the remote clock falls behind.
+    ppm_ = -sxy / sxx * 1e6;
+}
+
+} // namespace oap
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oap {
+
+/// Estimates how fast a remote clock runs against the local steady clock,
+/// from pairs of (local time, remote position) in microseconds.
+///
+/// Each point's offset (local - remote) is the remote clock's lag plus
+/// whatever delay the sample picked up (network jitter, a late wake-up).
+/// The delay is never negative, so the minimum offset of each kBinUs bin
+/// tracks the clock itself. A least-squares line through the last kBins
+/// minima gives the skew. A jump of more than kStepUs between two bins is
+/// a discontinuity (a pause, a resync of the remote timeline). The history
+/// is shifted onto the new level instead of being discarded.
+///
+/// Single-threaded and allocation-free, so it can run on the PW RT thread.
+class ClockDriftEstimator {
+public:
+    static constexpr int64_t kBinUs = 500000;
+    static constexpr size_t kBins = 64;
+    /// Four seconds of history before the estimate is trusted.
+    static constexpr size_t kMinBins = 8;
+    static constexpr int64_t kStepUs = 10000;
+
+    void add(int64_t localUs, int64_t remoteUs);
+    void reset();
+
+    bool valid() const { return count_ >= kMinBins; }
+    /// Remote clock speed relative to local, parts per million; positive
+    /// when the remote clock runs fast.
+    double ppm() const { return ppm_; }
+    /// Local time covered by the bins behind the estimate.
+    int64_t spanUs() const;
+
+private:
+    void closeBin();
+    void fit();
+
+    std::array<int64_t, kBins> binLocalUs_{};
+    std::array<int64_t, kBins> binOffsetUs_{};
+    size_t count_ = 0;
+    size_t next_ = 0;
+
+    bool binOpen_ = false;
+    int64_t binStartUs_ = 0;
+    int64_t binMinLocalUs_ = 0;
+    int64_t binMinOffsetUs_ = 0;
+
+    double ppm_ = 0.0;
+};
+
+} // namespace oap
@@ -5,6 +5,12 @@
 #include <cmath>
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace oap {
 
 static_assert(std::atomic<uint64_t>::is_always_lock_free,
@@ -12,6 +18,148 @@ static_assert(std::atomic<uint64_t>::is_always_lock_free,
 static_assert(std::atomic<uint32_t>::is_always_lock_free,
               "Equalizer RT publication requires a lock-free generation atomic");
 
+namespace {
+
+// Bypass crossfade: mix = 0 means full wet (EQ active), 1 means full dry (bypass)
+inline float crossfade(float wet, float dry, float mix)
+{
+    if (mix <= 0.0f)
+        return wet;
+    if (mix >= 1.0f)
+        return dry;
+    return wet * (1.0f - mix) + dry * mix;
+}
+
+// Convert back to int16_t with clamp. Clamping before the conversion keeps it
+// defined for any finite level and matches the vector saturation exactly.
+inline int16_t toInt16(float x)
+{
+    const float scaled = std::clamp(x * 32768.0f, -32768.0f, 32767.0f);
+    return static_cast<int16_t>(static_cast<int32_t>(scaled));
+}
+
+} // namespace
+
+// Two-lane (left/right) vector helpers for processBlockSimd(). This file is
+// built with -ffp-contract=off so neither kernel gets fused multiply-adds.
+#if defined(__SSE2__) || defined(_M_X64)
+#define OAP_EQ_SIMD 1
+namespace eqsimd {
+
+constexpr const char* kName = "sse2";
+using Vec = __m128;  // lanes 2 and 3 are unused
+
+inline Vec splat(float v) { return _mm_set1_ps(v); }
+inline Vec pair(float l, float r) { return _mm_setr_ps(l, r, 0.0f, 0.0f); }
+inline float lane(Vec v, int i)
+{
+    alignas(16) float out[4];
+    _mm_store_ps(out, v);
+    return out[i];
+}
+inline Vec loadPair(const float* p)
+{
+    return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)));
+}
+inline void storePair(float* p, Vec v)
+{
+    _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(v));
+}
+inline Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+inline Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+inline Vec div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+inline Vec abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline Vec greater(Vec a, Vec b) { return _mm_cmpgt_ps(a, b); }
+inline Vec select(Vec mask, Vec a, Vec b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Bulk conversions; return how many samples were converted (a multiple of 8).
+inline int widenInt16(const int16_t* in, float* out, int count)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(raw, raw), 16);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    return i;
+}
+
+inline int narrowToInt16(const float* in, int16_t* out, int count)
+{
+    const __m128 scale = _mm_set1_ps(32768.0f);
+    const __m128 low = _mm_set1_ps(-32768.0f);
+    const __m128 high = _mm_set1_ps(32767.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i), scale), low), high);
+        const __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i + 4), scale), low), high);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packs_epi32(_mm_cvttps_epi32(a), _mm_cvttps_epi32(b)));
+    }
+    return i;
+}
+
+} // namespace eqsimd
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+// AArch64 only: 32-bit NEON has no exact vector divide for the limiter.
+#define OAP_EQ_SIMD 1
+namespace eqsimd {
+
+constexpr const char* kName = "neon";
+using Vec = float32x2_t;
+
+inline Vec splat(float v) { return vdup_n_f32(v); }
+inline Vec pair(float l, float r) { return vset_lane_f32(r, vdup_n_f32(l), 1); }
+inline float lane(Vec v, int i) { return i == 0 ? vget_lane_f32(v, 0) : vget_lane_f32(v, 1); }
+inline Vec loadPair(const float* p) { return vld1_f32(p); }
+inline void storePair(float* p, Vec v) { vst1_f32(p, v); }
+inline Vec add(Vec a, Vec b) { return vadd_f32(a, b); }
+inline Vec sub(Vec a, Vec b) { return vsub_f32(a, b); }
+inline Vec mul(Vec a, Vec b) { return vmul_f32(a, b); }
+inline Vec div(Vec a, Vec b) { return vdiv_f32(a, b); }
+inline Vec abs(Vec a) { return vabs_f32(a); }
+inline uint32x2_t greater(Vec a, Vec b) { return vcgt_f32(a, b); }
+inline Vec select(uint32x2_t mask, Vec a, Vec b) { return vbsl_f32(mask, a, b); }
+
+inline int widenInt16(const int16_t* in, float* out, int count)
+{
+    const float32x4_t scale = vdupq_n_f32(1.0f / 32768.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t raw = vld1q_s16(in + i);
+        vst1q_f32(out + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(raw))), scale));
+        vst1q_f32(out + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(raw))), scale));
+    }
+    return i;
+}
+
+inline int narrowToInt16(const float* in, int16_t* out, int count)
+{
+    const float32x4_t scale = vdupq_n_f32(32768.0f);
+    const float32x4_t low = vdupq_n_f32(-32768.0f);
+    const float32x4_t high = vdupq_n_f32(32767.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float32x4_t a = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(in + i), scale), low), high);
+        const float32x4_t b = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(in + i + 4), scale), low), high);
+        // vcvtq_s32_f32 truncates toward zero, like the scalar cast.
+        vst1q_s16(out + i, vcombine_s16(vmovn_s32(vcvtq_s32_f32(a)), vmovn_s32(vcvtq_s32_f32(b))));
+    }
+    return i;
+}
+
+} // namespace eqsimd
+#else
+#define OAP_EQ_SIMD 0
+#endif
+
 EqualizerEngine::EqualizerEngine(float sampleRate, int channels)
     : sampleRate_(sampleRate)
     , channels_(std::clamp(channels, 1, 2))
@@ -143,7 +291,19 @@ bool EqualizerEngine::tryLoadPublishedCoeffs(EngineCoeffs& result,
 
 void EqualizerEngine::process(int16_t* data, int frameCount)
 {
-    if (frameCount <= 0 || data == nullptr) return;
+    processFrames(data, data, nullptr, frameCount);
+}
+
+void EqualizerEngine::process(const int16_t* in, float* out, int frameCount)
+{
+    if (out == nullptr) return;
+    processFrames(in, nullptr, out, frameCount);
+}
+
+void EqualizerEngine::processFrames(const int16_t* in, int16_t* out16, float* outF,
+                                    int frameCount)
+{
+    if (frameCount <= 0 || in == nullptr) return;
 
     // Take one bounded snapshot attempt. If a publication overlaps this copy,
     // defer it to the next callback; never spin or lock on the RT thread.
@@ -191,15 +351,22 @@ void EqualizerEngine::process(int16_t* data, int frameCount)
         lastSeenGeneration_ = gen;
     }
 
+    const bool simd = kernel_ == Kernel::Simd && channels_ == 2 && simdKernelName() != nullptr;
+
     // Fully bypassed and no ramp in progress — fast path
     if (bypassMix_ >= 1.0f && bypassRampRemaining_ <= 0 && interpSamplesRemaining_ <= 0) {
-        return; // data passes through unmodified
+        if (outF)
+            widenToFloat(in, outF, frameCount * channels_, simd);
+        return; // int16 data passes through unmodified
     }
+    std::array<BiquadCoeffs, kNumBands> coeffs;
+    for (int done = 0; done < frameCount;) {
+        int frames = std::min(frameCount - done, kBlockFrames);
 
-    for (int f = 0; f < frameCount; ++f) {
-        // Compute current interpolated coefficients if ramping
-        std::array<BiquadCoeffs, kNumBands> coeffs;
+        // Interpolated coefficients are held for one block; a block never
+        // crosses the end of the ramp.
         if (interpSamplesRemaining_ > 0) {
+            frames = std::min(frames, interpSamplesRemaining_);
             float t = 1.0f - static_cast<float>(interpSamplesRemaining_)
                              / static_cast<float>(kInterpolationSamples);
             for (int b = 0; b < kNumBands; ++b) {
@@ -209,25 +376,74 @@ void EqualizerEngine::process(int16_t* data, int frameCount)
                 coeffs[b].a1 = oldCoeffs_[b].a1 + t * (newCoeffs_[b].a1 - oldCoeffs_[b].a1);
                 coeffs[b].a2 = oldCoeffs_[b].a2 + t * (newCoeffs_[b].a2 - oldCoeffs_[b].a2);
             }
-            --interpSamplesRemaining_;
+            interpSamplesRemaining_ -= frames;
         } else {
             coeffs = newCoeffs_;
         }
 
-        // Update bypass crossfade mix
-        if (bypassRampRemaining_ > 0) {
-            float step = 1.0f / static_cast<float>(kInterpolationSamples);
-            if (bypassTarget_ > bypassMix_) {
-                bypassMix_ = std::min(bypassMix_ + step, 1.0f);
-            } else {
-                bypassMix_ = std::max(bypassMix_ - step, 0.0f);
+        // Bypass crossfade mix, still stepped per frame
+        for (int f = 0; f < frames; ++f) {
+            if (bypassRampRemaining_ > 0) {
+                float step = 1.0f / static_cast<float>(kInterpolationSamples);
+                if (bypassTarget_ > bypassMix_) {
+                    bypassMix_ = std::min(bypassMix_ + step, 1.0f);
+                } else {
+                    bypassMix_ = std::max(bypassMix_ - step, 0.0f);
+                }
+                --bypassRampRemaining_;
             }
-            --bypassRampRemaining_;
+            blockMix_[f] = bypassMix_;
         }
 
+        const int offset = done * channels_;
+        const int samples = frames * channels_;
+        widenToFloat(in + offset, blockDry_.data(), samples, simd);
+        if (simd)
+            processBlockSimd(frames, coeffs);
+        else
+            processBlockScalar(frames, coeffs);
+        if (out16)
+            narrowToInt16(blockOut_.data(), out16 + offset, samples, simd);
+        else
+            std::memcpy(outF + offset, blockOut_.data(), samples * sizeof(float));
+        done += frames;
+    }
+}
+
+void EqualizerEngine::widenToFloat(const int16_t* in, float* out, int samples, bool simd)
+{
+    int i = 0;
+#if OAP_EQ_SIMD
+    if (simd)
+        i = eqsimd::widenInt16(in, out, samples);
+#else
+    (void)simd;
+#endif
+    for (; i < samples; ++i)
+        out[i] = static_cast<float>(in[i]) / 32768.0f;
+}
+
+void EqualizerEngine::narrowToInt16(const float* in, int16_t* out, int samples, bool simd)
+{
+    int i = 0;
+#if OAP_EQ_SIMD
+    if (simd)
+        i = eqsimd::narrowToInt16(in, out, samples);
+#else
+    (void)simd;
+#endif
+    for (; i < samples; ++i)
+        out[i] = toInt16(in[i]);
+}
+
+void EqualizerEngine::processBlockScalar(int frames,
+                                         const std::array<BiquadCoeffs, kNumBands>& coeffs)
+{
+
+    for (int f = 0; f < frames; ++f) {
         for (int ch = 0; ch < channels_; ++ch) {
             int idx = f * channels_ + ch;
-            float dry = static_cast<float>(data[idx]) / 32768.0f;
+            float dry = blockDry_[idx];
             float wet = dry;
 
             // Process through 10-band biquad cascade
@@ -238,22 +454,86 @@ void EqualizerEngine::process(int16_t* data, int frameCount)
             // Soft limiter
             wet = limiters_[ch].process(wet);
 
-            // Bypass crossfade: mix = 0 means full wet (EQ active), 1 means full dry (bypass)
-            float out;
-            if (bypassMix_ <= 0.0f) {
-                out = wet;
-            } else if (bypassMix_ >= 1.0f) {
-                out = dry;
-            } else {
-                out = wet * (1.0f - bypassMix_) + dry * bypassMix_;
-            }
+            blockOut_[idx] = crossfade(wet, dry, blockMix_[f]);
+        }
+    }
+}
 
-            // Convert back to int16_t with clamp
-            int32_t sample = static_cast<int32_t>(out * 32768.0f);
-            sample = std::clamp(sample, static_cast<int32_t>(-32768), static_cast<int32_t>(32767));
-            data[idx] = static_cast<int16_t>(sample);
+#if OAP_EQ_SIMD
+void EqualizerEngine::processBlockSimd(int frames,
+                                       const std::array<BiquadCoeffs, kNumBands>& coeffs)
+{
+    using namespace eqsimd;
+
+    // Lane 0 is left, lane 1 right; the same expressions as processSample()
+    // and SoftLimiter::process(), so every lane rounds like Scalar.
+    Vec b0[kNumBands], b1[kNumBands], b2[kNumBands], a1[kNumBands], a2[kNumBands];
+    Vec z1[kNumBands], z2[kNumBands];
+    for (int b = 0; b < kNumBands; ++b) {
+        b0[b] = splat(coeffs[b].b0);
+        b1[b] = splat(coeffs[b].b1);
+        b2[b] = splat(coeffs[b].b2);
+        a1[b] = splat(coeffs[b].a1);
+        a2[b] = splat(coeffs[b].a2);
+        z1[b] = pair(states_[0][b].z1, states_[1][b].z1);
+        z2[b] = pair(states_[0][b].z2, states_[1][b].z2);
+    }
+    const Vec attack = splat(limiters_[0].attackCoeff());
+    const Vec release = splat(limiters_[0].releaseCoeff());
+    const Vec threshold = splat(limiters_[0].threshold());
+    Vec envelope = pair(limiters_[0].envelope(), limiters_[1].envelope());
+
+    for (int f = 0; f < frames; ++f) {
+        const Vec dry = loadPair(&blockDry_[f * 2]);
+        Vec wet = dry;
+        for (int b = 0; b < kNumBands; ++b) {
+            const Vec y = add(mul(b0[b], wet), z1[b]);
+            z1[b] = add(sub(mul(b1[b], wet), mul(a1[b], y)), z2[b]);
+            z2[b] = sub(mul(b2[b], wet), mul(a2[b], y));
+            wet = y;
         }
+
+        const Vec level = abs(wet);
+        const Vec rate = select(greater(level, envelope), attack, release);
+        envelope = add(envelope, mul(rate, sub(level, envelope)));
+        wet = select(greater(envelope, threshold), mul(wet, div(threshold, envelope)), wet);
+
+        const float mix = blockMix_[f];
+        Vec out;
+        if (mix <= 0.0f)
+            out = wet;
+        else if (mix >= 1.0f)
+            out = dry;
+        else
+            out = add(mul(wet, splat(1.0f - mix)), mul(dry, splat(mix)));
+        storePair(&blockOut_[f * 2], out);
+    }
+
+    for (int b = 0; b < kNumBands; ++b) {
+        states_[0][b].z1 = lane(z1[b], 0);
+        states_[1][b].z1 = lane(z1[b], 1);
+        states_[0][b].z2 = lane(z2[b], 0);
+        states_[1][b].z2 = lane(z2[b], 1);
     }
+    limiters_[0].setEnvelope(lane(envelope, 0));
+    limiters_[1].setEnvelope(lane(envelope, 1));
+}
+
+const char* EqualizerEngine::simdKernelName()
+{
+    return eqsimd::kName;
+}
+#else
+void EqualizerEngine::processBlockSimd(int frames,
+                                       const std::array<BiquadCoeffs, kNumBands>& coeffs)
+{
+    processBlockScalar(frames, coeffs);
+}
+
+const char* EqualizerEngine::simdKernelName()
+{
+    return nullptr;
 }
+#endif
 
 } // namespace oap
@@ -17,7 +17,7 @@ namespace oap {
 ///
 /// Processes stereo interleaved int16_t audio at 48kHz (or configured sample rate).
 /// Atomic coefficient snapshots for lock-free RT/non-RT communication.
-/// Per-sample coefficient interpolation for smooth transitions.
+/// Coefficient interpolation in kBlockFrames steps for smooth transitions.
 /// Wet/dry crossfade for bypass toggle.
 /// Integrated soft limiter prevents clipping.
 ///
@@ -28,6 +28,15 @@ class EqualizerEngine {
 public:
     /// Number of interpolation samples for coefficient transitions (~48ms at 48kHz)
     static constexpr int kInterpolationSamples = 2304;
+    /// Frames per interpolation step and per processing block (~0.7ms at 48kHz)
+    static constexpr int kBlockFrames = 32;
+
+    /// Implementation used by process().
+    ///   Scalar: one channel at a time; the reference implementation.
+    ///   Simd:   stereo with one vector lane per channel (SSE2 on x86-64,
+    ///           NEON on AArch64), bit-identical to Scalar. Mono streams and
+    ///           other targets use Scalar.
+    enum class Kernel { Scalar, Simd };
 
     /// @param sampleRate  Audio sample rate in Hz
     /// @param channels    Number of audio channels (1 or 2, default stereo)
@@ -58,6 +67,21 @@ public:
     /// @param frameCount Number of frames (each frame = channels samples)
     void process(int16_t* data, int frameCount);
 
+    /// Process int16_t input into float output (RT-safe), for F32 streams.
+    /// Output is in [-1, 1) full scale and skips the int16_t quantization and
+    /// clamp; otherwise identical to the in-place overload.
+    /// @param in         Interleaved input samples
+    /// @param out        Interleaved output, frameCount * channels floats
+    void process(const int16_t* in, float* out, int frameCount);
+
+    /// Select the process() implementation (default Simd). Call only while
+    /// process() is not running, e.g. before the stream connects.
+    void setKernel(Kernel kernel) { kernel_ = kernel; }
+    Kernel kernel() const { return kernel_; }
+
+    /// "sse2" or "neon", or nullptr when this build has no SIMD kernel.
+    static const char* simdKernelName();
+
 private:
     friend class ::TestEqualizerEngine;
 
@@ -128,6 +152,15 @@ private:
     // process() defers it to the next callback instead of spinning.
     bool tryLoadPublishedCoeffs(EngineCoeffs& result, uint32_t& generation) const;
 
+    // Shared body of both process() overloads; exactly one of out16/outF is set.
+    void processFrames(const int16_t* in, int16_t* out16, float* outF, int frameCount);
+    // Run one block of at most kBlockFrames frames from blockDry_ into
+    // blockOut_ with fixed coefficients and the per-frame mix in blockMix_.
+    void processBlockScalar(int frames, const std::array<BiquadCoeffs, kNumBands>& coeffs);
+    void processBlockSimd(int frames, const std::array<BiquadCoeffs, kNumBands>& coeffs);
+    static void widenToFloat(const int16_t* in, float* out, int samples, bool simd);
+    static void narrowToInt16(const float* in, int16_t* out, int samples, bool simd);
+
     float sampleRate_;
     int channels_;
 
@@ -161,6 +194,13 @@ private:
 
     // Per-channel soft limiter
     std::array<SoftLimiter, 2> limiters_;
+
+    Kernel kernel_ = Kernel::Simd;
+    // Block scratch, interleaved like the input: dry input and final output
+    // as float, and the bypass mix of each frame.
+    std::array<float, kBlockFrames * 2> blockDry_{};
+    std::array<float, kBlockFrames * 2> blockOut_{};
+    std::array<float, kBlockFrames> blockMix_{};
 };
 
 } // namespace oap
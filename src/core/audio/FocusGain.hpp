@@ -38,4 +38,31 @@ inline float applyFocusGain(int16_t* samples, int frames, int channels,
     return g;
 }
 
+/// Float32 variant of applyFocusGain() for F32 streams: the same ramp, with
+/// no truncation of the scaled samples.
+inline float applyFocusGain(float* samples, int frames, int channels,
+                            float currentGain, float targetGain)
+{
+    float g = currentGain;
+    for (int f = 0; f < frames; ++f) {
+        if (g < targetGain)
+            g = std::min(g + kFocusGainRampPerFrame, targetGain);
+        else if (g > targetGain)
+            g = std::max(g - kFocusGainRampPerFrame, targetGain);
+        if (g < 1.0f) {
+            float* frame = samples + f * channels;
+            for (int c = 0; c < channels; ++c)
+                frame[c] *= g;
+        }
+    }
+    return g;
+}
+
+/// Convert interleaved int16 PCM to float32 in [-1, 1).
+inline void convertS16ToF32(const int16_t* in, float* out, int samples)
+{
+    for (int i = 0; i < samples; ++i)
+        out[i] = static_cast<float>(in[i]) / 32768.0f;
+}
+
 } // namespace oap
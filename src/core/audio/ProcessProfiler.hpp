@@ -0,0 +1,188 @@
+#pragma once
+
+#include <QString>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "core/LatencyHistogram.hpp"
+#include "core/MetricsRegistry.hpp"
+
+namespace oap {
+
+/// Cost and deadline accounting for one PipeWire stream's process callback.
+///
+/// The callback brackets its work with begin()/end() and may mark stage
+/// boundaries with lap() in between. end() converts the period it just
+/// filled into a time budget (frames / rate). The callback's duration
+/// against that budget is its load. Callbacks using at least
+/// kNearMissPermille of the budget are near misses, and callbacks using all
+/// of it are overruns. The time between two begin() calls is the wake-up
+/// interval. It should equal the previous period, and one beyond
+/// kLateWakePermille of it counts as a late wake-up.
+///
+/// The begin()/lap()/end() calls are RT-safe. They touch only
+/// LatencyHistograms (relaxed atomics), atomic counters and plain state
+/// owned by the RT thread. Stage timing costs one clock read per lap, so it
+/// is off unless enabled before the stream connects. take() belongs to the
+/// diagnostic timer.
+class ProcessProfiler {
+public:
+    enum Stage {
+        RingRead,   ///< ring buffer read plus silence fill
+        Equalizer,  ///< EQ, including the int16 → float conversion it absorbs
+        Gain,       ///< focus gain ramp
+        RateMatch,  ///< fill EMA, PI update and pw_stream_set_rate()
+        kStageCount
+    };
+
+    static constexpr uint64_t kNearMissPermille = 750;
+    static constexpr uint64_t kLateWakePermille = 1500;
+
+    static uint64_t nowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /// Fixed before the stream connects.
+    void setStageTiming(bool enabled) { stageTiming_ = enabled; }
+    bool stageTiming() const { return stageTiming_; }
+
+    /// Register the histograms as audio.* metrics labelled with the stream.
+    void registerMetrics(const QString& label)
+    {
+        auto& registry = MetricsRegistry::instance();
+        const QString ns = QStringLiteral("ns");
+        registrations_[0] = registry.add(QStringLiteral("audio.process"), label, ns, &durationNs_);
+        registrations_[1] = registry.add(QStringLiteral("audio.interval"), label, ns, &intervalNs_);
+        registrations_[2] = registry.add(QStringLiteral("audio.load"), label,
+                                         QStringLiteral("permille"), &loadPermille_);
+        if (!stageTiming_)
+            return;
+        static const char* const kStageMetrics[kStageCount] = {
+            "audio.stage.ring", "audio.stage.eq", "audio.stage.gain", "audio.stage.rate"};
+        for (int s = 0; s < kStageCount; ++s) {
+            registrations_[3 + s] = registry.add(QLatin1String(kStageMetrics[s]), label, ns,
+                                                 &stageHistograms_[s]);
+        }
+    }
+
+    // ---- PW RT thread ----
+
+    void begin(uint64_t now)
+    {
+        if (lastBeginNs_ != 0 && lastPeriodNs_ != 0) {
+            const uint64_t interval = now - lastBeginNs_;
+            intervalNs_.record(interval);
+            if (interval * 1000 > lastPeriodNs_ * kLateWakePermille)
+                lateWakeups_.fetch_add(1, std::memory_order_relaxed);
+        }
+        lastBeginNs_ = now;
+        mark_ = now;
+        stageNs_.fill(0);
+    }
+
+    /// Charge the time since the previous mark to @p stage. A stage may be
+    /// charged several times per callback (the F32 path works in chunks).
+    void lap(Stage stage)
+    {
+        if (!stageTiming_)
+            return;
+        const uint64_t now = nowNs();
+        stageNs_[stage] += now - mark_;
+        mark_ = now;
+    }
+
+    /// @p frames is the period just produced or consumed; 0 when the
+    /// callback had no buffer, which records the duration only.
+    void end(uint64_t now, uint32_t frames, uint32_t sampleRate)
+    {
+        const uint64_t duration = now - lastBeginNs_;
+        durationNs_.record(duration);
+        if (frames == 0 || sampleRate == 0)
+            return;
+
+        const uint64_t period = uint64_t(frames) * 1000000000u / sampleRate;
+        lastPeriodNs_ = period;
+        periodNs_.record(period);
+        const uint64_t load = period > 0 ? duration * 1000 / period : 0;
+        loadPermille_.record(load);
+        if (load >= 1000)
+            overruns_.fetch_add(1, std::memory_order_relaxed);
+        else if (load >= kNearMissPermille)
+            nearMisses_.fetch_add(1, std::memory_order_relaxed);
+
+        if (stageTiming_) {
+            for (int s = 0; s < kStageCount; ++s)
+                stageHistograms_[s].record(stageNs_[s]);
+        }
+    }
+
+    // ---- Diagnostic timer ----
+
+    struct Summary {
+        LatencyHistogram::Snapshot duration;
+        LatencyHistogram::Snapshot interval;
+        LatencyHistogram::Snapshot period;
+        LatencyHistogram::Snapshot load;
+        std::array<LatencyHistogram::Snapshot, kStageCount> stages;
+        uint32_t nearMisses = 0;
+        uint32_t overruns = 0;
+        uint32_t lateWakeups = 0;
+
+        /// Share of the budget spent in @p stage over the window, percent.
+        double stagePercent(Stage stage) const
+        {
+            return period.sum > 0 ? 100.0 * double(stages[stage].sum) / double(period.sum) : 0.0;
+        }
+    };
+
+    /// Everything recorded since the previous take().
+    Summary take()
+    {
+        Summary summary;
+        summary.duration = durationWindow_.take();
+        summary.interval = intervalWindow_.take();
+        summary.period = periodWindow_.take();
+        summary.load = loadWindow_.take();
+        for (int s = 0; s < kStageCount; ++s)
+            summary.stages[s] = stageWindows_[s].take();
+        summary.nearMisses = nearMisses_.exchange(0, std::memory_order_relaxed);
+        summary.overruns = overruns_.exchange(0, std::memory_order_relaxed);
+        summary.lateWakeups = lateWakeups_.exchange(0, std::memory_order_relaxed);
+        return summary;
+    }
+
+private:
+    bool stageTiming_ = false;
+
+    // RT thread only.
+    uint64_t lastBeginNs_ = 0;
+    uint64_t lastPeriodNs_ = 0;
+    uint64_t mark_ = 0;
+    std::array<uint64_t, kStageCount> stageNs_{};
+
+    LatencyHistogram durationNs_;
+    LatencyHistogram intervalNs_;
+    LatencyHistogram periodNs_;
+    LatencyHistogram loadPermille_;
+    std::array<LatencyHistogram, kStageCount> stageHistograms_;
+    std::atomic<uint32_t> nearMisses_{0};
+    std::atomic<uint32_t> overruns_{0};
+    std::atomic<uint32_t> lateWakeups_{0};
+
+    // Diagnostic timer only.
+    LatencyWindow durationWindow_{durationNs_};
+    LatencyWindow intervalWindow_{intervalNs_};
+    LatencyWindow periodWindow_{periodNs_};
+    LatencyWindow loadWindow_{loadPermille_};
+    std::array<LatencyWindow, kStageCount> stageWindows_{
+        LatencyWindow{stageHistograms_[0]}, LatencyWindow{stageHistograms_[1]},
+        LatencyWindow{stageHistograms_[2]}, LatencyWindow{stageHistograms_[3]}};
+    MetricsRegistry::Registration registrations_[3 + kStageCount];
+};
+
+} // namespace oap
@@ -51,6 +51,14 @@ public:
         envelope_ = 0.0f;
     }
 
+    /// Constants and envelope of process(), for vectorized callers that run
+    /// the same recurrence for several channels at once.
+    float attackCoeff() const { return attackCoeff_; }
+    float releaseCoeff() const { return releaseCoeff_; }
+    float threshold() const { return threshold_; }
+    float envelope() const { return envelope_; }
+    void setEnvelope(float envelope) { envelope_ = envelope; }
+
 private:
     float envelope_;
     float attackCoeff_;
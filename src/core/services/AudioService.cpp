@@ -4,6 +4,7 @@
 #include "core/audio/FocusGain.hpp"
 #include <QCoreApplication>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -24,6 +25,79 @@ constexpr int kMaxPlaybackBufferMs = 5000;
 constexpr int kMinPlaybackSampleRate = 8000;
 constexpr int kMaxPlaybackSampleRate = 384000;
 constexpr uint32_t kMaxPlaybackRingBytes = 8u * 1024u * 1024u;
+
+QString microseconds(uint64_t ns)
+{
+    return QString::number(ns / 1000.0, 'f', 1);
+}
+
+// One line per stream and diagnostic interval: callback cost against the
+// period the graph gave it, and where that time went when stages are timed.
+void logProcessTiming(const QString& name, const char* kind,
+                      const ProcessProfiler::Summary& timing, bool stages)
+{
+    if (timing.duration.count == 0)
+        return;
+    QString stageShares;
+    if (stages) {
+        stageShares = QStringLiteral(" stages % ring/eq/gain/rate %1/%2/%3/%4")
+            .arg(timing.stagePercent(ProcessProfiler::RingRead), 0, 'f', 1)
+            .arg(timing.stagePercent(ProcessProfiler::Equalizer), 0, 'f', 1)
+            .arg(timing.stagePercent(ProcessProfiler::Gain), 0, 'f', 1)
+            .arg(timing.stagePercent(ProcessProfiler::RateMatch), 0, 'f', 1);
+    }
+    qCDebug(lcAudio).noquote()
+        << "Audio callback" << name << kind
+        << "process us p50/p99/max"
+        << microseconds(timing.duration.percentile(50.0)) + '/'
+               + microseconds(timing.duration.percentile(99.0)) + '/'
+               + microseconds(timing.duration.max())
+        << "period us" << microseconds(static_cast<uint64_t>(timing.period.mean()))
+        << "load % p99/max"
+        << QStringLiteral("%1/%2").arg(timing.load.percentile(99.0) / 10.0, 0, 'f', 1)
+                                  .arg(timing.load.max() / 10.0, 0, 'f', 1)
+        << "near-miss" << timing.nearMisses << "overrun" << timing.overruns
+        << "interval us p99/max"
+        << microseconds(timing.interval.percentile(99.0)) + '/'
+               + microseconds(timing.interval.max())
+        << "late wakes" << timing.lateWakeups << stageShares;
+}
+
+// Drift feed-forward, time to settle and the ring depth held once settled.
+void logRateDrift(const QString& name, const AudioStreamHandle& handle,
+                  const LatencyHistogram::Snapshot& settled)
+{
+    const int32_t convergenceMs = handle.rateConvergenceMs.load(std::memory_order_relaxed);
+    qCDebug(lcAudio).noquote()
+        << "Audio rate" << name
+        << "drift ppm source/graph/fed"
+        << QStringLiteral("%1/%2/%3")
+               .arg(handle.rateSourceDriftPpm.load(std::memory_order_relaxed))
+               .arg(handle.rateGraphDriftPpm.load(std::memory_order_relaxed))
+               .arg(handle.rateDriftPpm.load(std::memory_order_relaxed))
+        << "converged"
+        << (convergenceMs < 0 ? QStringLiteral("no")
+                              : QStringLiteral("after %1 s").arg(convergenceMs / 1000.0, 0, 'f', 1))
+        << "settled buffered ms p50/p99"
+        << QStringLiteral("%1/%2").arg(settled.percentile(50.0) / 1000.0, 0, 'f', 1)
+                                  .arg(settled.percentile(99.0) / 1000.0, 0, 'f', 1);
+}
+
+void logJitterBuffer(const QString& name, AudioJitterBuffer& jitterBuffer)
+{
+    const AudioJitterBuffer::Stats stats = jitterBuffer.takeStats();
+    if (stats.jitter.count == 0 && stats.concealEvents == 0)
+        return;
+    qCDebug(lcAudio).noquote()
+        << "Audio jitter buffer" << name
+        << "target ms" << QString::number(jitterBuffer.targetDelayUs() / 1000.0, 'f', 1)
+        << "jitter ms p50/p95/max"
+        << QStringLiteral("%1/%2/%3").arg(stats.jitter.percentile(50.0) / 1000.0, 0, 'f', 1)
+                                     .arg(stats.jitter.percentile(95.0) / 1000.0, 0, 'f', 1)
+                                     .arg(stats.jitter.max() / 1000.0, 0, 'f', 1)
+        << "concealed gaps" << stats.concealEvents << "frames" << stats.concealedFrames
+        << "trims" << stats.trims << "frames" << stats.trimmedFrames;
+}
 }
 
 AudioService::AudioService(QObject* parent)
@@ -149,10 +223,13 @@ void AudioService::onPlaybackProcess(void* userdata)
     if (!handle || !handle->stream || !handle->ringBuffer)
         return;
 
+    handle->profiler.begin(ProcessProfiler::nowNs());
     struct pw_buffer* buf = pw_stream_dequeue_buffer(handle->stream);
     if (!buf) return;
 
     fillPlaybackBuffer(handle, buf);
+    handle->profiler.end(ProcessProfiler::nowNs(), static_cast<uint32_t>(buf->size),
+                         static_cast<uint32_t>(handle->sampleRate));
     pw_stream_queue_buffer(handle->stream, buf);
 }
 
@@ -172,8 +249,10 @@ bool AudioService::fillPlaybackBuffer(AudioStreamHandle* handle, struct pw_buffe
         d.chunk->stride = 0;
         d.chunk->size = 0;
     }
-    const int stride = handle->bytesPerFrame;
-    if (!d.data || !d.chunk || stride <= 0
+    const int stride = handle->floatOutput
+        ? handle->channels * static_cast<int>(sizeof(float))
+        : handle->bytesPerFrame;
+    if (!d.data || !d.chunk || stride <= 0 || handle->bytesPerFrame <= 0
         || d.maxsize < static_cast<uint32_t>(stride))
         return false;
 
@@ -185,110 +264,181 @@ bool AudioService::fillPlaybackBuffer(AudioStreamHandle* handle, struct pw_buffe
         n_frames = buf->requested;
     uint32_t wantBytes = n_frames * stride;
 
-    uint32_t bytesRead = handle->ringBuffer->read(static_cast<uint8_t*>(d.data), wantBytes);
-
-    // Track complete underruns for adaptive buffer growth
-    if (bytesRead == 0)
-        handle->underrunCount.fetch_add(1, std::memory_order_relaxed);
+    // bytesRead counts ring (int16) bytes consumed, bytesWritten output bytes.
+    uint32_t bytesRead = 0;
+    uint32_t bytesWritten = 0;
+    if (handle->floatOutput) {
+        uint32_t ringSamples = 0;
+        const uint32_t samples = fillFloatPeriod(handle, static_cast<float*>(d.data), n_frames,
+                                                 ringSamples);
+        bytesRead = ringSamples * sizeof(int16_t);
+        bytesWritten = samples * sizeof(float);
+    } else {
+        int16_t* samples = reinterpret_cast<int16_t*>(static_cast<uint8_t*>(d.data));
+        if (handle->jitterBuffer) {
+            // Always a full period: concealment or silence fills any gap.
+            bytesRead = handle->jitterBuffer->pull(samples, n_frames) * handle->bytesPerFrame;
+            bytesWritten = wantBytes;
+        } else {
+            bytesRead = handle->ringBuffer->read(static_cast<uint8_t*>(d.data), wantBytes);
+            bytesWritten = bytesRead;
+        }
+        handle->profiler.lap(ProcessProfiler::RingRead);
+        const int frames = static_cast<int>(bytesWritten / handle->bytesPerFrame);
 
-    // EQ processing (RT-safe, in-place) — runs before silence fill
-    if (handle->eqEngine && bytesRead > 0) {
-        int frames = static_cast<int>(bytesRead / handle->bytesPerFrame);
-        handle->eqEngine->process(
-            reinterpret_cast<int16_t*>(static_cast<uint8_t*>(d.data)),
-            frames);
-    }
+        // EQ processing (RT-safe, in-place) — runs before silence fill
+        if (handle->eqEngine && frames > 0) {
+            handle->eqEngine->process(samples, frames);
+            handle->profiler.lap(ProcessProfiler::Equalizer);
+        }
 
-    // Focus gain (duck/mute from applyDucking) — ramped to avoid clicks
-    if (bytesRead > 0) {
-        const float target = handle->targetGain.load(std::memory_order_relaxed);
-        if (target != 1.0f || handle->rtCurrentGain != 1.0f) {
-            int frames = static_cast<int>(bytesRead / handle->bytesPerFrame);
-            handle->rtCurrentGain = applyFocusGain(
-                reinterpret_cast<int16_t*>(static_cast<uint8_t*>(d.data)),
-                frames, handle->channels, handle->rtCurrentGain, target);
+        // Focus gain (duck/mute from applyDucking) — ramped to avoid clicks
+        if (frames > 0) {
+            const float target = handle->targetGain.load(std::memory_order_relaxed);
+            if (target != 1.0f || handle->rtCurrentGain != 1.0f) {
+                handle->rtCurrentGain = applyFocusGain(
+                    samples, frames, handle->channels, handle->rtCurrentGain, target);
+                handle->profiler.lap(ProcessProfiler::Gain);
+            }
         }
     }
 
+    // Track complete underruns for adaptive buffer growth
+    if (bytesRead == 0)
+        handle->underrunCount.fetch_add(1, std::memory_order_relaxed);
+
     // Silence-fill any gap — PipeWire graph timing is fixed by quantum/rate,
     // so we must always output a full period to avoid tempo wobble.
-    if (bytesRead < wantBytes)
-        std::memset(static_cast<uint8_t*>(d.data) + bytesRead, 0, wantBytes - bytesRead);
+    // All-zero bytes are also 0.0f, so this serves both formats.
+    if (bytesWritten < wantBytes)
+        std::memset(static_cast<uint8_t*>(d.data) + bytesWritten, 0, wantBytes - bytesWritten);
 
     d.chunk->offset = 0;
     d.chunk->stride = stride;
     d.chunk->size = wantBytes;
     buf->size = n_frames;
+    handle->profiler.lap(ProcessProfiler::RingRead);
 
     // --- Adaptive rate matching (clock drift compensation) ---
     // The phone's audio clock and PipeWire's graph clock drift independently.
     // We steer PipeWire's built-in adaptive resampler via pw_stream_set_rate()
-    // to keep the ring buffer fill level near the target (50% of capacity).
+    // to keep the ring buffer fill level near the target: the jitter buffer's
+    // adaptive delay, or 25% of capacity for untimed producers. With a jitter
+    // buffer the measured drift is fed forward (see AudioRateController).
     // Opt-out per handle (e.g. BT A2DP loopback tap owns its own clocking).
     if (!handle->disableRateMatching) {
-        uint32_t avail = handle->ringBuffer->available();
-
-        // Track activity and update EMA every callback for proper smoothing
-        if (bytesRead > 0)
-            handle->activeCallbacks++;
-
-        float fillNorm = static_cast<float>(avail) /
-                         static_cast<float>(handle->ringBuffer->capacity());
-        constexpr float alpha = 0.02f; // ~50 callback time constant (~1s)
-        handle->filteredFill += alpha * (fillNorm - handle->filteredFill);
-
-        // Apply rate correction every ~16 callbacks (~340ms)
-        handle->rateCtlCount++;
-        if (handle->rateCtlCount >= 16) {
-            bool active = handle->activeCallbacks > 0;
-            handle->activeCallbacks = 0;
-            handle->rateCtlCount = 0;
-
-            if (active) {
-                // Target 25% fill — with 500ms buffer this is ~125ms of audio.
-                // The phone naturally delivers at roughly playback rate, so the
-                // buffer settles around 20%. Targeting too high (75%) saturates
-                // the integrator and prevents the controller from responding to
-                // actual variations.
-                float error = handle->filteredFill - 0.25f;
-
-                // PI controller — gentle gains to avoid oscillation
-                constexpr float kP = 0.001f;
-                constexpr float kI = 0.00005f;
-
-                handle->rateIntegral += error;
-                // Anti-windup
-                if (handle->rateIntegral > 10.0f) handle->rateIntegral = 10.0f;
-                if (handle->rateIntegral < -10.0f) handle->rateIntegral = -10.0f;
-
-                float correction = (kP * error) + (kI * handle->rateIntegral);
-
-                // Clamp to ±5000 ppm (±0.5%)
-                if (correction > 0.005f) correction = 0.005f;
-                if (correction < -0.005f) correction = -0.005f;
-
-                double newRate = 1.0 + static_cast<double>(correction);
-                pw_stream_set_rate(handle->stream, newRate);
-
+        const uint32_t avail = handle->ringBuffer->available();
+        const uint32_t ringFrameBytes = static_cast<uint32_t>(handle->bytesPerFrame);
+
+        AudioRateController::Input input;
+        input.nowUs = static_cast<int64_t>(ProcessProfiler::nowNs() / 1000);
+        // Without a resampler request the period says nothing about the
+        // graph clock.
+        input.frames = buf->requested > 0 ? n_frames : 0;
+        input.hadData = bytesRead > 0;
+        input.bufferedFrames = avail / ringFrameBytes;
+        input.targetFrames = handle->jitterBuffer
+            ? handle->jitterBuffer->targetFrames()
+            : handle->ringBuffer->capacity() / 4 / ringFrameBytes;
+        if (handle->jitterBuffer)
+            input.sourceDriftValid = handle->jitterBuffer->sourceDrift(input.sourceDriftPpm);
+
+        AudioRateController::Update update;
+        if (handle->rateController.process(input, update)) {
+            pw_stream_set_rate(handle->stream, update.rate);
+            if (update.active) {
                 handle->rateAvailableBytes.store(avail, std::memory_order_relaxed);
                 handle->rateFillPermille.store(
-                    static_cast<int32_t>(std::lround(handle->filteredFill * 1000.0f)),
+                    static_cast<int32_t>(uint64_t(avail) * 1000u
+                                         / handle->ringBuffer->capacity()),
+                    std::memory_order_relaxed);
+                const int32_t correctionPpm =
+                    static_cast<int32_t>(std::lround(update.correctionPpm));
+                handle->rateCorrectionPpm.store(correctionPpm, std::memory_order_relaxed);
+                handle->rateDriftPpm.store(static_cast<int32_t>(std::lround(update.driftPpm)),
+                                           std::memory_order_relaxed);
+                handle->rateSourceDriftPpm.store(
+                    static_cast<int32_t>(std::lround(input.sourceDriftPpm)),
+                    std::memory_order_relaxed);
+                handle->rateGraphDriftPpm.store(
+                    static_cast<int32_t>(std::lround(handle->rateController.graphClock().ppm())),
                     std::memory_order_relaxed);
-                handle->rateCorrectionPpm.store(
-                    static_cast<int32_t>(std::lround(correction * 1000000.0f)),
+                const int64_t convergenceUs = handle->rateController.convergenceUs();
+                handle->rateConvergenceMs.store(
+                    convergenceUs < 0 ? -1 : static_cast<int32_t>(convergenceUs / 1000),
                     std::memory_order_relaxed);
+                const uint64_t bufferedUs = uint64_t(avail) * 1000000u
+                    / (uint64_t(handle->bytesPerFrame) * uint64_t(handle->sampleRate));
+                handle->rateBufferedUs.record(bufferedUs);
+                if (handle->rateController.settled())
+                    handle->rateSettledBufferedUs.record(bufferedUs);
+                handle->rateCorrectionAbsPpm.record(
+                    static_cast<uint64_t>(correctionPpm < 0 ? -correctionPpm : correctionPpm));
                 handle->rateDiagnosticUpdates.fetch_add(1, std::memory_order_relaxed);
             } else {
-                handle->filteredFill = 0.25f;
-                handle->rateIntegral = 0.0f;
-                pw_stream_set_rate(handle->stream, 1.0);
+                handle->rateConvergenceMs.store(-1, std::memory_order_relaxed);
             }
         }
+        handle->profiler.lap(ProcessProfiler::RateMatch);
     }
 
     return true;
 }
 
+uint32_t AudioService::fillFloatPeriod(AudioStreamHandle* handle, float* out, uint32_t frames,
+                                       uint32_t& ringSamples)
+{
+    // One pass per chunk: the int16 → float conversion lands directly in the
+    // PipeWire buffer (inside the EQ when one is attached), and focus gain
+    // scales the chunk while it is still in cache. No int16 re-quantization.
+    const uint32_t channels = static_cast<uint32_t>(handle->channels);
+    const uint32_t wantSamples = frames * channels;
+    const uint32_t chunkLimit = AudioStreamHandle::kFloatChunkFrames * channels;
+    const float target = handle->targetGain.load(std::memory_order_relaxed);
+    int16_t* staging = handle->rtFloatStaging.data();
+
+    uint32_t samplesOut = 0;
+    while (samplesOut < wantSamples) {
+        const uint32_t chunkSamples = std::min(wantSamples - samplesOut, chunkLimit);
+        uint32_t got = 0;
+        if (handle->jitterBuffer) {
+            const uint32_t chunkFrames = chunkSamples / channels;
+            ringSamples += handle->jitterBuffer->pull(staging, chunkFrames) * channels;
+            got = chunkFrames * channels;
+        } else {
+            got = handle->ringBuffer->read(
+                reinterpret_cast<uint8_t*>(staging),
+                chunkSamples * sizeof(int16_t)) / sizeof(int16_t);
+            ringSamples += got;
+        }
+        handle->profiler.lap(ProcessProfiler::RingRead);
+        if (got == 0)
+            break;
+
+        float* dst = out + samplesOut;
+        const int chunkFrames = static_cast<int>(got / channels);
+        const uint32_t framed = static_cast<uint32_t>(chunkFrames) * channels;
+        if (handle->eqEngine && chunkFrames > 0)
+            handle->eqEngine->process(staging, dst, chunkFrames);
+        else
+            convertS16ToF32(staging, dst, static_cast<int>(framed));
+        // A trailing partial frame (short ring read) bypasses EQ and gain.
+        convertS16ToF32(staging + framed, dst + framed, static_cast<int>(got - framed));
+        handle->profiler.lap(ProcessProfiler::Equalizer);
+
+        if (target != 1.0f || handle->rtCurrentGain != 1.0f) {
+            handle->rtCurrentGain = applyFocusGain(
+                dst, chunkFrames, handle->channels, handle->rtCurrentGain, target);
+            handle->profiler.lap(ProcessProfiler::Gain);
+        }
+
+        samplesOut += got;
+        if (got < chunkSamples)
+            break;
+    }
+    return samplesOut;
+}
+
 uint32_t AudioService::playbackRingCapacityBytes(int sampleRate, int channels,
                                                   int bufferMs,
                                                   int* normalizedBufferMs)
@@ -414,11 +564,27 @@ AudioStreamHandle* AudioService::createStreamWithOptions(const PlaybackStreamOpt
     handle->priority = opts.priority;
     handle->sampleRate = opts.sampleRate;
     handle->channels = channels;
-    handle->bytesPerFrame = channels * 2; // 16-bit PCM
+    handle->bytesPerFrame = channels * 2; // 16-bit PCM in the ring
+    handle->floatOutput = floatOutput_;
     handle->eqEngine = opts.eqEngine;                     // attached BEFORE connect
     handle->disableRateMatching = opts.disableRateMatching;
+    handle->rateController = AudioRateController(opts.sampleRate);
     handle->onStreamError = opts.onStreamError;
     handle->errorContext = opts.errorContext;
+    if (!handle->disableRateMatching) {
+        auto& registry = MetricsRegistry::instance();
+        handle->rateMetricsRegistrations[0] = registry.add(
+            QStringLiteral("audio.buffered"), opts.name, QStringLiteral("us"),
+            &handle->rateBufferedUs);
+        handle->rateMetricsRegistrations[1] = registry.add(
+            QStringLiteral("audio.rate_correction"), opts.name, QStringLiteral("ppm"),
+            &handle->rateCorrectionAbsPpm);
+        handle->rateMetricsRegistrations[2] = registry.add(
+            QStringLiteral("audio.buffered_settled"), opts.name, QStringLiteral("us"),
+            &handle->rateSettledBufferedUs);
+    }
+    handle->profiler.setStageTiming(stageProfiling_);
+    handle->profiler.registerMetrics(opts.name);
 
     // Static, bounded creation-time ring. AA sends audio in bursts over TCP;
     // 500 ms preserves the existing effective floor while the upper bound
@@ -426,6 +592,11 @@ AudioStreamHandle* AudioService::createStreamWithOptions(const PlaybackStreamOpt
     handle->bufferMs = normalizedBufferMs;
     try {
         handle->ringBuffer = std::make_unique<AudioRingBuffer>(ringCapacity);
+        if (opts.jitterBuffer) {
+            handle->jitterBuffer = std::make_unique<AudioJitterBuffer>(
+                *handle->ringBuffer, opts.sampleRate, channels,
+                opts.jitterMinMs, opts.jitterMaxMs);
+        }
     } catch (const std::bad_alloc&) {
         qCWarning(lcAudio) << "AudioService: Ring buffer allocation failed for"
                            << opts.name << ringCapacity << "bytes";
@@ -433,7 +604,13 @@ AudioStreamHandle* AudioService::createStreamWithOptions(const PlaybackStreamOpt
         return nullptr;
     }
     qCDebug(lcAudio) << "AudioService: Ring buffer for" << opts.name << ":"
-                     << ringCapacity << "bytes (" << normalizedBufferMs << "ms)";
+                     << ringCapacity << "bytes (" << normalizedBufferMs << "ms)"
+                     << (handle->jitterBuffer ? "jitter buffer" : "");
+    if (handle->jitterBuffer) {
+        handle->jitterRegistration = MetricsRegistry::instance().add(
+            QStringLiteral("audio.jitter"), opts.name, QStringLiteral("us"),
+            &handle->jitterBuffer->jitter());
+    }
 
     // Determine PipeWire role based on stream name
     const char* role = "Music";
@@ -478,7 +655,7 @@ AudioStreamHandle* AudioService::createStreamWithOptions(const PlaybackStreamOpt
     struct spa_pod_builder b = SPA_POD_BUILDER_INIT(paramBuf, sizeof(paramBuf));
 
     struct spa_audio_info_raw rawInfo{};
-    rawInfo.format = SPA_AUDIO_FORMAT_S16_LE;
+    rawInfo.format = handle->floatOutput ? SPA_AUDIO_FORMAT_F32 : SPA_AUDIO_FORMAT_S16_LE;
     rawInfo.rate = static_cast<uint32_t>(opts.sampleRate);
     rawInfo.channels = static_cast<uint32_t>(channels);
 
@@ -557,6 +734,20 @@ int AudioService::writeAudio(AudioStreamHandle* handle, const uint8_t* data, int
     return static_cast<int>(handle->ringBuffer->write(data, static_cast<uint32_t>(size)));
 }
 
+int AudioService::writeTimedAudio(AudioStreamHandle* handle, const uint8_t* data, int size,
+                                  uint64_t timestampUs)
+{
+    if (!handle || !handle->jitterBuffer)
+        return writeAudio(handle, data, size);
+    if (!data || size <= 0)
+        return -1;
+
+    const int64_t arrivalUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return static_cast<int>(handle->jitterBuffer->push(
+        data, static_cast<uint32_t>(size), timestampUs, arrivalUs));
+}
+
 // ---- Volume & Audio Focus ----
 
 void AudioService::applyVolumeToStream(AudioStreamHandle* handle, float vol)
@@ -737,6 +928,7 @@ void AudioService::onCaptureProcess(void* userdata)
     if (!handle || !handle->stream)
         return;
 
+    handle->profiler.begin(ProcessProfiler::nowNs());
     struct pw_buffer* buf = pw_stream_dequeue_buffer(handle->stream);
     if (!buf) return;
 
@@ -756,6 +948,10 @@ void AudioService::onCaptureProcess(void* userdata)
         handle->captureCallback(payload, payloadSize);
     }
 
+    const uint32_t frames = handle->bytesPerFrame > 0
+        ? static_cast<uint32_t>(payloadSize / handle->bytesPerFrame) : 0u;
+    handle->profiler.end(ProcessProfiler::nowNs(), frames,
+                         static_cast<uint32_t>(handle->sampleRate));
     pw_stream_queue_buffer(handle->stream, buf);
 }
 
@@ -800,6 +996,7 @@ AudioStreamHandle* AudioService::openCaptureStreamWithOptions(const CaptureStrea
     // silently eating BT audio. Set before connect, never mutated (PW-thread safe).
     handle->onStreamError = opts.onStreamError;
     handle->errorContext = opts.errorContext;
+    handle->profiler.registerMetrics(opts.name);
 
     pw_thread_loop_lock(threadLoop_);
 
@@ -972,6 +1169,13 @@ void AudioService::reportAudioDiagnostics()
             ? handle->ringBuffer->resetDropCount() : 0u;
         uint32_t updates = handle->rateDiagnosticUpdates.exchange(
             0, std::memory_order_relaxed);
+        const LatencyHistogram::Snapshot buffered = handle->rateBufferedWindow.take();
+        const LatencyHistogram::Snapshot correction = handle->rateCorrectionWindow.take();
+        const LatencyHistogram::Snapshot settled = handle->rateSettledWindow.take();
+        logProcessTiming(handle->name, handle->floatOutput ? "f32" : "s16",
+                         handle->profiler.take(), handle->profiler.stageTiming());
+        if (handle->jitterBuffer)
+            logJitterBuffer(handle->name, *handle->jitterBuffer);
         if (xruns == 0 && drops == 0 && updates == 0)
             continue;
 
@@ -984,8 +1188,16 @@ void AudioService::reportAudioDiagnostics()
                          << handle->rateAvailableBytes.load(std::memory_order_relaxed)
                          << "/" << (handle->ringBuffer
                              ? handle->ringBuffer->capacity() : 0u)
+                         << "buffered ms p50/p99"
+                         << QStringLiteral("%1/%2")
+                                .arg(buffered.percentile(50.0) / 1000.0, 0, 'f', 1)
+                                .arg(buffered.percentile(99.0) / 1000.0, 0, 'f', 1)
+                         << "correction ppm p99" << correction.percentile(99.0)
                          << "underruns" << xruns << "drops" << drops;
+        logRateDrift(handle->name, *handle, settled);
     }
+    for (auto* handle : captures_)
+        logProcessTiming(handle->name, "capture", handle->profiler.take(), false);
 }
 
 // ---- Device disconnect handling ----
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "IAudioService.hpp"
+#include "core/audio/AudioJitterBuffer.hpp"
+#include "core/audio/AudioRateController.hpp"
 #include "core/audio/AudioRingBuffer.hpp"
 #include "core/audio/PipeWireDeviceRegistry.hpp"
+#include "core/audio/ProcessProfiler.hpp"
+#include "core/MetricsRegistry.hpp"
 #include <QObject>
 #include <QMutex>
 #include <QList>
 #include <QTimer>
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -40,11 +45,9 @@ struct AudioStreamHandle {
     // Underrun tracking (written on PW RT thread, read on Qt main thread)
     std::atomic<uint32_t> underrunCount{0};
 
-    // Rate matching state (PW RT thread only, no atomics needed)
-    uint32_t rateCtlCount = 0;
-    uint32_t activeCallbacks = 0; // callbacks with data in current window
-    float filteredFill = 0.5f;    // EMA of normalized fill level
-    float rateIntegral = 0.0f;    // PI controller integral term
+    // Rate matching state (PW RT thread only, no atomics needed). Built
+    // with the stream's sample rate before connect.
+    AudioRateController rateController;
 
     // Primitive RT diagnostics. The process callback only stores atomics; the
     // Qt-owner diagnostic timer consumes and logs them.
@@ -52,14 +55,46 @@ struct AudioStreamHandle {
     std::atomic<uint32_t> rateAvailableBytes{0};
     std::atomic<int32_t> rateFillPermille{0};
     std::atomic<int32_t> rateCorrectionPpm{0};
+    std::atomic<int32_t> rateDriftPpm{0};        // feed-forward part
+    std::atomic<int32_t> rateGraphDriftPpm{0};
+    std::atomic<int32_t> rateSourceDriftPpm{0};
+    std::atomic<int32_t> rateConvergenceMs{-1};  // -1 until settled
+    // Distributions over every rate update: buffered audio (ring fill, us)
+    // and |correction| (ppm), plus buffered audio once the controller has
+    // settled (steady-state depth). Windows are read by the diagnostic timer
+    // only; the histograms are also registered as audio.* metrics.
+    LatencyHistogram rateBufferedUs;
+    LatencyHistogram rateCorrectionAbsPpm;
+    LatencyHistogram rateSettledBufferedUs;
+    LatencyWindow rateBufferedWindow{rateBufferedUs};
+    LatencyWindow rateCorrectionWindow{rateCorrectionAbsPpm};
+    LatencyWindow rateSettledWindow{rateSettledBufferedUs};
+    MetricsRegistry::Registration rateMetricsRegistrations[3];
 
     // Format info for process callback
     int sampleRate = 48000;
     int channels = 2;
-    int bytesPerFrame = 4; // channels * sizeof(int16_t)
+    int bytesPerFrame = 4; // ring-buffer frame: channels * sizeof(int16_t)
+    // Negotiated SPA_AUDIO_FORMAT_F32 (audio.sample_format: f32). The ring
+    // stays int16; the process callback converts once into the PipeWire
+    // buffer and runs EQ and focus gain in float. Fixed before connect.
+    bool floatOutput = false;
+    // F32 staging for one ring read. Chunks keep the float pass in L1.
+    static constexpr int kFloatChunkFrames = 256;
+    std::array<int16_t, kFloatChunkFrames * 2> rtFloatStaging{};
+
+    // Process-callback duration, wake-up interval and load against the
+    // period (audio.process/interval/load), drained by the diagnostic timer.
+    ProcessProfiler profiler;
 
     // Ring buffer for ASIO → PipeWire bridging
     std::unique_ptr<oap::AudioRingBuffer> ringBuffer;
+    // Adaptive delay and gap concealment in front of the ring for timestamped
+    // network audio (AA channels). Created before connect when requested;
+    // writeTimedAudio() feeds it and the process callback pulls through it.
+    // Declared after ringBuffer, which it references.
+    std::unique_ptr<oap::AudioJitterBuffer> jitterBuffer;
+    MetricsRegistry::Registration jitterRegistration;
 
     // EQ engine — non-owning, set by orchestrator or createStreamWithOptions
     // (attached BEFORE pw_stream_connect when supplied via options).
@@ -120,6 +155,9 @@ public:
         EqualizerEngine* eqEngine = nullptr;   // attached BEFORE pw_stream_connect
         bool startInactive = false;            // adds PW_STREAM_FLAG_INACTIVE
         bool disableRateMatching = false;      // skips the PI controller + set_rate
+        bool jitterBuffer = false;             // adaptive delay + concealment (writeTimedAudio)
+        int jitterMinMs = 20;                  // target delay bounds for the jitter buffer
+        int jitterMaxMs = 200;
         std::function<void()> onStreamError;   // PW_STREAM_STATE_ERROR → Qt thread
         QObject* errorContext = nullptr;       // onStreamError receiver; queued call auto-cancels if it dies (qApp when null)
     };
@@ -151,6 +189,8 @@ public:
                                      int bufferMs = 50) override;
     void destroyStream(AudioStreamHandle* handle) override;
     int writeAudio(AudioStreamHandle* handle, const uint8_t* data, int size) override;
+    int writeTimedAudio(AudioStreamHandle* handle, const uint8_t* data, int size,
+                        uint64_t timestampUs) override;
     Q_INVOKABLE void setMasterVolume(int volume) override;
     Q_INVOKABLE int masterVolume() const override;
     void requestAudioFocus(AudioStreamHandle* handle, AudioFocusType type) override;
@@ -162,6 +202,15 @@ public:
     Q_INVOKABLE QString outputDevice() const override;
     Q_INVOKABLE QString inputDevice() const override;
 
+    /// Negotiate F32 instead of S16 for playback streams created afterwards.
+    void setFloatOutput(bool enabled) { floatOutput_ = enabled; }
+    bool floatOutput() const { return floatOutput_; }
+
+    /// Time the ring, EQ, gain and rate-matching stages of each playback
+    /// callback (audio.stage.*) for streams created afterwards.
+    void setStageProfiling(bool enabled) { stageProfiling_ = enabled; }
+    bool stageProfiling() const { return stageProfiling_; }
+
     /// Device registry — enumerates PipeWire sinks/sources
     PipeWireDeviceRegistry* deviceRegistry() { return &deviceRegistry_; }
 
@@ -230,6 +279,11 @@ private:
     // Real playback-buffer body, factored so malformed PipeWire structures can
     // be driven headlessly. Returns false without touching an invalid buffer.
     static bool fillPlaybackBuffer(AudioStreamHandle* handle, struct pw_buffer* buf);
+    // F32 half of fillPlaybackBuffer(): reads up to @p frames from the ring
+    // (or the jitter buffer) into @p out with EQ and focus gain applied.
+    // Returns samples written; @p ringSamples counts those that were audio.
+    static uint32_t fillFloatPeriod(AudioStreamHandle* handle, float* out, uint32_t frames,
+                                    uint32_t& ringSamples);
     // Total, bounded ring-capacity calculation. Returns 0 for an unsupported
     // sample rate or impossible size and writes the clamped buffer target.
     static uint32_t playbackRingCapacityBytes(int sampleRate, int channels,
@@ -252,6 +306,8 @@ private:
 
     QString outputDevice_ = "auto";
     QString inputDevice_ = "auto";
+    bool floatOutput_ = false;
+    bool stageProfiling_ = false;
 
     mutable QMutex mutex_;
     QList<AudioStreamHandle*> streams_;
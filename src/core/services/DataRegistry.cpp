@@ -4,9 +4,67 @@
 #include <QRegularExpression>
 
 #include <algorithm>
+#include <limits>
+#include <type_traits>
 
 namespace oap::data {
 
+namespace {
+
+Scalar fastScalar(ValueType type, const FastSample& sample) {
+    switch (type) {
+    case ValueType::SignedInteger:   return sample.value.integer;
+    case ValueType::UnsignedInteger: return sample.value.unsignedInteger;
+    case ValueType::Boolean:         return sample.value.boolean;
+    case ValueType::Enum:            return EnumScalar{sample.value.integer};
+    default:                         return sample.value.real;
+    }
+}
+
+bool usableQuality(Quality quality) {
+    return quality == Quality::Unknown || quality == Quality::Good
+        || quality == Quality::Degraded;
+}
+
+constexpr double kHistoryGap = std::numeric_limits<double>::quiet_NaN();
+// Channels without a nominal interval are sized as if published at 10 Hz.
+constexpr quint32 kDefaultHistoryIntervalMs = 100;
+
+qsizetype requestedHistoryPoints(const ChannelDefinition& definition) {
+    if (!definition.historyRetentionMs || *definition.historyRetentionMs == 0
+        || definition.valueType == ValueType::String) {
+        return 0;
+    }
+    const qint64 intervalMs = qMax<quint32>(
+        1, definition.nominalIntervalMs.value_or(kDefaultHistoryIntervalMs));
+    const qint64 points = (qint64(*definition.historyRetentionMs) + intervalMs - 1)
+        / intervalMs;
+    return qsizetype(qMin<qint64>(points, DataRegistry::kMaxHistoryPointsPerChannel));
+}
+
+double historyValue(const Sample& sample) {
+    if (!sample.value || !usableQuality(sample.quality)) return kHistoryGap;
+    return std::visit([](const auto& value) -> double {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, QString>) return kHistoryGap;
+        else if constexpr (std::is_same_v<T, EnumScalar>) return double(value.value);
+        else return double(value);
+    }, *sample.value);
+}
+
+double fastHistoryValue(ValueType type, const FastSample& sample) {
+    if (!sample.hasValue || !usableQuality(sample.quality)) return kHistoryGap;
+    switch (type) {
+    case ValueType::SignedInteger:
+    case ValueType::Enum:            return double(sample.value.integer);
+    case ValueType::UnsignedInteger: return double(sample.value.unsignedInteger);
+    case ValueType::Boolean:         return sample.value.boolean ? 1.0 : 0.0;
+    default:                         return sample.value.real;
+    }
+}
+
+} // namespace
+
 size_t qHash(const ChannelRef& ref, size_t seed) noexcept {
     seed = ::qHash(ref.providerNamespace, seed);
     return ::qHash(ref.channelName, seed);
@@ -55,6 +113,71 @@ const DataRegistry::ProviderState* DataRegistry::providerForOwner(
     return providerIt == providers_.cend() ? nullptr : &providerIt.value();
 }
 
+ChannelHandle DataRegistry::acquireSlot(OwnerToken owner,
+                                        const QString& providerNamespace,
+                                        const ChannelDefinition& definition) {
+    quint32 index;
+    if (!freeSlots_.isEmpty()) {
+        index = freeSlots_.takeLast();
+    } else {
+        if (slots_.size() >= kSlotMask) return 0;
+        index = quint32(slots_.size());
+        slots_.emplace_back();
+    }
+    ChannelSlot& slot = slots_[index];
+    slot.owner = owner;
+    slot.live = true;
+    slot.valueType = definition.valueType;
+    slot.providerNamespace = providerNamespace;
+    slot.channelName = definition.channelName;
+    slot.latest.reset();
+    slot.lastIndex = -1;
+    allocateHistory(slot, definition);
+    return (slot.generation << kSlotBits) | (index + 1);
+}
+
+void DataRegistry::releaseSlot(ChannelHandle handle) {
+    const quint32 index = slotIndex(handle);
+    ChannelSlot& slot = slots_[index];
+    slot.live = false;
+    slot.owner = 0;
+    slot.latest.reset();
+    releaseHistory(slot);
+    slot.generation = (slot.generation + 1) & (0xFFFFFFFFu >> kSlotBits);
+    freeSlots_.append(index);
+}
+
+void DataRegistry::allocateHistory(ChannelSlot& slot,
+                                   const ChannelDefinition& definition) {
+    const qsizetype granted = qMin(
+        requestedHistoryPoints(definition),
+        qMax<qsizetype>(0, historyBudgetPoints_ - historyPointsInUse_));
+    slot.history = HistoryRing(granted);
+    historyPointsInUse_ += granted;
+}
+
+void DataRegistry::releaseHistory(ChannelSlot& slot) {
+    historyPointsInUse_ -= slot.history.capacity();
+    slot.history = HistoryRing();
+}
+
+DataRegistry::ChannelSlot* DataRegistry::slotFor(OwnerToken owner,
+                                                 ChannelHandle handle) {
+    const quint32 index = handle & kSlotMask;
+    if (index == 0 || index > slots_.size()) return nullptr;
+    ChannelSlot& slot = slots_[index - 1];
+    if (!slot.live || slot.owner != owner
+        || slot.generation != (handle >> kSlotBits)) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+const DataRegistry::ChannelSlot& DataRegistry::slotFor(
+    ChannelHandle handle) const {
+    return slots_[slotIndex(handle)];
+}
+
 RegistrationResult DataRegistry::registerProvider(
     OwnerToken owner, const ProviderDefinition& definition) {
     if (!validIdentifier(definition.providerNamespace))
@@ -125,20 +248,39 @@ QList<DeclarationResult> DataRegistry::declareChannels(
             continue;
         }
 
-        result.accepted = true;
-        results.append(result);
         if (channelIt != provider->channels.end()
             && channelIt->definition == definition) {
+            result.accepted = true;
+            result.handle = channelIt->handle;
+            results.append(result);
             continue;
         }
 
         if (channelIt == provider->channels.end()) {
             ChannelState state;
             state.definition = definition;
+            state.handle = acquireSlot(owner, provider->definition.providerNamespace,
+                                       definition);
+            if (state.handle == 0) {
+                result.reason = QStringLiteral("channel limit reached");
+                results.append(result);
+                continue;
+            }
             provider->channels.insert(definition.channelName, state);
+            result.handle = state.handle;
         } else {
+            // A new retention or rate resizes the history, which starts over.
+            if (requestedHistoryPoints(channelIt->definition)
+                != requestedHistoryPoints(definition)) {
+                ChannelSlot& slot = slots_[slotIndex(channelIt->handle)];
+                releaseHistory(slot);
+                allocateHistory(slot, definition);
+            }
             channelIt->definition = definition;
+            result.handle = channelIt->handle;
         }
+        result.accepted = true;
+        results.append(result);
         if (!changedNames.contains(definition.channelName)) {
             changedNames.insert(definition.channelName);
             changedOrder.append(definition.channelName);
@@ -167,8 +309,11 @@ void DataRegistry::removeChannels(OwnerToken owner,
     for (const QString& channelName : channelNames) {
         if (seen.contains(channelName)) continue;
         seen.insert(channelName);
-        if (provider->channels.remove(channelName) > 0)
-            removed.append(channelName);
+        const auto channelIt = provider->channels.constFind(channelName);
+        if (channelIt == provider->channels.cend()) continue;
+        releaseSlot(channelIt->handle);
+        provider->channels.erase(channelIt);
+        removed.append(channelName);
     }
     if (removed.isEmpty()) return;
 
@@ -208,10 +353,7 @@ PublishResult DataRegistry::publish(OwnerToken owner,
             continue;
         }
 
-        const bool usable = accepted.quality == Quality::Unknown
-            || accepted.quality == Quality::Good
-            || accepted.quality == Quality::Degraded;
-        if (usable && !accepted.value.has_value()) {
+        if (usableQuality(accepted.quality) && !accepted.value.has_value()) {
             result.diagnostics.append(
                 {accepted.channelName, QStringLiteral("usable quality requires value")});
             continue;
@@ -225,7 +367,9 @@ PublishResult DataRegistry::publish(OwnerToken owner,
         if (!accepted.observedAtUnixMs.has_value())
             accepted.observedAtUnixMs = nowUnixMs_();
 
-        channelIt->latest = accepted;
+        ChannelSlot& slot = slots_[slotIndex(channelIt->handle)];
+        slot.latest = accepted;
+        slot.history.append(*accepted.observedAtUnixMs, historyValue(accepted));
         result.acceptedSamples.append(std::move(accepted));
     }
 
@@ -236,6 +380,68 @@ PublishResult DataRegistry::publish(OwnerToken owner,
     return result;
 }
 
+FastPublishResult DataRegistry::publishFast(OwnerToken owner,
+                                            const FastSample* samples,
+                                            qsizetype count) {
+    FastPublishResult result;
+    // Last sample per channel wins, as in publish(): mark each slot with its
+    // last index in this batch, then accept only the marked ones.
+    for (qsizetype i = 0; i < count; ++i) {
+        if (ChannelSlot* slot = slotFor(owner, samples[i].channel))
+            slot->lastIndex = i;
+    }
+
+    fastAccepted_.clear();
+    QString providerNamespace;
+    std::optional<qint64> now;
+    for (qsizetype i = 0; i < count; ++i) {
+        const FastSample& sample = samples[i];
+        ChannelSlot* slot = slotFor(owner, sample.channel);
+        if (!slot) {
+            ++result.rejected;
+            continue;
+        }
+        if (slot->lastIndex != i) continue;
+        if ((usableQuality(sample.quality) && !sample.hasValue)
+            || (sample.hasValue && slot->valueType == ValueType::String)) {
+            ++result.rejected;
+            continue;
+        }
+
+        Sample& latest = slot->latest.emplace();
+        latest.channelName = slot->channelName;
+        if (sample.hasValue) latest.value = fastScalar(slot->valueType, sample);
+        latest.quality = sample.quality;
+        if (sample.observedAtUnixMs != 0) {
+            latest.observedAtUnixMs = sample.observedAtUnixMs;
+        } else {
+            if (!now) now = nowUnixMs_();
+            latest.observedAtUnixMs = *now;
+        }
+        slot->history.append(*latest.observedAtUnixMs,
+                             fastHistoryValue(slot->valueType, sample));
+        fastAccepted_.append(latest);
+        providerNamespace = slot->providerNamespace;
+        ++result.accepted;
+    }
+
+    if (result.accepted > 0) {
+        // Shared for the emission, so a receiver that publishes again gets a
+        // fresh list; afterwards the next batch reuses this one's capacity.
+        const QList<Sample> accepted = fastAccepted_;
+        emit valuesAccepted(providerNamespace, accepted);
+    }
+    return result;
+}
+
+ChannelHandle DataRegistry::channelHandle(OwnerToken owner,
+                                          const QString& channelName) const {
+    const ProviderState* provider = providerForOwner(owner);
+    if (!provider) return 0;
+    const auto channelIt = provider->channels.constFind(channelName);
+    return channelIt == provider->channels.cend() ? 0 : channelIt->handle;
+}
+
 void DataRegistry::removeOwner(OwnerToken owner) {
     const auto namespaceIt = ownerNamespaces_.find(owner);
     if (namespaceIt == ownerNamespaces_.end()) return;
@@ -246,6 +452,8 @@ void DataRegistry::removeOwner(OwnerToken owner) {
     if (providerIt == providers_.end()) return;
     QStringList channelNames = providerIt->channels.keys();
     std::sort(channelNames.begin(), channelNames.end());
+    for (const ChannelState& channel : std::as_const(providerIt->channels))
+        releaseSlot(channel.handle);
     providers_.erase(providerIt);
 
     ++revision_;
@@ -291,7 +499,16 @@ std::optional<Sample> DataRegistry::latestSample(const ChannelRef& ref) const {
     if (providerIt == providers_.cend()) return std::nullopt;
     const auto channelIt = providerIt->channels.constFind(ref.channelName);
     if (channelIt == providerIt->channels.cend()) return std::nullopt;
-    return channelIt->latest;
+    return slotFor(channelIt->handle).latest;
+}
+
+const HistoryRing* DataRegistry::history(const ChannelRef& ref) const {
+    const auto providerIt = providers_.constFind(ref.providerNamespace);
+    if (providerIt == providers_.cend()) return nullptr;
+    const auto channelIt = providerIt->channels.constFind(ref.channelName);
+    if (channelIt == providerIt->channels.cend()) return nullptr;
+    const HistoryRing& ring = slotFor(channelIt->handle).history;
+    return ring.capacity() > 0 ? &ring : nullptr;
 }
 
 bool DataRegistry::providerExists(const QString& providerNamespace) const {
@@ -3,7 +3,8 @@
 // DataRegistry — main-thread live state for generic external data providers.
 //
 // The registry knows provider/channel identity, typed scalar compatibility,
-// catalog revisions, and one retained sample per active channel. It has no
+// catalog revisions, one retained sample per active channel, and an optional
+// bounded history of numeric values (HistoryRing.hpp). It has no
 // socket, protobuf, authentication, widget, EventBus, D-Bus, OBD/CAN, or
 // persistence dependency. ApiDataBridge supplies opaque session owner tokens
 // and translates public protobuf messages at the boundary.
@@ -16,9 +17,12 @@
 #include <QStringList>
 #include <QtGlobal>
 
+#include "core/services/HistoryRing.hpp"
+
 #include <functional>
 #include <optional>
 #include <variant>
+#include <vector>
 
 namespace oap::data {
 
@@ -100,6 +104,9 @@ struct ChannelDefinition {
     std::optional<double> suggestedMinimum;
     std::optional<double> suggestedMaximum;
     QList<EnumOption> enumOptions;
+    // Requested history, as this long at nominalIntervalMs. Numeric,
+    // Boolean and Enum channels only.
+    std::optional<quint32> historyRetentionMs;
 
     friend bool operator==(const ChannelDefinition& left,
                            const ChannelDefinition& right) {
@@ -112,7 +119,8 @@ struct ChannelDefinition {
             && left.staleAfterMs == right.staleAfterMs
             && left.suggestedMinimum == right.suggestedMinimum
             && left.suggestedMaximum == right.suggestedMaximum
-            && left.enumOptions == right.enumOptions;
+            && left.enumOptions == right.enumOptions
+            && left.historyRetentionMs == right.historyRetentionMs;
     }
 };
 
@@ -123,6 +131,27 @@ struct Sample {
     Quality quality = Quality::Unknown;
 };
 
+// Index of one declared channel for publishFast(), issued by
+// declareChannels(). 0 is never issued. A handle dies with its channel; its
+// slot is reused with a new generation, so a stale handle is rejected.
+using ChannelHandle = quint32;
+
+// Fixed-size sample for publishFast(). The channel's declared type selects
+// the meaningful member of value; Enum uses integer. String channels take
+// the Sample path only.
+struct FastSample {
+    ChannelHandle channel = 0;
+    Quality quality = Quality::Good;
+    bool hasValue = true;
+    qint64 observedAtUnixMs = 0;   // 0 = stamped on receipt
+    union {
+        double real;
+        qint64 integer;
+        quint64 unsignedInteger;
+        bool boolean;
+    } value{};
+};
+
 struct ProviderCatalog {
     ProviderDefinition provider;
     QList<ChannelDefinition> channels;
@@ -142,6 +171,7 @@ struct DeclarationResult {
     QString channelName;
     bool accepted = false;
     QString reason;
+    ChannelHandle handle = 0;   // set when accepted
 };
 
 struct PublishDiagnostic {
@@ -154,6 +184,11 @@ struct PublishResult {
     QList<PublishDiagnostic> diagnostics;
 };
 
+struct FastPublishResult {
+    int accepted = 0;
+    int rejected = 0;   // stale or foreign handle, missing value, String channel
+};
+
 class DataRegistry final : public QObject {
     Q_OBJECT
 public:
@@ -165,6 +200,14 @@ public:
         OwnerToken owner, const QList<ChannelDefinition>& definitions);
     void removeChannels(OwnerToken owner, const QStringList& channelNames);
     PublishResult publish(OwnerToken owner, const QList<Sample>& samples);
+    // High-rate ingest for in-process providers. Same validation, duplicate
+    // reduction and valuesAccepted() as publish(), but channels are resolved
+    // by handle and nothing is hashed or allocated per sample. Rejections
+    // are counted, not described.
+    FastPublishResult publishFast(OwnerToken owner, const FastSample* samples,
+                                  qsizetype count);
+    ChannelHandle channelHandle(OwnerToken owner,
+                                const QString& channelName) const;
     void removeOwner(OwnerToken owner);
 
     quint64 catalogRevision() const { return revision_; }
@@ -172,6 +215,18 @@ public:
     std::optional<ChannelDefinition> definition(const ChannelRef& ref) const;
     std::optional<Sample> latestSample(const ChannelRef& ref) const;
     bool providerExists(const QString& providerNamespace) const;
+    // The channel's history ring, or nullptr without one. Valid until the
+    // next declaration or removal.
+    const HistoryRing* history(const ChannelRef& ref) const;
+
+    // Every ring together holds at most this many points; channels declared
+    // once it is spent get a smaller ring or none. Applies to later
+    // declarations.
+    static constexpr qsizetype kDefaultHistoryBudgetPoints = 512 * 1024;
+    static constexpr qsizetype kMaxHistoryPointsPerChannel = 64 * 1024;
+    void setHistoryBudgetPoints(qsizetype points) { historyBudgetPoints_ = points; }
+    qsizetype historyBudgetPoints() const { return historyBudgetPoints_; }
+    qsizetype historyPointsInUse() const { return historyPointsInUse_; }
 
     void setNowUnixMsForTest(std::function<qint64()> nowUnixMs) {
         nowUnixMs_ = std::move(nowUnixMs);
@@ -189,9 +244,30 @@ signals:
 private:
     struct ChannelState {
         ChannelDefinition definition;
+        ChannelHandle handle = 0;
+    };
+
+    // Per-channel state reachable from a handle without hashing. Owns the
+    // retained sample for both publish paths.
+    struct ChannelSlot {
+        OwnerToken owner = 0;
+        quint32 generation = 0;
+        bool live = false;
+        ValueType valueType = ValueType::Unspecified;
+        QString providerNamespace;
+        QString channelName;
         std::optional<Sample> latest;
+        HistoryRing history;
+        // publishFast() duplicate reduction: index of this channel's last
+        // sample in the batch being published. Only read for slots the same
+        // call has just set, so it needs no reset between batches.
+        qsizetype lastIndex = -1;
     };
 
+    static constexpr int kSlotBits = 20;
+    static constexpr quint32 kSlotMask = (1u << kSlotBits) - 1;
+    static quint32 slotIndex(ChannelHandle handle) { return (handle & kSlotMask) - 1; }
+
     struct ProviderState {
         OwnerToken owner = 0;
         ProviderDefinition definition;
@@ -202,10 +278,22 @@ private:
     static bool scalarMatches(ValueType type, const Scalar& scalar);
     ProviderState* providerForOwner(OwnerToken owner);
     const ProviderState* providerForOwner(OwnerToken owner) const;
+    ChannelHandle acquireSlot(OwnerToken owner, const QString& providerNamespace,
+                              const ChannelDefinition& definition);
+    void releaseSlot(ChannelHandle handle);
+    void allocateHistory(ChannelSlot& slot, const ChannelDefinition& definition);
+    void releaseHistory(ChannelSlot& slot);
+    ChannelSlot* slotFor(OwnerToken owner, ChannelHandle handle);
+    const ChannelSlot& slotFor(ChannelHandle handle) const;
 
     QHash<QString, ProviderState> providers_;
     QHash<OwnerToken, QString> ownerNamespaces_;
+    std::vector<ChannelSlot> slots_;
+    QList<quint32> freeSlots_;
+    QList<Sample> fastAccepted_;   // reused by publishFast()
     quint64 revision_ = 0;
+    qsizetype historyBudgetPoints_ = kDefaultHistoryBudgetPoints;
+    qsizetype historyPointsInUse_ = 0;
     std::function<qint64()> nowUnixMs_;
 };
 
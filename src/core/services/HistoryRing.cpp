@@ -0,0 +1,133 @@
+#include "core/services/HistoryRing.hpp"
+
+#include <cmath>
+
+namespace oap::data {
+
+HistoryRing::HistoryRing(qsizetype capacity)
+    : capacity_(qMax<qsizetype>(0, capacity)) {
+    points_.reserve(size_t(capacity_));
+}
+
+bool HistoryRing::append(qint64 observedAtUnixMs, double value) {
+    if (capacity_ == 0) return false;
+    if (!points_.empty() && observedAtUnixMs < at(size() - 1).observedAtUnixMs)
+        return false;
+    if (size() < capacity_) {
+        points_.push_back({observedAtUnixMs, value});
+        return true;
+    }
+    points_[size_t(start_)] = {observedAtUnixMs, value};
+    start_ = (start_ + 1) % capacity_;
+    return true;
+}
+
+void HistoryRing::clear() {
+    points_.clear();
+    start_ = 0;
+}
+
+qsizetype HistoryRing::lowerBound(qint64 unixMs) const {
+    qsizetype low = 0;
+    qsizetype high = size();
+    while (low < high) {
+        const qsizetype middle = low + (high - low) / 2;
+        if (at(middle).observedAtUnixMs < unixMs) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+qsizetype HistoryRing::upperBound(qint64 unixMs) const {
+    qsizetype low = 0;
+    qsizetype high = size();
+    while (low < high) {
+        const qsizetype middle = low + (high - low) / 2;
+        if (at(middle).observedAtUnixMs <= unixMs) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+QList<HistoryPoint> HistoryRing::range(qint64 fromUnixMs, qint64 toUnixMs,
+                                       qsizetype maxPoints) const {
+    QList<HistoryPoint> result;
+    if (fromUnixMs > toUnixMs) return result;
+    const qsizetype end = upperBound(toUnixMs);
+    qsizetype first = lowerBound(fromUnixMs);
+    if (maxPoints > 0) first = qMax(first, end - maxPoints);
+    result.reserve(qMax<qsizetype>(0, end - first));
+    for (qsizetype i = first; i < end; ++i) result.append(at(i));
+    return result;
+}
+
+qsizetype HistoryRing::count(qint64 fromUnixMs, qint64 toUnixMs) const {
+    if (fromUnixMs > toUnixMs) return 0;
+    return qMax<qsizetype>(0, upperBound(toUnixMs) - lowerBound(fromUnixMs));
+}
+
+bool HistoryRing::window(qint64 fromUnixMs, qint64 toUnixMs, int bucketCount,
+                         qsizetype& first, qsizetype& last,
+                         qint64& originUnixMs, qint64& widthMs) const {
+    if (bucketCount <= 0 || fromUnixMs > toUnixMs) return false;
+    first = lowerBound(fromUnixMs);
+    last = upperBound(toUnixMs) - 1;
+    if (first > last) return false;
+    // Open-ended ranges bucket over the points actually retained.
+    originUnixMs = qMax(fromUnixMs, at(first).observedAtUnixMs);
+    const qint64 spanMs = qMin(toUnixMs, at(last).observedAtUnixMs) - originUnixMs + 1;
+    widthMs = qMax<qint64>(1, (spanMs + bucketCount - 1) / bucketCount);
+    return true;
+}
+
+QList<HistoryPoint> HistoryRing::decimated(qint64 fromUnixMs, qint64 toUnixMs,
+                                           int maxPoints) const {
+    QList<HistoryPoint> result;
+    qsizetype first, last;
+    qint64 originUnixMs, widthMs;
+    if (!window(fromUnixMs, toUnixMs, maxPoints, first, last, originUnixMs, widthMs))
+        return result;
+    if (last - first < maxPoints) return range(fromUnixMs, toUnixMs);
+
+    result.reserve(maxPoints);
+    for (qsizetype i = first; i <= last; ++i) {
+        const qint64 bucket = (at(i).observedAtUnixMs - originUnixMs) / widthMs;
+        const bool closesBucket = i == last
+            || (at(i + 1).observedAtUnixMs - originUnixMs) / widthMs != bucket;
+        if (closesBucket) result.append(at(i));
+    }
+    return result;
+}
+
+QList<HistoryBucket> HistoryRing::buckets(qint64 fromUnixMs, qint64 toUnixMs,
+                                          int bucketCount) const {
+    QList<HistoryBucket> result;
+    qsizetype first, last;
+    qint64 originUnixMs, widthMs;
+    if (!window(fromUnixMs, toUnixMs, bucketCount, first, last, originUnixMs, widthMs))
+        return result;
+
+    qint64 currentBucket = -1;
+    for (qsizetype i = first; i <= last; ++i) {
+        const HistoryPoint& point = at(i);
+        if (std::isnan(point.value)) continue;
+        const qint64 bucket = (point.observedAtUnixMs - originUnixMs) / widthMs;
+        if (bucket != currentBucket) {
+            currentBucket = bucket;
+            HistoryBucket opened;
+            opened.startUnixMs = originUnixMs + bucket * widthMs;
+            opened.endUnixMs = opened.startUnixMs + widthMs - 1;
+            opened.minimum = point.value;
+            opened.maximum = point.value;
+            result.append(opened);
+        }
+        HistoryBucket& current = result.last();
+        current.minimum = qMin(current.minimum, point.value);
+        current.maximum = qMax(current.maximum, point.value);
+        current.last = point.value;
+        ++current.count;
+    }
+    return result;
+}
+
+} // namespace oap::data
@@ -0,0 +1,80 @@
+#pragma once
+
+// HistoryRing — fixed-capacity time series of one data channel's numeric
+// values, for trend and sparkline consumers that attach late. DataRegistry
+// owns one ring per channel that declares historyRetentionMs and sizes it
+// under a global point budget; nothing here grows after construction.
+
+#include <QList>
+#include <QtGlobal>
+
+#include <vector>
+
+namespace oap::data {
+
+// value is NaN for a sample without a usable value: a gap in the series.
+struct HistoryPoint {
+    qint64 observedAtUnixMs = 0;
+    double value = 0.0;
+};
+
+// One time bucket of a min/max query over the valued points in
+// [startUnixMs, endUnixMs].
+struct HistoryBucket {
+    qint64 startUnixMs = 0;
+    qint64 endUnixMs = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double last = 0.0;
+    quint32 count = 0;
+};
+
+class HistoryRing {
+public:
+    // Most points or buckets one query hands out, whatever the ring holds.
+    static constexpr int kMaxQueryPoints = 4096;
+
+    explicit HistoryRing(qsizetype capacity = 0);
+
+    qsizetype capacity() const { return capacity_; }
+    qsizetype size() const { return qsizetype(points_.size()); }
+    bool isEmpty() const { return points_.empty(); }
+
+    // Overwrites the oldest point once full. Timestamps must not go
+    // backwards; an older point is dropped and false returned.
+    bool append(qint64 observedAtUnixMs, double value);
+    void clear();
+
+    // Every point with from <= observedAtUnixMs <= to, oldest first; with
+    // maxPoints > 0, only the newest maxPoints of them.
+    QList<HistoryPoint> range(qint64 fromUnixMs, qint64 toUnixMs,
+                              qsizetype maxPoints = 0) const;
+    // How many points the uncapped range() holds.
+    qsizetype count(qint64 fromUnixMs, qint64 toUnixMs) const;
+    // The range cut into maxPoints equal time buckets, keeping the last
+    // point of each non-empty bucket.
+    QList<HistoryPoint> decimated(qint64 fromUnixMs, qint64 toUnixMs,
+                                  int maxPoints) const;
+    // The range cut into bucketCount equal time buckets; buckets without a
+    // valued point are omitted.
+    QList<HistoryBucket> buckets(qint64 fromUnixMs, qint64 toUnixMs,
+                                 int bucketCount) const;
+
+private:
+    const HistoryPoint& at(qsizetype index) const {
+        return points_[size_t((start_ + index) % size())];
+    }
+    qsizetype lowerBound(qint64 unixMs) const;
+    qsizetype upperBound(qint64 unixMs) const;
+    // The clamped window and bucket width for a bucketed query; false when
+    // no point falls in the range.
+    bool window(qint64 fromUnixMs, qint64 toUnixMs, int bucketCount,
+                qsizetype& first, qsizetype& last, qint64& originUnixMs,
+                qint64& widthMs) const;
+
+    qsizetype capacity_ = 0;
+    std::vector<HistoryPoint> points_;
+    qsizetype start_ = 0;   // index of the oldest point once full
+};
+
+} // namespace oap::data
@@ -39,6 +39,17 @@ public:
     /// Returns number of bytes written, or -1 on error.
     virtual int writeAudio(AudioStreamHandle* handle, const uint8_t* data, int size) = 0;
 
+    /// Write one packet from a timestamped network source (AA audio), in
+    /// microseconds on the sender's clock. Streams created with a jitter
+    /// buffer use the timestamp to size their delay; otherwise this is
+    /// writeAudio(). Call from one thread per stream.
+    virtual int writeTimedAudio(AudioStreamHandle* handle, const uint8_t* data, int size,
+                                uint64_t timestampUs)
+    {
+        (void)timestampUs;
+        return writeAudio(handle, data, size);
+    }
+
     /// Set master output volume (0-100).
     /// Thread-safe.
     virtual void setMasterVolume(int volume) = 0;
@@ -15,6 +15,7 @@
 #include <QPointer>
 #include <QRegularExpression>
 #include "../Logging.hpp"
+#include "../MetricsRegistry.hpp"
 #include <yaml-cpp/yaml.h>
 #include <fstream>
 
@@ -324,6 +325,8 @@ QByteArray IpcServer::handleRequest(const QByteArray& request)
         return handleGetLogging();
     if (command == QLatin1String("set_logging"))
         return handleSetLogging(data);
+    if (command == QLatin1String("get_metrics"))
+        return handleGetMetrics(data);
 
     return R"({"error":"Unknown command"})";
 }
@@ -622,6 +625,25 @@ QByteArray IpcServer::handleGetLogging()
     return QJsonDocument(obj).toJson(QJsonDocument::Compact);
 }
 
+QByteArray IpcServer::handleGetMetrics(const QVariantMap& data)
+{
+    for (auto it = data.cbegin(); it != data.cend(); ++it) {
+        if (it.key() != QLatin1String("reset"))
+            return R"({"ok":false,"error":"Unrecognized metrics request field"})";
+    }
+    const QVariant resetValue = data.value("reset");
+    if (resetValue.isValid() && resetValue.typeId() != QMetaType::Bool)
+        return R"({"ok":false,"error":"metrics.reset must be a boolean"})";
+
+    // With reset, this dump still covers the previous interval; the next one
+    // starts from here.
+    auto& registry = MetricsRegistry::instance();
+    const QJsonObject obj = registry.toJson();
+    if (resetValue.toBool())
+        registry.resetBaseline();
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact);
+}
+
 QByteArray IpcServer::handleSetLogging(const QVariantMap& data)
 {
     if (!config_)
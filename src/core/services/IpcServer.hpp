@@ -93,6 +93,7 @@ private:
     QByteArray handleCompanionStatus();
     QByteArray handleGetLogging();
     QByteArray handleSetLogging(const QVariantMap& data);
+    QByteArray handleGetMetrics(const QVariantMap& data);
 
     QLocalServer* server_ = nullptr;
     std::unique_ptr<QLockFile> ownershipLock_;
@@ -76,6 +76,7 @@
 #include "ui/CodecCapabilityModel.hpp"
 #include "ui/DisplayInfo.hpp"
 #include "ui/ScreenDpiBinding.hpp"
+#include "ui/DataHistoryQuery.hpp"
 #include "ui/GestureOverlayController.hpp"
 #include "core/widget/WidgetRegistry.hpp"
 #include "core/widget/WidgetTypes.hpp"
@@ -327,6 +328,9 @@ int main(int argc, char *argv[])
     auto outputDev = yamlConfig->valueByPath("audio.output_device").toString();
     if (outputDev.isEmpty()) outputDev = "auto";
     audioService->setOutputDevice(outputDev);
+    audioService->setFloatOutput(
+        yamlConfig->valueByPath("audio.sample_format").toString() == QLatin1String("f32"));
+    audioService->setStageProfiling(yamlConfig->valueByPath("audio.profile_stages").toBool());
     audioService->setInputDevice(yamlConfig->microphoneDevice());
     audioService->setMasterVolume(yamlConfig->masterVolume());
 
@@ -1205,6 +1209,9 @@ int main(int argc, char *argv[])
     // parented to &app: this satisfies the provider-outlives-server lifetime
     // contract documented at the top of ApiServer.hpp.
     auto* dataRegistry = new oap::data::DataRegistry(&app);
+    // Trend and sparkline widgets read retained channel history directly.
+    engine.rootContext()->setContextProperty(
+        "DataHistory", new oap::DataHistoryQuery(dataRegistry, &app));
     oap::api::ApiServiceRefs apiRefs;
     apiRefs.media = mediaStatusService;
     apiRefs.navigation = navBridge;                 // always constructed; inert without an AA orchestrator
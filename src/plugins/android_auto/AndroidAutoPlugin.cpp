@@ -2,6 +2,7 @@
 #include "core/aa/AndroidAutoOrchestrator.hpp"
 #include "core/aa/AndroidAutoRuntimeBridge.hpp"
 #include "core/aa/EvdevCoordBridge.hpp"
+#include "core/aa/VideoResolutionHelper.hpp"
 #include "core/plugin/IHostContext.hpp"
 #include "core/services/IAudioService.hpp"
 #include "core/services/IConfigService.hpp"
@@ -127,11 +128,8 @@ void AndroidAutoPlugin::onConfigChanged(const QString& path, const QVariant& val
 
     // Update touch coordinate mapping for the new resolution
     if (path == QLatin1String("video.resolution") && runtimeBridge_) {
-        int aaW = 1280, aaH = 720;
-        QString res = value.toString();
-        if (res == QLatin1String("1080p")) { aaW = 1920; aaH = 1080; }
-        else if (res == QLatin1String("480p")) { aaW = 800; aaH = 480; }
-        runtimeBridge_->updateVideoMapping(aaW, aaH);
+        const QSize size = oap::aa::videoResolutionSize(value.toString());
+        runtimeBridge_->updateVideoMapping(size.width(), size.height());
     }
 
     if (!aaService_) return;
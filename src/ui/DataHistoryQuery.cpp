@@ -0,0 +1,91 @@
+#include "ui/DataHistoryQuery.hpp"
+
+#include "core/services/DataRegistry.hpp"
+
+#include <QVariantMap>
+
+#include <cmath>
+#include <limits>
+
+namespace oap {
+
+namespace {
+
+qint64 fromBound(qint64 unixMs) {
+    return unixMs > 0 ? unixMs : std::numeric_limits<qint64>::min();
+}
+
+qint64 toBound(qint64 unixMs) {
+    return unixMs > 0 ? unixMs : std::numeric_limits<qint64>::max();
+}
+
+QVariantList toVariant(const QList<data::HistoryPoint>& points) {
+    QVariantList result;
+    result.reserve(points.size());
+    for (const data::HistoryPoint& point : points) {
+        QVariantMap entry;
+        entry.insert(QStringLiteral("t"), point.observedAtUnixMs);
+        entry.insert(QStringLiteral("value"),
+                     std::isnan(point.value) ? QVariant() : QVariant(point.value));
+        result.append(entry);
+    }
+    return result;
+}
+
+} // namespace
+
+DataHistoryQuery::DataHistoryQuery(data::DataRegistry* registry, QObject* parent)
+    : QObject(parent), registry_(registry) {}
+
+int DataHistoryQuery::capacity(const QString& providerNamespace,
+                               const QString& channelName) const {
+    const data::HistoryRing* history =
+        registry_->history({providerNamespace, channelName});
+    return history ? int(history->capacity()) : 0;
+}
+
+QVariantList DataHistoryQuery::range(const QString& providerNamespace,
+                                     const QString& channelName,
+                                     qint64 fromUnixMs, qint64 toUnixMs) const {
+    const data::HistoryRing* history =
+        registry_->history({providerNamespace, channelName});
+    if (!history) return {};
+    return toVariant(history->range(fromBound(fromUnixMs), toBound(toUnixMs),
+                                    data::HistoryRing::kMaxQueryPoints));
+}
+
+QVariantList DataHistoryQuery::decimated(const QString& providerNamespace,
+                                         const QString& channelName,
+                                         qint64 fromUnixMs, qint64 toUnixMs,
+                                         int maxPoints) const {
+    const data::HistoryRing* history =
+        registry_->history({providerNamespace, channelName});
+    if (!history) return {};
+    return toVariant(history->decimated(fromBound(fromUnixMs), toBound(toUnixMs),
+                                        qMin(maxPoints, data::HistoryRing::kMaxQueryPoints)));
+}
+
+QVariantList DataHistoryQuery::minMax(const QString& providerNamespace,
+                                      const QString& channelName,
+                                      qint64 fromUnixMs, qint64 toUnixMs,
+                                      int bucketCount) const {
+    const data::HistoryRing* history =
+        registry_->history({providerNamespace, channelName});
+    if (!history) return {};
+    QVariantList result;
+    for (const data::HistoryBucket& bucket :
+         history->buckets(fromBound(fromUnixMs), toBound(toUnixMs),
+                          qMin(bucketCount, data::HistoryRing::kMaxQueryPoints))) {
+        QVariantMap entry;
+        entry.insert(QStringLiteral("start"), bucket.startUnixMs);
+        entry.insert(QStringLiteral("end"), bucket.endUnixMs);
+        entry.insert(QStringLiteral("min"), bucket.minimum);
+        entry.insert(QStringLiteral("max"), bucket.maximum);
+        entry.insert(QStringLiteral("last"), bucket.last);
+        entry.insert(QStringLiteral("count"), bucket.count);
+        result.append(entry);
+    }
+    return result;
+}
+
+} // namespace oap
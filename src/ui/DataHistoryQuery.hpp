@@ -0,0 +1,46 @@
+#pragma once
+
+// DataHistoryQuery — QML access to DataRegistry channel history, exposed as
+// the DataHistory context property. Timestamps are Unix ms; 0 (or less) for
+// fromUnixMs/toUnixMs leaves that end open. Results are plain JS arrays:
+// points are {t, value} with value undefined in gaps, buckets are
+// {start, end, min, max, last, count}. Like the API, one call returns at
+// most HistoryRing::kMaxQueryPoints entries: range() keeps the newest, and
+// larger maxPoints or bucketCount values are clamped. Query on a Timer or
+// after the widget's own data callback; nothing here notifies.
+
+#include <QObject>
+#include <QString>
+#include <QVariantList>
+
+namespace oap::data { class DataRegistry; }
+
+namespace oap {
+
+class DataHistoryQuery : public QObject {
+    Q_OBJECT
+
+public:
+    explicit DataHistoryQuery(oap::data::DataRegistry* registry,
+                              QObject* parent = nullptr);
+
+    // 0 when the channel is absent or keeps no history.
+    Q_INVOKABLE int capacity(const QString& providerNamespace,
+                             const QString& channelName) const;
+    Q_INVOKABLE QVariantList range(const QString& providerNamespace,
+                                   const QString& channelName,
+                                   qint64 fromUnixMs, qint64 toUnixMs) const;
+    Q_INVOKABLE QVariantList decimated(const QString& providerNamespace,
+                                       const QString& channelName,
+                                       qint64 fromUnixMs, qint64 toUnixMs,
+                                       int maxPoints) const;
+    Q_INVOKABLE QVariantList minMax(const QString& providerNamespace,
+                                    const QString& channelName,
+                                    qint64 fromUnixMs, qint64 toUnixMs,
+                                    int bucketCount) const;
+
+private:
+    oap::data::DataRegistry* registry_;
+};
+
+} // namespace oap
@@ -112,6 +112,8 @@ private slots:
     void testWaitingSubscriptionLifecycleAndSnapshots();
     void testExactFilteringAndDuplicateNormalization();
     void testUnsubscribeAndSlowConsumerIsolation();
+    void testShapedSubscriptionsCoalescePerSession();
+    void testHistoryQueryModes();
 };
 
 void TestApiDataBridge::testProviderCommandsPublicationAndCleanup() {
@@ -553,5 +555,133 @@ void TestApiDataBridge::testUnsubscribeAndSlowConsumerIsolation() {
     QVERIFY(fastTransport->sent.isEmpty());
 }
 
+void TestApiDataBridge::testShapedSubscriptionsCoalescePerSession() {
+    DataRegistry registry;
+    ApiRequestHandlers handler({nullptr, nullptr, nullptr, nullptr, &registry});
+    auto* providerTransport = new FakeTransport();
+    ApiSessionDeps providerDeps;
+    providerDeps.requests = &handler;
+    ApiSession provider(providerTransport, providerDeps);
+    ready(providerTransport);
+    providerTransport->inject(registration(60));
+    providerTransport->inject(declaration(61));
+
+    auto* fullTransport = new FakeTransport();
+    ApiSessionDeps fullDeps;
+    fullDeps.requests = &handler;
+    ApiSession full(fullTransport, fullDeps);
+    ready(fullTransport);
+    fullTransport->inject(subscription(62, "com.example.vehicle", "engine.rpm"));
+    fullTransport->sent.clear();
+
+    auto* dashboardTransport = new FakeTransport();
+    ApiSessionDeps dashboardDeps;
+    dashboardDeps.requests = &handler;
+    ApiSession dashboard(dashboardTransport, dashboardDeps);
+    ready(dashboardTransport);
+    pb::ApiMessage shaped = subscription(63, "com.example.vehicle", "engine.rpm");
+    auto* options = shaped.mutable_subscribe_data_channels_request()->mutable_options();
+    options->set_min_interval_ms(200);
+    options->set_latest_only(true);
+    dashboardTransport->inject(shaped);
+    dashboardTransport->sent.clear();
+
+    // The first sample opens the interval; the rest coalesce to the latest.
+    for (double value : {1000.0, 1100.0, 1200.0, 1300.0})
+        providerTransport->inject(rpmPublication(value));
+    QCOMPARE(fullTransport->sent.size(), 4);
+    QCOMPARE(dashboardTransport->sent.size(), 1);
+    QCOMPARE(parse(dashboardTransport->sent.first())
+                 .data_values_event().samples(0).value().double_value(),
+             1000.0);
+
+    QTRY_COMPARE_WITH_TIMEOUT(dashboardTransport->sent.size(), 2, 2000);
+    QCOMPARE(parse(dashboardTransport->sent.last())
+                 .data_values_event().samples(0).value().double_value(),
+             1300.0);
+    QCOMPARE(fullTransport->sent.size(), 4);
+
+    // Resubscribing without options restores full delivery.
+    dashboardTransport->inject(subscription(64, "com.example.vehicle", "engine.rpm"));
+    dashboardTransport->sent.clear();
+    providerTransport->inject(rpmPublication(1400.0));
+    providerTransport->inject(rpmPublication(1500.0));
+    QCOMPARE(dashboardTransport->sent.size(), 2);
+}
+
+void TestApiDataBridge::testHistoryQueryModes() {
+    DataRegistry registry;
+    ApiRequestHandlers handler({nullptr, nullptr, nullptr, nullptr, &registry});
+    auto* transport = new FakeTransport();
+    ApiSessionDeps deps;
+    deps.requests = &handler;
+    ApiSession session(transport, deps);
+    ready(transport);
+    transport->inject(registration(70));
+    pb::ApiMessage declare = declaration(71);
+    auto* rpm = declare.mutable_declare_data_channels_request()->mutable_channels(0);
+    rpm->set_nominal_interval_ms(100);
+    rpm->set_history_retention_ms(60000);
+    transport->inject(declare);
+
+    pb::ApiMessage catalog;
+    catalog.set_request_id(72);
+    catalog.mutable_list_data_catalog_request();
+    transport->inject(catalog);
+    QCOMPARE(parse(transport->sent.takeLast()).list_data_catalog_response()
+                 .catalog().providers(0).channels(0).history_retention_ms(),
+             quint32(60000));
+
+    for (int i = 0; i < 100; ++i) {
+        pb::ApiMessage publication = rpmPublication(i % 10 == 5 ? 5000.0 : 800.0 + i);
+        publication.mutable_publish_data_values()->mutable_samples(0)
+            ->set_observed_at_unix_ms(10000 + i * 100);
+        transport->inject(publication);
+    }
+
+    auto query = [&](quint64 requestId, pb::DataHistoryMode mode, quint32 maxPoints,
+                     const char* channelName = "engine.rpm") {
+        pb::ApiMessage message;
+        message.set_request_id(requestId);
+        auto* request = message.mutable_query_data_history_request();
+        request->mutable_channel()->set_provider_namespace("com.example.vehicle");
+        request->mutable_channel()->set_channel_name(channelName);
+        request->set_from_unix_ms(10000);
+        request->set_mode(mode);
+        request->set_max_points(maxPoints);
+        transport->inject(message);
+        const pb::ApiMessage response = parse(transport->sent.takeLast());
+        Q_ASSERT(response.request_id() == requestId);
+        return response.query_data_history_response();
+    };
+
+    const pb::QueryDataHistoryResponse raw = query(73, pb::DATA_HISTORY_MODE_RAW, 0);
+    QVERIFY(raw.accepted());
+    QCOMPARE(raw.capacity(), quint32(600));
+    QCOMPARE(raw.points_size(), 100);
+    QVERIFY(!raw.truncated());
+    QCOMPARE(raw.points(0).observed_at_unix_ms(), qint64(10000));
+    QCOMPARE(raw.points(99).value(), 899.0);
+
+    const pb::QueryDataHistoryResponse decimated =
+        query(74, pb::DATA_HISTORY_MODE_DECIMATED, 10);
+    QCOMPARE(decimated.points_size(), 10);
+    QCOMPARE(decimated.points(9).observed_at_unix_ms(), qint64(19900));
+
+    // Every bucket still shows its spike.
+    const pb::QueryDataHistoryResponse buckets =
+        query(75, pb::DATA_HISTORY_MODE_MIN_MAX, 10);
+    QCOMPARE(buckets.buckets_size(), 10);
+    for (const pb::DataHistoryBucket& bucket : buckets.buckets()) {
+        QCOMPARE(bucket.maximum(), 5000.0);
+        QCOMPARE(bucket.count(), quint32(10));
+    }
+
+    const pb::QueryDataHistoryResponse unknown =
+        query(76, pb::DATA_HISTORY_MODE_RAW, 0, "engine.oil");
+    QVERIFY(!unknown.accepted());
+    QCOMPARE(unknown.reason(), std::string("channel not declared"));
+}
+
 QTEST_MAIN(TestApiDataBridge)
 #include "test_api_data_bridge.moc"
@@ -0,0 +1,129 @@
+#include <QtTest>
+
+#include "core/api/ApiDataDelivery.hpp"
+
+using oap::api::DataDeliveryGate;
+using oap::api::DataDeliveryOptions;
+using namespace oap::data;
+
+namespace {
+
+Sample sample(double value, Quality quality = Quality::Good) {
+    Sample result;
+    result.channelName = QStringLiteral("engine.rpm");
+    result.value = value;
+    result.quality = quality;
+    return result;
+}
+
+ChannelDefinition rpm(std::optional<quint32> nominalIntervalMs = std::nullopt,
+                      std::optional<quint32> staleAfterMs = std::nullopt) {
+    ChannelDefinition result;
+    result.channelName = QStringLiteral("engine.rpm");
+    result.valueType = ValueType::Double;
+    result.nominalIntervalMs = nominalIntervalMs;
+    result.staleAfterMs = staleAfterMs;
+    return result;
+}
+
+DataDeliveryOptions options(quint32 minIntervalMs, double minDelta = 0.0,
+                            bool latestOnly = false) {
+    DataDeliveryOptions result;
+    result.minIntervalMs = minIntervalMs;
+    result.minDelta = minDelta;
+    result.latestOnly = latestOnly;
+    return result;
+}
+
+} // namespace
+
+class TestApiDataDelivery : public QObject {
+    Q_OBJECT
+private slots:
+    void testIntervalDropsWithoutLatestOnly();
+    void testLatestOnlyHoldsAndReleasesNewest();
+    void testLatestOnlyDefaultsToNominalInterval();
+    void testMinDeltaSkipsSmallChangesButNotQuality();
+    void testStaleAfterBoundsSuppression();
+};
+
+void TestApiDataDelivery::testIntervalDropsWithoutLatestOnly() {
+    // A 100 Hz channel to a 10 Hz consumer.
+    DataDeliveryGate gate(options(100), rpm());
+    int delivered = 0;
+    for (qint64 nowMs = 0; nowMs < 1000; nowMs += 10)
+        if (gate.offer(sample(double(nowMs)), nowMs)) ++delivered;
+    QCOMPARE(delivered, 10);
+    QCOMPARE(gate.dueAtMs(), qint64(-1));
+    QVERIFY(!gate.takeDue(5000));
+}
+
+void TestApiDataDelivery::testLatestOnlyHoldsAndReleasesNewest() {
+    DataDeliveryGate gate(options(100, 0.0, true), rpm());
+    QVERIFY(gate.offer(sample(1.0), 0));
+    QVERIFY(!gate.offer(sample(2.0), 30));
+    QVERIFY(!gate.offer(sample(3.0), 60));
+    QCOMPARE(gate.dueAtMs(), qint64(100));
+    QVERIFY(!gate.takeDue(99));
+
+    const std::optional<Sample> due = gate.takeDue(100);
+    QVERIFY(due);
+    QCOMPARE(std::get<double>(*due->value), 3.0);
+    QCOMPARE(gate.dueAtMs(), qint64(-1));
+    // The flush restarts the interval.
+    QVERIFY(!gate.offer(sample(4.0), 150));
+    QCOMPARE(gate.dueAtMs(), qint64(200));
+}
+
+void TestApiDataDelivery::testLatestOnlyDefaultsToNominalInterval() {
+    DataDeliveryGate gate(options(0, 0.0, true), rpm(50));
+    QCOMPARE(gate.intervalMs(), qint64(50));
+    QVERIFY(gate.offer(sample(1.0), 0));
+    QVERIFY(!gate.offer(sample(2.0), 10));
+    QCOMPARE(gate.dueAtMs(), qint64(50));
+
+    // No hint, no interval: latest-only alone passes everything through.
+    DataDeliveryGate unhinted(options(0, 0.0, true), rpm());
+    QVERIFY(unhinted.offer(sample(1.0), 0));
+    QVERIFY(unhinted.offer(sample(2.0), 0));
+}
+
+void TestApiDataDelivery::testMinDeltaSkipsSmallChangesButNotQuality() {
+    DataDeliveryGate gate(options(0, 10.0), rpm());
+    QVERIFY(gate.offer(sample(800.0), 0));
+    QVERIFY(!gate.offer(sample(805.0), 10));
+    QVERIFY(!gate.offer(sample(791.0), 20));
+    // Measured against the last delivered value, not the last offered one.
+    QVERIFY(gate.offer(sample(810.0), 30));
+    QVERIFY(gate.offer(sample(810.0, Quality::Degraded), 40));
+
+    // A small change cancels a held sample: the subscriber is already close.
+    DataDeliveryGate held(options(100, 10.0, true), rpm());
+    QVERIFY(held.offer(sample(800.0), 0));
+    QVERIFY(!held.offer(sample(900.0), 10));
+    QCOMPARE(held.dueAtMs(), qint64(100));
+    QVERIFY(!held.offer(sample(801.0), 20));
+    QCOMPARE(held.dueAtMs(), qint64(-1));
+
+    // A quality change also skips the interval, and drops what was held.
+    DataDeliveryGate interval(options(100, 10.0, true), rpm());
+    QVERIFY(interval.offer(sample(800.0), 0));
+    QVERIFY(!interval.offer(sample(900.0), 10));
+    QVERIFY(interval.offer(sample(900.0, Quality::Degraded), 20));
+    QCOMPARE(interval.dueAtMs(), qint64(-1));
+    QVERIFY(!interval.offer(sample(950.0, Quality::Degraded), 30));
+    QCOMPARE(interval.dueAtMs(), qint64(120));
+}
+
+void TestApiDataDelivery::testStaleAfterBoundsSuppression() {
+    // staleAfterMs 400: refreshed at least every 200 ms, and the interval
+    // is capped to match.
+    DataDeliveryGate gate(options(1000, 10.0), rpm(std::nullopt, 400));
+    QCOMPARE(gate.intervalMs(), qint64(200));
+    QVERIFY(gate.offer(sample(800.0), 0));
+    QVERIFY(!gate.offer(sample(801.0), 100));
+    QVERIFY(gate.offer(sample(801.0), 200));
+}
+
+QTEST_GUILESS_MAIN(TestApiDataDelivery)
+#include "test_api_data_delivery.moc"
@@ -1,6 +1,8 @@
 #include <QtTest>
 #include "core/api/ApiFramer.hpp"
 
+#include <random>
+
 using oap::api::ApiFramer;
 
 static QByteArray lenPrefix(quint32 n) {
@@ -20,6 +22,11 @@ private slots:
     void testByteAtATime();
     void testOversizedLengthViolates();
     void testZeroLengthViolates();
+    void testNextViewsIntoChunk();
+    void testFuzzedSplits();
+    void testManySmallFramesInOneChunk();
+    void benchmarkFeedBurst_data();
+    void benchmarkFeedBurst();
 };
 
 void TestApiFraming::testEncodeProducesPrefix() {
@@ -75,5 +82,87 @@ void TestApiFraming::testZeroLengthViolates() {
     QVERIFY(fr.violated());
 }
 
+void TestApiFraming::testNextViewsIntoChunk() {
+    ApiFramer fr;
+    const QByteArray chunk = ApiFramer::encode("one") + ApiFramer::encode("two");
+    fr.append(chunk);
+    QByteArrayView frame;
+    QVERIFY(fr.next(frame));
+    QCOMPARE(frame.toByteArray(), QByteArray("one"));
+    QCOMPARE(frame.constData(), chunk.constData() + 4);
+    QVERIFY(fr.next(frame));
+    QCOMPARE(frame.toByteArray(), QByteArray("two"));
+    QVERIFY(!fr.next(frame));
+}
+
+// Random frames, cut at random points, must come back whole and in order.
+void TestApiFraming::testFuzzedSplits() {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> length(1, 300);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> cut(0, 700);
+
+    for (int round = 0; round < 50; ++round) {
+        QList<QByteArray> sent;
+        QByteArray stream;
+        for (int i = 0; i < 200; ++i) {
+            QByteArray payload(length(random), Qt::Uninitialized);
+            for (char& c : payload) c = char(byte(random));
+            sent.append(payload);
+            stream += ApiFramer::encode(payload);
+        }
+
+        ApiFramer fr(300);
+        QList<QByteArray> received;
+        for (qsizetype at = 0; at < stream.size();) {
+            const qsizetype n = qMin<qsizetype>(cut(random), stream.size() - at);
+            received += fr.feed(stream.mid(at, n));
+            at += n;
+        }
+        QVERIFY(!fr.violated());
+        QCOMPARE(received, sent);
+    }
+}
+
+void TestApiFraming::testManySmallFramesInOneChunk() {
+    QByteArray stream;
+    for (int i = 0; i < 10000; ++i)
+        stream += ApiFramer::encode(QByteArray::number(i));
+    // Plus the start of one more, completed by the next read.
+    const QByteArray tail = ApiFramer::encode("tail");
+
+    ApiFramer fr;
+    const QList<QByteArray> out = fr.feed(stream + tail.left(5));
+    QCOMPARE(out.size(), 10000);
+    QCOMPARE(out.first(), QByteArray("0"));
+    QCOMPARE(out.last(), QByteArray("9999"));
+
+    const QList<QByteArray> rest = fr.feed(tail.mid(5));
+    QCOMPARE(rest.size(), 1);
+    QCOMPARE(rest[0], QByteArray("tail"));
+}
+
+void TestApiFraming::benchmarkFeedBurst_data() {
+    QTest::addColumn<int>("frames");
+    for (int frames : {100, 1000, 10000})
+        QTest::addRow("%d", frames) << frames;
+}
+
+void TestApiFraming::benchmarkFeedBurst() {
+    QFETCH(int, frames);
+    QByteArray stream;
+    for (int i = 0; i < frames; ++i)
+        stream += ApiFramer::encode(QByteArray(24, 'x'));
+
+    ApiFramer fr;
+    QBENCHMARK {
+        QByteArrayView frame;
+        int count = 0;
+        fr.append(stream);
+        while (fr.next(frame)) ++count;
+        QCOMPARE(count, frames);
+    }
+}
+
 QTEST_MAIN(TestApiFraming)
 #include "test_api_framing.moc"
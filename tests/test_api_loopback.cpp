@@ -25,6 +25,9 @@
 #include <QFile>
 #include <QImage>
 
+#include <memory>
+#include <vector>
+
 #include "core/api/ApiServer.hpp"
 #include "core/api/ApiFramer.hpp"
 #include "core/api/ApiInboundState.hpp"
@@ -222,6 +225,10 @@ private slots:
     void testPairingQrPayloadAndProperty();
     void testExternalDataTcpLifecycle();
     void testExternalDataWebSocketFlow();
+
+    // Fan-out cost against the number of subscribed sessions.
+    void benchmarkFanOut_data();
+    void benchmarkFanOut();
 };
 
 void TestApiLoopback::init() {
@@ -980,5 +987,94 @@ void TestApiLoopback::testExternalDataWebSocketFlow() {
     server.stop();
 }
 
+void TestApiLoopback::benchmarkFanOut_data() {
+    QTest::addColumn<bool>("values");
+    QTest::addColumn<int>("sessions");
+    for (int sessions : {1, 2, 4, 8, 16}) {
+        QTest::addRow("status/%d", sessions) << false << sessions;
+        QTest::addRow("values/%d", sessions) << true << sessions;
+    }
+}
+
+// One update fanned out to N TCP subscribers, timed until every client has
+// read its frame. The event is serialized once whatever N is, so the slope
+// is the per-session socket write alone.
+void TestApiLoopback::benchmarkFanOut() {
+    QFETCH(bool, values);
+    QFETCH(int, sessions);
+
+    Fixture f;
+    f.config.setValue("api.tcp_port", 0);
+    f.config.setValue("api.ws_port", 0);
+    f.media.setBtConnected(true);
+    f.media.updateBtMetadata("Initial", "a", "b");
+    ApiServer server(f.refs());
+    server.setStorePathForTest(kStorePath);
+    QVERIFY(server.start());
+
+    struct Client {
+        QTcpSocket socket;
+        ApiFramer framer;
+        QList<QByteArray> queue;
+    };
+    auto connectHello = [&](Client& c) {
+        c.socket.connectToHost(QHostAddress::LocalHost, server.tcpPort());
+        QVERIFY(c.socket.waitForConnected(3000));
+        sendFramed(c.socket, clientHello(1));
+        QCOMPARE(readFramed(c.socket, c.framer, c.queue).payload_case(),
+                 pb::ApiMessage::kServerHello);
+    };
+
+    Client provider;
+    if (values) {
+        connectHello(provider);
+        sendFramed(provider.socket, registerDataProvider(2));
+        QCOMPARE(readFramed(provider.socket, provider.framer, provider.queue)
+                     .payload_case(),
+                 pb::ApiMessage::kRegisterDataProviderResponse);
+        sendFramed(provider.socket, declareRpm(3));
+        QCOMPARE(readFramed(provider.socket, provider.framer, provider.queue)
+                     .payload_case(),
+                 pb::ApiMessage::kDeclareDataChannelsResponse);
+    }
+
+    std::vector<std::unique_ptr<Client>> clients;
+    for (int i = 0; i < sessions; ++i) {
+        clients.push_back(std::make_unique<Client>());
+        Client& c = *clients.back();
+        connectHello(c);
+        if (values) {
+            sendFramed(c.socket, subscribeRpm(2));
+            QCOMPARE(readFramed(c.socket, c.framer, c.queue).payload_case(),
+                     pb::ApiMessage::kSubscribeDataChannelsResponse);
+            QCOMPARE(readFramed(c.socket, c.framer, c.queue)
+                         .data_channel_availability_event().availability(),
+                     pb::DATA_CHANNEL_AVAILABILITY_AVAILABLE);
+        } else {
+            sendFramed(c.socket, subscribe(2, pb::TOPIC_MEDIA));
+            QCOMPARE(readFramed(c.socket, c.framer, c.queue).payload_case(),
+                     pb::ApiMessage::kSubscribeResponse);
+            QCOMPARE(readFramed(c.socket, c.framer, c.queue).payload_case(),
+                     pb::ApiMessage::kMediaStatus);
+        }
+    }
+
+    const auto expected = values ? pb::ApiMessage::kDataValuesEvent
+                                 : pb::ApiMessage::kMediaStatus;
+    int round = 0;
+    QBENCHMARK {
+        ++round;
+        if (values)
+            sendFramed(provider.socket, publishRpm(round));
+        else
+            f.media.updateBtMetadata(QStringLiteral("Title %1").arg(round), "a", "b");
+        for (const auto& c : clients)
+            QCOMPARE(readFramed(c->socket, c->framer, c->queue).payload_case(),
+                     expected);
+    }
+
+    server.stop();
+}
+
 QTEST_MAIN(TestApiLoopback)
 #include "test_api_loopback.moc"
@@ -179,6 +179,10 @@ void TestApiProtoRoundtrip::testDataEnvelopeAllocation() {
          [](pb::ApiMessage& m) { m.mutable_data_catalog_event(); }},
         {94, pb::ApiMessage::kDataChannelAvailabilityEvent,
          [](pb::ApiMessage& m) { m.mutable_data_channel_availability_event(); }},
+        {95, pb::ApiMessage::kQueryDataHistoryRequest,
+         [](pb::ApiMessage& m) { m.mutable_query_data_history_request(); }},
+        {96, pb::ApiMessage::kQueryDataHistoryResponse,
+         [](pb::ApiMessage& m) { m.mutable_query_data_history_response(); }},
     };
 
     for (const PayloadCase& c : cases) {
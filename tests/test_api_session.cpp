@@ -12,6 +12,7 @@
 #include "api/api.pb.h"
 
 namespace pb = prodigy::api::v1;
+using oap::api::ApiFrame;
 using oap::api::ApiFramer;
 using oap::api::ApiSession;
 using oap::api::ApiSessionDeps;
@@ -104,6 +105,7 @@ private slots:
     void testTransportAbortEmitsClosedExactlyOnce();
     void testSubscribeSnapshotAndAck();
     void testQueueCapDisconnects();
+    void testTaggedFrameSharesBytes();
     void testPingPong();
     void testReentrantMessageThenClose();
     void testServerHelloCarriesServerId();
@@ -607,6 +609,33 @@ void TestApiSession::testQueueCapDisconnects() {
     QVERIFY(transport->aborted);
 }
 
+void TestApiSession::testTaggedFrameSharesBytes() {
+    auto* transport = new FakeTransport();
+    ApiSession session(transport, ApiSessionDeps{});
+    transport->injectMessage(clientHello(1));
+    QCOMPARE(session.state(), ApiSession::State::Ready);
+
+    pb::ApiMessage sub;
+    sub.set_request_id(1);
+    sub.mutable_subscribe_request()->add_topics(pb::TOPIC_MEDIA);
+    transport->injectMessage(serialize(sub));
+    const qsizetype before = transport->sent.size();
+
+    pb::ApiMessage status;
+    status.mutable_media_status();
+    const ApiFrame media = ApiFrame::fromPayload(serialize(status), pb::TOPIC_MEDIA);
+    const ApiFrame phone = ApiFrame::fromPayload(serialize(status), pb::TOPIC_PHONE);
+
+    // Gated on the tag alone: an unsubscribed topic is dropped unparsed.
+    session.deliver(phone);
+    QCOMPARE(transport->sent.size(), before);
+
+    session.deliver(media);
+    QCOMPARE(transport->sent.size(), before + 1);
+    // The transport got the frame's own buffer, not a copy.
+    QCOMPARE(transport->sent.last().constData(), media.payload.constData());
+}
+
 void TestApiSession::testPingPong() {
     auto* transport = new FakeTransport();
     ApiSession session(transport, ApiSessionDeps{});
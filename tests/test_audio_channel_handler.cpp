@@ -12,6 +12,22 @@
 
 class TestAudioChannelHandler : public QObject {
     Q_OBJECT
+private:
+    static void startStream(oaa::hu::AudioChannelHandler& handler, int32_t session) {
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(session);
+        start.set_config(0);
+        handler.onMessage(oaa::AVMessageId::START_INDICATION,
+                          QByteArray::fromStdString(start.SerializeAsString()));
+    }
+
+    static oaa::proto::messages::AVMediaAckIndication ackOf(const QList<QVariant>& emission) {
+        oaa::proto::messages::AVMediaAckIndication ack;
+        const QByteArray payload = emission[2].toByteArray();
+        ack.ParseFromArray(payload.constData(), payload.size());
+        return ack;
+    }
+
 private slots:
     void testMediaChannelId() {
         oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
@@ -170,6 +186,101 @@ private slots:
         }
     }
 
+    void testCoalescedAcksFlushOncePerEventLoopTurn() {
+        oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
+        oaa::MediaAckPolicy policy;
+        policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        handler.setAckPolicy(policy);
+        handler.onChannelOpened();
+        startStream(handler, 7);
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        const QByteArray pcmData(960, '\x42');
+        for (int i = 0; i < 3; ++i)
+            handler.onMediaData(pcmData, i);
+
+        // Below the threshold: nothing goes out until the turn ends.
+        QCOMPARE(sendSpy.count(), 0);
+        QCoreApplication::processEvents();
+
+        QCOMPARE(sendSpy.count(), 1);
+        QCOMPARE(ackOf(sendSpy[0]).session_id(), 7);
+        QCOMPARE(ackOf(sendSpy[0]).ack_count(), 3);
+        QCOMPARE(handler.receivedFrameCount(), 3u);
+        QCOMPARE(handler.ackCount(), 1u);
+        QCOMPARE(handler.ackedFrameCount(), 3u);
+    }
+
+    void testCoalescedAcksFlushAtThresholdWithinWindow() {
+        oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
+        oaa::MediaAckPolicy policy;
+        policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        handler.setAckPolicy(policy);
+        handler.onChannelOpened();
+        startStream(handler, 1);
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        const QByteArray pcmData(960, '\x42');
+        // Default threshold is half of max_unacked (10): flush every 5 frames
+        // without waiting for the event loop.
+        for (int i = 0; i < 12; ++i)
+            handler.onMediaData(pcmData, i);
+        QCOMPARE(sendSpy.count(), 2);
+        QCOMPARE(ackOf(sendSpy[0]).ack_count(), 5);
+        QCOMPARE(ackOf(sendSpy[1]).ack_count(), 5);
+
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 3);
+        QCOMPARE(ackOf(sendSpy[2]).ack_count(), 2);
+        QCOMPARE(handler.ackedFrameCount(), handler.receivedFrameCount());
+
+        // A threshold above the advertised window is clamped to it.
+        policy.flushThreshold = 50;
+        handler.setAckPolicy(policy);
+        sendSpy.clear();
+        for (int i = 0; i < 10; ++i)
+            handler.onMediaData(pcmData, i);
+        QCOMPARE(sendSpy.count(), 1);
+        QCOMPARE(ackOf(sendSpy[0]).ack_count(), 10);
+    }
+
+    void testCoalescedAcksDroppedOnChannelClose() {
+        oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
+        oaa::MediaAckPolicy policy;
+        policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        handler.setAckPolicy(policy);
+        handler.onChannelOpened();
+        startStream(handler, 1);
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        handler.onMediaData(QByteArray(960, '\x42'), 0);
+        handler.onMediaData(QByteArray(960, '\x42'), 1);
+        handler.onChannelClosed();
+        QCoreApplication::processEvents();
+
+        QCOMPARE(sendSpy.count(), 0);
+    }
+
+    void testStopIndicationFlushesPendingAcks() {
+        oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
+        oaa::MediaAckPolicy policy;
+        policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        handler.setAckPolicy(policy);
+        handler.onChannelOpened();
+        startStream(handler, 4);
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        handler.onMediaData(QByteArray(960, '\x42'), 0);
+        handler.onMediaData(QByteArray(960, '\x42'), 1);
+        handler.onMessage(oaa::AVMessageId::STOP_INDICATION, QByteArray());
+
+        QCOMPARE(sendSpy.count(), 1);
+        QCOMPARE(ackOf(sendSpy[0]).session_id(), 4);
+        QCOMPARE(ackOf(sendSpy[0]).ack_count(), 2);
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 1);
+    }
+
     void testMediaDataIgnoredWhenNotStreaming() {
         oaa::hu::AudioChannelHandler handler(oaa::ChannelId::MediaAudio);
         QSignalSpy dataSpy(&handler, &oaa::hu::AudioChannelHandler::audioDataReceived);
@@ -0,0 +1,171 @@
+#include <QTest>
+#include "core/audio/AudioJitterBuffer.hpp"
+#include "core/audio/AudioRingBuffer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using oap::AudioJitterBuffer;
+using oap::AudioRingBuffer;
+
+namespace {
+
+constexpr int kRate = 48000;
+// 20 ms stereo packets, as AA media sends them.
+constexpr uint32_t kPacketFrames = 960;
+constexpr int64_t kPacketUs = 20000;
+
+std::vector<int16_t> packet(int16_t value)
+{
+    return std::vector<int16_t>(kPacketFrames * 2, value);
+}
+
+uint32_t push(AudioJitterBuffer& buffer, const std::vector<int16_t>& samples,
+              uint64_t ptsUs, int64_t arrivalUs)
+{
+    return buffer.push(reinterpret_cast<const uint8_t*>(samples.data()),
+                       uint32_t(samples.size() * sizeof(int16_t)), ptsUs, arrivalUs);
+}
+
+} // namespace
+
+class TestAudioJitterBuffer : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testBuffersToTargetThenFadesIn()
+    {
+        AudioRingBuffer ring(1 << 18);
+        AudioJitterBuffer buffer(ring, kRate, 2, 20, 200);
+        QCOMPARE(buffer.targetFrames(), uint32_t(kRate * 20 / 1000));
+
+        std::vector<int16_t> out(512 * 2, 0x1111);
+        push(buffer, packet(10000), 1000000, 5000000);
+        // One packet plus the guard quantum.
+        QCOMPARE(buffer.targetFrames(), uint32_t(kRate * 30 / 1000));
+        QCOMPARE(buffer.pull(out.data(), 512), 0u);
+        QCOMPARE(buffer.state(), AudioJitterBuffer::State::Buffering);
+        for (int16_t sample : out)
+            QCOMPARE(sample, int16_t(0));
+
+        push(buffer, packet(10000), 1000000 + kPacketUs, 5000000 + kPacketUs);
+        QCOMPARE(buffer.pull(out.data(), 512), 512u);
+        QCOMPARE(buffer.state(), AudioJitterBuffer::State::Playing);
+        QCOMPARE(out[0], int16_t(0));
+        QVERIFY(out[2 * 120] > 0 && out[2 * 120] < 10000);
+        QCOMPARE(out[2 * 240], int16_t(10000));
+        QCOMPARE(out[2 * 511 + 1], int16_t(10000));
+    }
+
+    void testGapIsConcealedThenRebuffers()
+    {
+        AudioRingBuffer ring(1 << 14);
+        AudioJitterBuffer buffer(ring, kRate, 1, 0, 0);
+        std::vector<int16_t> ramp(1200);
+        for (size_t i = 0; i < ramp.size(); ++i)
+            ramp[i] = int16_t(i * 8);
+        buffer.push(reinterpret_cast<const uint8_t*>(ramp.data()), 2400, 1000, 0);
+
+        std::vector<int16_t> out(2400);
+        QCOMPARE(buffer.pull(out.data(), 2400), 1200u);
+        const uint32_t conceal = kRate * AudioJitterBuffer::kConcealMs / 1000;
+        // Continues from the last real sample (played backwards), fades to
+        // zero over the concealment window, then silence.
+        QVERIFY(std::abs(out[1200] - out[1199]) <= 16);
+        for (uint32_t i = 1201; i < 1200 + conceal; ++i)
+            QVERIFY(out[i] <= out[i - 1]);
+        QCOMPARE(out[1200 + conceal - 1], int16_t(0));
+        QCOMPARE(out[2399], int16_t(0));
+        QCOMPARE(buffer.state(), AudioJitterBuffer::State::Buffering);
+
+        const AudioJitterBuffer::Stats stats = buffer.takeStats();
+        QCOMPARE(stats.concealEvents, uint64_t(1));
+        QCOMPARE(stats.concealedFrames, uint64_t(conceal));
+        QCOMPARE(buffer.takeStats().concealEvents, uint64_t(0));
+    }
+
+    void testLateArrivalsRaiseTargetWithinBounds()
+    {
+        AudioRingBuffer ring(1 << 18);
+        AudioJitterBuffer buffer(ring, kRate, 2, 20, 200);
+        const std::vector<int16_t> samples = packet(100);
+        // Every tenth packet is 35 ms late.
+        for (int i = 0; i < 100; ++i) {
+            const int64_t late = (i % 10 == 9) ? 35000 : 0;
+            push(buffer, samples, uint64_t(1000000 + i * kPacketUs), 9000000 + i * kPacketUs + late);
+            std::vector<int16_t> drain(kPacketFrames * 2);
+            buffer.pull(drain.data(), kPacketFrames);
+        }
+        // p95 jitter + packet + guard.
+        QCOMPARE(buffer.targetDelayUs(), int64_t(35000 + kPacketUs + AudioJitterBuffer::kGuardUs));
+        QVERIFY(buffer.takeStats().jitter.max() >= 35000);
+
+        AudioJitterBuffer capped(ring, kRate, 2, 20, 40);
+        for (int i = 0; i < 20; ++i) {
+            const int64_t late = (i % 10 == 9) ? 35000 : 0;
+            push(capped, samples, uint64_t(1000000 + i * kPacketUs), 9000000 + i * kPacketUs + late);
+        }
+        QCOMPARE(capped.targetDelayUs(), int64_t(40000));
+    }
+
+    void testZeroTimestampsContinueTimeline()
+    {
+        AudioRingBuffer ring(1 << 18);
+        AudioJitterBuffer buffer(ring, kRate, 2, 0, 200);
+        const std::vector<int16_t> samples = packet(100);
+        for (int i = 0; i < 32; ++i)
+            push(buffer, samples, 0, 2000000 + i * kPacketUs);
+        QCOMPARE(buffer.takeStats().jitter.max(), uint64_t(0));
+        QCOMPARE(buffer.targetDelayUs(), kPacketUs + AudioJitterBuffer::kGuardUs);
+    }
+
+    void testSourceDriftIsMeasuredFromTimestamps()
+    {
+        AudioRingBuffer ring(1 << 18);
+        AudioJitterBuffer buffer(ring, kRate, 2, 20, 200);
+        const std::vector<int16_t> samples = packet(100);
+        std::vector<int16_t> drain(kPacketFrames * 2);
+        double ppm = 0.0;
+        QVERIFY(!buffer.sourceDrift(ppm));
+
+        // Phone clock 250 ppm fast: its 20 ms arrive every 19.995 ms.
+        for (int i = 0; i < 500; ++i) {
+            const int64_t arrivalUs = 3000000 + int64_t(i * kPacketUs / 1.00025);
+            push(buffer, samples, uint64_t(1000000 + i * kPacketUs), arrivalUs);
+            buffer.pull(drain.data(), kPacketFrames);
+        }
+        QVERIFY(buffer.sourceDrift(ppm));
+        QVERIFY(std::abs(ppm - 250.0) < 5.0);
+    }
+
+    void testBacklogAfterStallIsTrimmedToTarget()
+    {
+        AudioRingBuffer ring(1 << 18);
+        AudioJitterBuffer buffer(ring, kRate, 2, 20, 40);
+        const std::vector<int16_t> samples = packet(10000);
+        std::vector<int16_t> out(512 * 2);
+        push(buffer, samples, 1000000, 1000000);
+        push(buffer, samples, 1000000 + kPacketUs, 1000000 + kPacketUs);
+        QCOMPARE(buffer.pull(out.data(), 512), 512u);
+
+        // A stall releases 30 packets at once.
+        for (int i = 2; i < 32; ++i)
+            push(buffer, samples, uint64_t(1000000 + i * kPacketUs), 1500000);
+        const uint32_t fade = kRate * AudioJitterBuffer::kFadeMs / 1000;
+        QCOMPARE(buffer.pull(out.data(), 512), 512u);
+        // Faded out, dropped to the target, faded back in.
+        QCOMPARE(out[2 * (fade - 1)], int16_t(0));
+        QCOMPARE(out[2 * fade], int16_t(0));
+        QCOMPARE(out[2 * 511], int16_t(10000));
+
+        const AudioJitterBuffer::Stats stats = buffer.takeStats();
+        QCOMPARE(stats.trims, uint64_t(1));
+        QVERIFY(stats.trimmedFrames > 0);
+        QCOMPARE(ring.available() / 4, buffer.targetFrames() - (512 - fade));
+        QCOMPARE(stats.concealEvents, uint64_t(0));
+    }
+};
+
+QTEST_GUILESS_MAIN(TestAudioJitterBuffer)
+#include "test_audio_jitter_buffer.moc"
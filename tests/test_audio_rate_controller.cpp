@@ -0,0 +1,205 @@
+#include <QTest>
+#include "core/audio/AudioRateController.hpp"
+#include "core/audio/ClockDriftEstimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using oap::AudioRateController;
+using oap::ClockDriftEstimator;
+
+namespace {
+
+constexpr int kRate = 48000;
+constexpr double kQuantum = 1024.0;
+constexpr double kPacketFrames = 960.0;
+
+// A phone sending 20 ms packets over Wi-Fi into a ring drained by a
+// PipeWire graph, each on its own crystal, measured on the local clock.
+struct Simulation {
+    double sourcePpm = 0.0;
+    double graphPpm = 0.0;
+    double maxJitterUs = 15000.0;
+    bool feedForward = true;
+    // Packet + guard + the p95 of this jitter, as the jitter buffer sets it.
+    uint32_t targetFrames = kRate * 45 / 1000;
+
+    AudioRateController controller{kRate};
+    ClockDriftEstimator sourceClock;
+    double bufferedFrames = 0.0;
+    double minBufferedMs = 1e9;
+    double maxBufferedMs = 0.0;
+    double sumBufferedMs = 0.0;
+    int measured = 0;
+
+    double meanBufferedMs() const { return measured > 0 ? sumBufferedMs / measured : 0.0; }
+
+    void run(double seconds, double measureAfterS)
+    {
+        std::mt19937 random(7);
+        std::exponential_distribution<double> jitter(1.0 / (maxJitterUs / 4.0));
+        std::uniform_real_distribution<double> wake(0.0, 1500.0);
+
+        const double packetUs = kPacketFrames * 1e6 / kRate / (1.0 + sourcePpm * 1e-6);
+        const double quantumUs = kQuantum * 1e6 / kRate / (1.0 + graphPpm * 1e-6);
+        double nextSendUs = 1e6;
+        double lastArrivalUs = 0.0;
+        double ptsUs = 0.0;
+        double nextTickUs = 1e6;
+        double carry = 0.0;
+        bufferedFrames = targetFrames;
+
+        while (nextTickUs < 1e6 + seconds * 1e6) {
+            const double arrivalUs = std::max(lastArrivalUs,
+                                              nextSendUs + std::min(jitter(random), maxJitterUs));
+            if (arrivalUs <= nextTickUs) {
+                lastArrivalUs = arrivalUs;
+                bufferedFrames += kPacketFrames;
+                sourceClock.add(int64_t(arrivalUs), int64_t(ptsUs));
+                ptsUs += kPacketFrames * 1e6 / kRate;
+                nextSendUs += packetUs;
+                continue;
+            }
+
+            // The resampler carries the fraction into the next request.
+            const double nowUs = nextTickUs + wake(random);
+            const double exact = kQuantum * controller.rate() + carry;
+            const double wanted = std::floor(exact);
+            carry = exact - wanted;
+            const double got = std::min(wanted, bufferedFrames);
+            bufferedFrames -= got;
+
+            AudioRateController::Input input;
+            input.nowUs = int64_t(nowUs);
+            input.frames = uint32_t(wanted);
+            input.hadData = got > 0.0;
+            input.bufferedFrames = uint32_t(bufferedFrames);
+            input.targetFrames = targetFrames;
+            input.sourceDriftValid = feedForward && sourceClock.valid();
+            input.sourceDriftPpm = sourceClock.ppm();
+            AudioRateController::Update update;
+            controller.process(input, update);
+
+            if (nowUs >= 1e6 + measureAfterS * 1e6) {
+                const double ms = bufferedFrames * 1000.0 / kRate;
+                minBufferedMs = std::min(minBufferedMs, ms);
+                maxBufferedMs = std::max(maxBufferedMs, ms);
+                sumBufferedMs += ms;
+                ++measured;
+            }
+            nextTickUs += quantumUs;
+        }
+    }
+};
+
+} // namespace
+
+class TestAudioRateController : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testEstimatorMeasuresSkewThroughJitter()
+    {
+        ClockDriftEstimator clock;
+        std::mt19937 random(3);
+        std::exponential_distribution<double> delay(1.0 / 3000.0);
+        // Remote clock 200 ppm fast, 20 ms packets, exponential delay.
+        for (int i = 0; i < 1500; ++i) {
+            const double remoteUs = i * 20000.0;
+            const double localUs = 5e6 + remoteUs / (1.0 + 200e-6) + delay(random);
+            clock.add(int64_t(localUs), int64_t(remoteUs));
+        }
+        QVERIFY(clock.valid());
+        QVERIFY(std::abs(clock.ppm() - 200.0) < 10.0);
+        QVERIFY(clock.spanUs() > 25000000);
+    }
+
+    void testEstimatorSurvivesTimelineStep()
+    {
+        ClockDriftEstimator clock;
+        for (int i = 0; i < 1500; ++i) {
+            // A 300 ms pause halfway: the remote timeline continues from
+            // where it stopped while the local clock moved on.
+            const double remoteUs = i * 20000.0;
+            const double localUs = remoteUs * (1.0 + 100e-6) + (i >= 750 ? 300000.0 : 0.0);
+            clock.add(int64_t(localUs), int64_t(remoteUs));
+        }
+        QVERIFY(std::abs(clock.ppm() + 100.0) < 2.0);
+
+        clock.reset();
+        QVERIFY(!clock.valid());
+        QCOMPARE(clock.ppm(), 0.0);
+    }
+
+    void testDriftIsFedForwardAndSmallBufferHolds()
+    {
+        Simulation sim;
+        sim.sourcePpm = 150.0;
+        sim.graphPpm = -60.0;
+        sim.run(120.0, 30.0);
+
+        QVERIFY(std::abs(sim.sourceClock.ppm() - 150.0) < 15.0);
+        QVERIFY(std::abs(sim.controller.graphClock().ppm() + 60.0) < 15.0);
+        // The resampler runs ~210 ppm fast to keep up.
+        QVERIFY(std::abs((sim.controller.rate() - 1.0) * 1e6 - 210.0) < 40.0);
+
+        QVERIFY(sim.controller.settled());
+        QVERIFY(sim.controller.convergenceUs() < 30000000);
+        // 45 ms target: no underrun, and no creep from the drift.
+        QVERIFY(sim.minBufferedMs > 5.0);
+        QVERIFY(sim.maxBufferedMs < 45.0 + 20.0);
+        QVERIFY(std::abs(sim.meanBufferedMs() - 45.0) < 3.0);
+    }
+
+    void testFeedForwardConvergesFasterThanPiAlone()
+    {
+        // 700 ppm apart: the integral alone needs most of a minute to wind up.
+        Simulation fed;
+        fed.sourcePpm = 500.0;
+        fed.graphPpm = -200.0;
+        fed.run(60.0, 0.0);
+
+        Simulation plain;
+        plain.sourcePpm = 500.0;
+        plain.graphPpm = -200.0;
+        plain.feedForward = false;
+        plain.run(60.0, 0.0);
+
+        QVERIFY(fed.controller.settled());
+        QVERIFY(fed.controller.convergenceUs() < 20000000);
+        QVERIFY(!plain.controller.settled()
+                || plain.controller.convergenceUs() > 2 * fed.controller.convergenceUs());
+        QVERIFY(fed.maxBufferedMs < plain.maxBufferedMs);
+    }
+
+    void testIdleStreamReleasesRate()
+    {
+        AudioRateController controller(kRate);
+        AudioRateController::Input input;
+        input.frames = 1024;
+        input.targetFrames = 1440;
+        input.hadData = true;
+        input.bufferedFrames = 4800;  // 100 ms over a 30 ms target
+        AudioRateController::Update update;
+        for (int i = 0; i < AudioRateController::kUpdateInterval; ++i) {
+            input.nowUs += 21333;
+            controller.process(input, update);
+        }
+        QVERIFY(update.active);
+        QVERIFY(update.correctionPpm > 0.0);
+
+        input.hadData = false;
+        for (int i = 0; i < AudioRateController::kUpdateInterval; ++i) {
+            input.nowUs += 21333;
+            controller.process(input, update);
+        }
+        QVERIFY(!update.active);
+        QCOMPARE(update.rate, 1.0);
+        QCOMPARE(controller.rate(), 1.0);
+        QCOMPARE(controller.convergenceUs(), int64_t(-1));
+    }
+};
+
+QTEST_GUILESS_MAIN(TestAudioRateController)
+#include "test_audio_rate_controller.moc"
@@ -6,6 +6,7 @@
 #include <climits>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 namespace {
 QStringList capturedMessages;
@@ -217,6 +218,97 @@ private slots:
             QCOMPARE(memory[i], static_cast<uint8_t>(0));
     }
 
+    void floatPlaybackBufferConvertsRingOnceAndAppliesGain()
+    {
+        oap::AudioStreamHandle handle;
+        handle.bytesPerFrame = 4;
+        handle.channels = 2;
+        handle.floatOutput = true;
+        handle.disableRateMatching = true;
+        handle.targetGain.store(0.5f);
+        handle.rtCurrentGain = 0.5f;
+        handle.ringBuffer = std::make_unique<oap::AudioRingBuffer>(8192);
+        // More than one staging chunk so the chunk loop is exercised.
+        const int frames = oap::AudioStreamHandle::kFloatChunkFrames + 3;
+        std::vector<int16_t> input(frames * 2);
+        for (int i = 0; i < frames * 2; ++i)
+            input[i] = static_cast<int16_t>((i % 2) ? -16384 : 32767);
+        QCOMPARE(handle.ringBuffer->write(reinterpret_cast<const uint8_t*>(input.data()),
+                                          input.size() * sizeof(int16_t)),
+                 uint32_t(input.size() * sizeof(int16_t)));
+
+        std::vector<float> memory((frames + 5) * 2, 123.0f);
+        spa_chunk chunk{};
+        spa_data data{};
+        data.data = memory.data();
+        data.maxsize = memory.size() * sizeof(float);
+        data.chunk = &chunk;
+        spa_buffer spa{};
+        spa.n_datas = 1;
+        spa.datas = &data;
+        pw_buffer pw{};
+        pw.buffer = &spa;
+        pw.requested = frames + 5;
+
+        QVERIFY(oap::AudioService::fillPlaybackBuffer(&handle, &pw));
+        QCOMPARE(chunk.stride, 8);
+        QCOMPARE(chunk.size, uint32_t((frames + 5) * 8));
+        QCOMPARE(pw.size, uint32_t(frames + 5));
+        for (int f = 0; f < frames; ++f) {
+            QCOMPARE(memory[f * 2], 32767.0f / 32768.0f * 0.5f);
+            QCOMPARE(memory[f * 2 + 1], -0.25f);
+        }
+        for (size_t i = frames * 2; i < memory.size(); ++i)
+            QCOMPARE(memory[i], 0.0f);
+        QCOMPARE(handle.underrunCount.load(), 0u);
+    }
+
+    void jitterBufferedPlaybackConcealsGapInsteadOfSilence()
+    {
+        oap::AudioService service;
+        oap::AudioStreamHandle handle;
+        handle.sampleRate = 8000;
+        handle.bytesPerFrame = 2;
+        handle.channels = 1;
+        handle.disableRateMatching = true;
+        handle.ringBuffer = std::make_unique<oap::AudioRingBuffer>(4096);
+        // Zero target: start as soon as anything is buffered.
+        handle.jitterBuffer = std::make_unique<oap::AudioJitterBuffer>(
+            *handle.ringBuffer, 8000, 1, 0, 0);
+
+        const std::vector<int16_t> input(100, 8000);
+        QCOMPARE(service.writeTimedAudio(&handle, reinterpret_cast<const uint8_t*>(input.data()),
+                                         int(input.size() * sizeof(int16_t)), 1000),
+                 int(input.size() * sizeof(int16_t)));
+
+        std::vector<int16_t> memory(300, 0x3333);
+        spa_chunk chunk{};
+        spa_data data{};
+        data.data = memory.data();
+        data.maxsize = memory.size() * sizeof(int16_t);
+        data.chunk = &chunk;
+        spa_buffer spa{};
+        spa.n_datas = 1;
+        spa.datas = &data;
+        pw_buffer pw{};
+        pw.buffer = &spa;
+        pw.requested = 300;
+
+        QVERIFY(oap::AudioService::fillPlaybackBuffer(&handle, &pw));
+        QCOMPARE(pw.size, 300u);
+        // 5 ms fade-in (40 frames at 8 kHz), then the packet as sent.
+        QCOMPARE(memory[0], int16_t(0));
+        QCOMPARE(memory[99], int16_t(8000));
+        // The 20 ms (160 frame) concealment starts at the last sample and
+        // fades to zero instead of cutting to silence.
+        QCOMPARE(memory[100], int16_t(8000 * 159 / 160));
+        QVERIFY(memory[180] > 0 && memory[180] < memory[100]);
+        QCOMPARE(memory[259], int16_t(0));
+        QCOMPARE(memory[299], int16_t(0));
+        QCOMPARE(handle.underrunCount.load(), 0u);
+        QCOMPARE(handle.jitterBuffer->takeStats().concealEvents, uint64_t(1));
+    }
+
     void capturePayloadBoundsAreValidatedBeforeCallbackNarrowing()
     {
         uint8_t memory[16]{};
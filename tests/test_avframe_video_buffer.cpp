@@ -0,0 +1,107 @@
+#include <QTest>
+#include "core/aa/AVFrameVideoBuffer.hpp"
+#include <QVideoFrame>
+#include <QVideoFrameFormat>
+#include <cstring>
+#include <memory>
+
+extern "C" {
+#include <libavutil/buffer.h>
+#include <libavutil/frame.h>
+#include <libavutil/pixfmt.h>
+}
+
+namespace {
+
+struct FrameDeleter {
+    void operator()(AVFrame* frame) const { av_frame_free(&frame); }
+};
+using FramePtr = std::unique_ptr<AVFrame, FrameDeleter>;
+
+FramePtr makeFrame(int width, int height)
+{
+    FramePtr frame(av_frame_alloc());
+    frame->format = AV_PIX_FMT_YUV420P;
+    frame->width = width;
+    frame->height = height;
+    // 64-byte alignment pads linesize beyond the visible width, as decoders do.
+    if (av_frame_get_buffer(frame.get(), 64) < 0)
+        return nullptr;
+    std::memset(frame->data[0], 0x10, frame->linesize[0] * height);
+    std::memset(frame->data[1], 0x80, frame->linesize[1] * ((height + 1) / 2));
+    std::memset(frame->data[2], 0xF0, frame->linesize[2] * ((height + 1) / 2));
+    return frame;
+}
+
+} // namespace
+
+class TestAVFrameVideoBuffer : public QObject {
+    Q_OBJECT
+private slots:
+    void testMapExposesDecoderPlanes();
+    void testFrameOutlivesDecoderUnref();
+    void testWriteMapRefused();
+};
+
+void TestAVFrameVideoBuffer::testMapExposesDecoderPlanes()
+{
+    FramePtr decoded = makeFrame(1278, 719);
+    QVERIFY(decoded);
+
+    auto buffer = std::make_unique<oap::aa::AVFrameVideoBuffer>(decoded.get());
+    QVERIFY(buffer->isValid());
+    QVideoFrame frame(std::move(buffer));
+    QCOMPARE(frame.size(), QSize(1278, 719));
+    QCOMPARE(frame.pixelFormat(), QVideoFrameFormat::Format_YUV420P);
+
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+    QCOMPARE(frame.planeCount(), 3);
+    for (int i = 0; i < 3; ++i) {
+        // Same memory and padded strides as the decoder — nothing copied.
+        QCOMPARE(static_cast<const uint8_t*>(frame.bits(i)), decoded->data[i]);
+        QCOMPARE(frame.bytesPerLine(i), decoded->linesize[i]);
+    }
+    QCOMPARE(frame.mappedBytes(0), decoded->linesize[0] * 719);
+    QCOMPARE(frame.mappedBytes(1), decoded->linesize[1] * 360);
+    frame.unmap();
+}
+
+void TestAVFrameVideoBuffer::testFrameOutlivesDecoderUnref()
+{
+    FramePtr decoded = makeFrame(64, 32);
+    QVERIFY(decoded);
+    AVBufferRef* lumaBuffer = decoded->buf[0];
+    QCOMPARE(av_buffer_get_ref_count(lumaBuffer), 1);
+
+    QVideoFrame frame(std::make_unique<oap::aa::AVFrameVideoBuffer>(decoded.get()));
+    QCOMPARE(av_buffer_get_ref_count(lumaBuffer), 2);
+
+    // The decoder moves on to the next frame; Qt's copy keeps the pixels alive.
+    AVBufferRef* keepAlive = av_buffer_ref(lumaBuffer);
+    av_frame_unref(decoded.get());
+    QCOMPARE(av_buffer_get_ref_count(keepAlive), 2);
+
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+    QCOMPARE(frame.bits(0)[0], uchar(0x10));
+    QCOMPARE(frame.bits(2)[0], uchar(0xF0));
+    frame.unmap();
+
+    frame = QVideoFrame();
+    QCOMPARE(av_buffer_get_ref_count(keepAlive), 1);
+    av_buffer_unref(&keepAlive);
+}
+
+void TestAVFrameVideoBuffer::testWriteMapRefused()
+{
+    FramePtr decoded = makeFrame(64, 32);
+    QVERIFY(decoded);
+
+    QVideoFrame frame(std::make_unique<oap::aa::AVFrameVideoBuffer>(decoded.get()));
+    QVERIFY(!frame.map(QVideoFrame::WriteOnly));
+    QVERIFY(!frame.map(QVideoFrame::ReadWrite));
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+    frame.unmap();
+}
+
+QTEST_GUILESS_MAIN(TestAVFrameVideoBuffer)
+#include "test_avframe_video_buffer.moc"
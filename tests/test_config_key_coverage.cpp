@@ -46,21 +46,39 @@ void TestConfigKeyCoverage::testAllRuntimeKeys()
         "connection.wifi_ap.channel",
         "connection.wifi_ap.band",
         "connection.tcp_port",
+        "connection.protocol_thread",
+        "connection.media_ack.mode",
+        "connection.media_ack.flush_threshold",
+        "connection.media_ack.video_hold_backlog",
+        "connection.media_ack.video_max_hold_ms",
         "connection.protocol_capture.enabled",
         "connection.protocol_capture.format",
         "connection.protocol_capture.include_media",
         "connection.protocol_capture.path",
+        "connection.protocol_capture.payload",
         "audio.master_volume",
         "audio.output_device",
+        "audio.sample_format",
+        "audio.profile_stages",
         "audio.buffer_ms.media",
         "audio.buffer_ms.speech",
         "audio.buffer_ms.system",
+        "audio.jitter_buffer.enabled",
+        "audio.jitter_buffer.min_ms",
+        "audio.jitter_buffer.max_ms",
         "audio.microphone.device",
         "audio.microphone.gain",
         "video.fps",
         "video.resolution",
         "video.dpi",
         "video.secondary_display_content",
+        "video.software_output",
+        "video.decode_threading",
+        "video.decode_threads",
+        "video.presentation",
+        "video.presentation_max_delay_ms",
+        "video.catch_up_age_ms",
+        "video.catch_up_request_keyframe",
         "identity.head_unit_name",
         "identity.manufacturer",
         "identity.model",
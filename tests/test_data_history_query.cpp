@@ -0,0 +1,161 @@
+#include <QtTest>
+
+#include "core/services/DataRegistry.hpp"
+#include "core/services/HistoryRing.hpp"
+#include "ui/DataHistoryQuery.hpp"
+
+using namespace oap::data;
+
+namespace {
+
+const QString kProvider = QStringLiteral("com.example.vehicle");
+const QString kSpeed = QStringLiteral("speed");
+
+// Registers the provider and a Double "speed" channel keeping
+// retentionMs / intervalMs points of history.
+void declareSpeed(DataRegistry& registry, quint32 retentionMs, quint32 intervalMs) {
+    ProviderDefinition provider;
+    provider.providerNamespace = kProvider;
+    provider.displayName = QStringLiteral("Vehicle");
+    QVERIFY(registry.registerProvider(1, provider).accepted);
+    ChannelDefinition speed;
+    speed.channelName = kSpeed;
+    speed.displayName = QStringLiteral("Speed");
+    speed.valueType = ValueType::Double;
+    speed.nominalIntervalMs = intervalMs;
+    speed.historyRetentionMs = retentionMs;
+    QVERIFY(registry.declareChannels(1, {speed}).first().accepted);
+}
+
+void publishSpeed(DataRegistry& registry, qint64 observedAtUnixMs, double value) {
+    Sample sample;
+    sample.channelName = kSpeed;
+    sample.value = value;
+    sample.quality = Quality::Good;
+    sample.observedAtUnixMs = observedAtUnixMs;
+    registry.publish(1, {sample});
+}
+
+qint64 timeOf(const QVariant& point) {
+    return point.toMap().value(QStringLiteral("t")).toLongLong();
+}
+
+} // namespace
+
+class TestDataHistoryQuery : public QObject {
+    Q_OBJECT
+private slots:
+    void testQmlQueryShapes();
+    void testNonPositiveBoundsAreOpen();
+    void testGapsAreUndefined();
+    void testResultsAreCappedAtMaxQueryPoints();
+};
+
+void TestDataHistoryQuery::testQmlQueryShapes() {
+    DataRegistry registry;
+    registry.setNowUnixMsForTest([] { return qint64(2000); });
+    declareSpeed(registry, 10000, 100);
+    publishSpeed(registry, 2000, 42.0);
+
+    oap::DataHistoryQuery query(&registry);
+    QCOMPARE(query.capacity(kProvider, kSpeed), 100);
+    QCOMPARE(query.capacity(kProvider, QStringLiteral("rpm")), 0);
+    QVERIFY(query.range(kProvider, QStringLiteral("rpm"), 0, 0).isEmpty());
+
+    const QVariantList points = query.range(kProvider, kSpeed, 0, 0);
+    QCOMPARE(points.size(), 1);
+    QCOMPARE(timeOf(points[0]), qint64(2000));
+    QCOMPARE(points[0].toMap().value(QStringLiteral("value")).toDouble(), 42.0);
+
+    const QVariantList buckets = query.minMax(kProvider, kSpeed, 0, 0, 8);
+    QCOMPARE(buckets.size(), 1);
+    const QVariantMap bucket = buckets[0].toMap();
+    QCOMPARE(bucket.value(QStringLiteral("start")).toLongLong(), qint64(2000));
+    QCOMPARE(bucket.value(QStringLiteral("min")).toDouble(), 42.0);
+    QCOMPARE(bucket.value(QStringLiteral("max")).toDouble(), 42.0);
+    QCOMPARE(bucket.value(QStringLiteral("last")).toDouble(), 42.0);
+    QCOMPARE(bucket.value(QStringLiteral("count")).toUInt(), 1u);
+}
+
+void TestDataHistoryQuery::testNonPositiveBoundsAreOpen() {
+    DataRegistry registry;
+    declareSpeed(registry, 10000, 100);
+    for (qint64 t = 1000; t <= 1400; t += 100) publishSpeed(registry, t, double(t));
+
+    oap::DataHistoryQuery query(&registry);
+    QCOMPARE(query.range(kProvider, kSpeed, 0, 0).size(), 5);
+    QCOMPARE(query.range(kProvider, kSpeed, -1, -1).size(), 5);
+
+    const QVariantList upTo = query.range(kProvider, kSpeed, 0, 1200);
+    QCOMPARE(upTo.size(), 3);
+    QCOMPARE(timeOf(upTo.first()), qint64(1000));
+    QCOMPARE(timeOf(upTo.last()), qint64(1200));
+
+    const QVariantList from = query.range(kProvider, kSpeed, 1200, -5);
+    QCOMPARE(from.size(), 3);
+    QCOMPARE(timeOf(from.first()), qint64(1200));
+    QCOMPARE(timeOf(from.last()), qint64(1400));
+
+    QCOMPARE(query.range(kProvider, kSpeed, 1100, 1300).size(), 3);
+    QCOMPARE(query.decimated(kProvider, kSpeed, 0, 1200, 10).size(), 3);
+    QCOMPARE(query.minMax(kProvider, kSpeed, 1200, 0, 1).first().toMap()
+                 .value(QStringLiteral("count")).toUInt(), 3u);
+}
+
+void TestDataHistoryQuery::testGapsAreUndefined() {
+    DataRegistry registry;
+    declareSpeed(registry, 10000, 100);
+    publishSpeed(registry, 1000, 42.0);
+    Sample gap;
+    gap.channelName = kSpeed;
+    gap.quality = Quality::Unavailable;
+    gap.observedAtUnixMs = 1100;
+    registry.publish(1, {gap});
+    publishSpeed(registry, 1200, 7.0);
+
+    oap::DataHistoryQuery query(&registry);
+    const QVariantList points = query.range(kProvider, kSpeed, 0, 0);
+    QCOMPARE(points.size(), 3);
+    QVERIFY(points[0].toMap().value(QStringLiteral("value")).isValid());
+    // NaN never reaches QML: a gap is an invalid QVariant, undefined in JS.
+    const QVariantMap missing = points[1].toMap();
+    QVERIFY(missing.contains(QStringLiteral("value")));
+    QVERIFY(!missing.value(QStringLiteral("value")).isValid());
+    QCOMPARE(timeOf(points[1]), qint64(1100));
+
+    // Buckets skip the gap rather than reporting it.
+    const QVariantList buckets = query.minMax(kProvider, kSpeed, 0, 0, 1);
+    QCOMPARE(buckets.size(), 1);
+    QCOMPARE(buckets[0].toMap().value(QStringLiteral("count")).toUInt(), 2u);
+    QCOMPARE(buckets[0].toMap().value(QStringLiteral("min")).toDouble(), 7.0);
+}
+
+void TestDataHistoryQuery::testResultsAreCappedAtMaxQueryPoints() {
+    constexpr int kMax = HistoryRing::kMaxQueryPoints;
+    constexpr int kPublished = kMax + 1000;
+    DataRegistry registry;
+    declareSpeed(registry, 2 * kMax, 1);
+    for (qint64 t = 1; t <= kPublished; ++t) publishSpeed(registry, t, double(t));
+
+    oap::DataHistoryQuery query(&registry);
+    QCOMPARE(query.capacity(kProvider, kSpeed), 2 * kMax);
+
+    // range() keeps the newest points.
+    const QVariantList points = query.range(kProvider, kSpeed, 0, 0);
+    QCOMPARE(points.size(), kMax);
+    QCOMPARE(timeOf(points.first()), qint64(kPublished - kMax + 1));
+    QCOMPARE(timeOf(points.last()), qint64(kPublished));
+
+    // Larger point and bucket counts are clamped; unclamped, both would
+    // return every retained point.
+    const QVariantList decimated = query.decimated(kProvider, kSpeed, 0, 0, kPublished);
+    QVERIFY(!decimated.isEmpty());
+    QVERIFY(decimated.size() <= kMax);
+    QCOMPARE(timeOf(decimated.last()), qint64(kPublished));
+    const QVariantList buckets = query.minMax(kProvider, kSpeed, 0, 0, kPublished);
+    QVERIFY(!buckets.isEmpty());
+    QVERIFY(buckets.size() <= kMax);
+}
+
+QTEST_GUILESS_MAIN(TestDataHistoryQuery)
+#include "test_data_history_query.moc"
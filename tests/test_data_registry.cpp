@@ -2,6 +2,8 @@
 
 #include "core/services/DataRegistry.hpp"
 
+#include <cmath>
+
 using namespace oap::data;
 
 namespace {
@@ -43,6 +45,11 @@ private slots:
     void testDeclarationsCatalogAndTypeStability();
     void testTypedPublicationAndDuplicateReduction();
     void testRemovalAndOwnerCleanup();
+    void testFastPublicationByHandle();
+    void testStaleHandlesAreRejected();
+    void testHistorySizedByRateAndBudget();
+    void benchmarkPublish_data();
+    void benchmarkPublish();
 };
 
 void TestDataRegistry::testProviderOwnershipAndMetadata() {
@@ -267,5 +274,200 @@ void TestDataRegistry::testRemovalAndOwnerCleanup() {
     QCOMPARE(registry.catalogRevision(), beforeUnknown + 2);
 }
 
+void TestDataRegistry::testFastPublicationByHandle() {
+    DataRegistry registry;
+    registry.setNowUnixMsForTest([] { return qint64(5150); });
+    QVERIFY(registry.registerProvider(3, provider("com.example.can")).accepted);
+    const QList<DeclarationResult> declared = registry.declareChannels(
+        3,
+        {channel("engine.rpm", ValueType::Double),
+         channel("gear", ValueType::Enum),
+         channel("label", ValueType::String)});
+    const ChannelHandle rpm = declared[0].handle;
+    const ChannelHandle gear = declared[1].handle;
+    const ChannelHandle label = declared[2].handle;
+    QVERIFY(rpm != 0 && gear != 0 && label != 0 && rpm != gear);
+    QCOMPARE(registry.channelHandle(3, QStringLiteral("engine.rpm")), rpm);
+    QCOMPARE(registry.channelHandle(4, QStringLiteral("engine.rpm")), ChannelHandle(0));
+    // Redeclaring an unchanged channel keeps its handle.
+    QCOMPARE(registry.declareChannels(3, {channel("engine.rpm", ValueType::Double)})
+                 .first().handle,
+             rpm);
+
+    QList<QList<Sample>> emitted;
+    connect(&registry, &DataRegistry::valuesAccepted, this,
+            [&emitted](const QString& providerNamespace, const QList<Sample>& samples) {
+                QCOMPARE(providerNamespace, QStringLiteral("com.example.can"));
+                emitted.append(samples);
+            });
+
+    FastSample batch[4];
+    batch[0].channel = rpm;
+    batch[0].value.real = 800.0;
+    batch[1].channel = gear;
+    batch[1].value.integer = 3;
+    batch[1].observedAtUnixMs = 77;
+    batch[2].channel = rpm;
+    batch[2].value.real = 900.0;
+    batch[3].channel = label;   // strings take the Sample path
+    const FastPublishResult result = registry.publishFast(3, batch, 4);
+    QCOMPARE(result.accepted, 2);
+    QCOMPARE(result.rejected, 1);
+
+    QCOMPARE(emitted.size(), 1);
+    QCOMPARE(emitted[0].size(), 2);
+    QCOMPARE(emitted[0][0].channelName, QStringLiteral("gear"));
+    QCOMPARE(std::get<EnumScalar>(*emitted[0][0].value).value, qint64(3));
+    QCOMPARE(*emitted[0][0].observedAtUnixMs, qint64(77));
+    QCOMPARE(emitted[0][1].channelName, QStringLiteral("engine.rpm"));
+    QCOMPARE(*emitted[0][1].observedAtUnixMs, qint64(5150));
+
+    const auto retained = registry.latestSample(
+        {QStringLiteral("com.example.can"), QStringLiteral("engine.rpm")});
+    QCOMPARE(std::get<double>(*retained->value), 900.0);
+    QCOMPARE(retained->quality, Quality::Good);
+
+    // Both paths share the retained sample.
+    registry.publish(3, {sample("engine.rpm", 1000.0)});
+    FastSample unavailable;
+    unavailable.channel = gear;
+    unavailable.quality = Quality::Unavailable;
+    unavailable.hasValue = false;
+    QCOMPARE(registry.publishFast(3, &unavailable, 1).accepted, 1);
+    QVERIFY(!registry.latestSample({QStringLiteral("com.example.can"),
+                                    QStringLiteral("gear")})
+                 ->value.has_value());
+    QCOMPARE(std::get<double>(*registry.latestSample(
+                                  {QStringLiteral("com.example.can"),
+                                   QStringLiteral("engine.rpm")})
+                                  ->value),
+             1000.0);
+}
+
+void TestDataRegistry::testStaleHandlesAreRejected() {
+    DataRegistry registry;
+    QVERIFY(registry.registerProvider(1, provider("com.example.one")).accepted);
+    QVERIFY(registry.registerProvider(2, provider("com.example.two")).accepted);
+    const ChannelHandle first =
+        registry.declareChannels(1, {channel("speed", ValueType::Double)}).first().handle;
+
+    FastSample speed;
+    speed.channel = first;
+    speed.value.real = 42.0;
+    // Another owner cannot publish through the handle.
+    QCOMPARE(registry.publishFast(2, &speed, 1).rejected, 1);
+
+    // The slot is reused after removal, under a new handle.
+    registry.removeChannels(1, {QStringLiteral("speed")});
+    const ChannelHandle second =
+        registry.declareChannels(2, {channel("speed", ValueType::Double)}).first().handle;
+    QVERIFY(second != first);
+    QCOMPARE(registry.publishFast(1, &speed, 1).rejected, 1);
+    speed.channel = second;
+    QCOMPARE(registry.publishFast(2, &speed, 1).accepted, 1);
+
+    registry.removeOwner(2);
+    QCOMPARE(registry.publishFast(2, &speed, 1).rejected, 1);
+}
+
+void TestDataRegistry::testHistorySizedByRateAndBudget() {
+    DataRegistry registry;
+    registry.setHistoryBudgetPoints(250);
+    QVERIFY(registry.registerProvider(1, provider("com.example.can")).accepted);
+    const ChannelRef rpmRef{QStringLiteral("com.example.can"), QStringLiteral("engine.rpm")};
+    const ChannelRef coolantRef{QStringLiteral("com.example.can"), QStringLiteral("coolant")};
+    const ChannelRef labelRef{QStringLiteral("com.example.can"), QStringLiteral("label")};
+
+    // 10 s at 50 ms is 200 points; the next channel gets what is left.
+    ChannelDefinition rpm = channel("engine.rpm", ValueType::Double);
+    rpm.nominalIntervalMs = 50;
+    rpm.historyRetentionMs = 10000;
+    ChannelDefinition coolant = channel("coolant", ValueType::SignedInteger);
+    coolant.historyRetentionMs = 60000;
+    ChannelDefinition label = channel("label", ValueType::String);
+    label.historyRetentionMs = 60000;
+    const QList<DeclarationResult> declared =
+        registry.declareChannels(1, {rpm, coolant, label});
+    QCOMPARE(registry.history(rpmRef)->capacity(), qsizetype(200));
+    QCOMPARE(registry.history(coolantRef)->capacity(), qsizetype(50));
+    QVERIFY(!registry.history(labelRef));
+    QCOMPARE(registry.historyPointsInUse(), qsizetype(250));
+
+    // Both publish paths record; values without usable quality are gaps.
+    registry.publish(1, {sample("engine.rpm", 800.0, Quality::Good, 1000),
+                         sample("coolant", qint64(90), Quality::Good, 1000)});
+    FastSample fast[2];
+    fast[0].channel = declared[0].handle;
+    fast[0].value.real = 900.0;
+    fast[0].observedAtUnixMs = 1050;
+    fast[1].channel = declared[1].handle;
+    fast[1].quality = Quality::Invalid;
+    fast[1].value.integer = -1;
+    fast[1].observedAtUnixMs = 1050;
+    QCOMPARE(registry.publishFast(1, fast, 2).accepted, 2);
+
+    const QList<HistoryPoint> rpmPoints = registry.history(rpmRef)->range(0, 2000);
+    QCOMPARE(rpmPoints.size(), 2);
+    QCOMPARE(rpmPoints[1].value, 900.0);
+    const QList<HistoryPoint> coolantPoints = registry.history(coolantRef)->range(0, 2000);
+    QCOMPARE(coolantPoints[0].value, 90.0);
+    QVERIFY(std::isnan(coolantPoints[1].value));
+
+    // Removal returns the points; a redeclaration with a new rate starts over.
+    registry.removeChannels(1, {QStringLiteral("coolant")});
+    QCOMPARE(registry.historyPointsInUse(), qsizetype(200));
+    rpm.nominalIntervalMs = 100;
+    registry.declareChannels(1, {rpm});
+    QCOMPARE(registry.history(rpmRef)->capacity(), qsizetype(100));
+    QVERIFY(registry.history(rpmRef)->isEmpty());
+    QCOMPARE(registry.historyPointsInUse(), qsizetype(100));
+
+    registry.removeOwner(1);
+    QCOMPARE(registry.historyPointsInUse(), qsizetype(0));
+    QVERIFY(!registry.history(rpmRef));
+}
+
+void TestDataRegistry::benchmarkPublish_data() {
+    QTest::addColumn<bool>("fast");
+    QTest::newRow("samples") << false;
+    QTest::newRow("handles") << true;
+}
+
+// A 64-gauge CAN frame set per batch; prints the sustained samples per
+// second next to the per-batch time.
+void TestDataRegistry::benchmarkPublish() {
+    QFETCH(bool, fast);
+    constexpr int kChannels = 64;
+    DataRegistry registry;
+    QVERIFY(registry.registerProvider(9, provider("com.example.can")).accepted);
+    QList<ChannelDefinition> definitions;
+    for (int i = 0; i < kChannels; ++i)
+        definitions.append(channel(QStringLiteral("gauge.%1").arg(i), ValueType::Double));
+    const QList<DeclarationResult> declared = registry.declareChannels(9, definitions);
+
+    QList<Sample> samples;
+    FastSample fastSamples[kChannels];
+    for (int i = 0; i < kChannels; ++i) {
+        samples.append(sample(definitions[i].channelName, 0.0));
+        fastSamples[i].channel = declared[i].handle;
+    }
+
+    qint64 published = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK {
+        for (int i = 0; i < kChannels; ++i) {
+            if (fast) fastSamples[i].value.real += 1.0;
+            else samples[i].value = std::get<double>(*samples[i].value) + 1.0;
+        }
+        if (fast) registry.publishFast(9, fastSamples, kChannels);
+        else registry.publish(9, samples);
+        published += kChannels;
+    }
+    const qint64 elapsedNs = timer.nsecsElapsed();
+    if (elapsedNs > 0)
+        qInfo("%.0f samples/s", double(published) * 1e9 / double(elapsedNs));
+}
+
 QTEST_MAIN(TestDataRegistry)
 #include "test_data_registry.moc"
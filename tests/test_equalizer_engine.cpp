@@ -2,6 +2,7 @@
 #include <array>
 #include <atomic>
 #include <cmath>
+#include <random>
 #include <thread>
 #include <vector>
 #include "core/audio/EqualizerEngine.hpp"
@@ -487,6 +488,158 @@ private slots:
             QCOMPARE(sigA[i], sigB[i]);
     }
 
+    // --- Kernel tests ---
+
+    void testSimdKernelMatchesScalarBitExactly()
+    {
+        if (!oap::EqualizerEngine::simdKernelName())
+            QSKIP("No SIMD kernel on this target");
+
+        oap::EqualizerEngine scalar;
+        oap::EqualizerEngine simd;
+        scalar.setKernel(oap::EqualizerEngine::Kernel::Scalar);
+        simd.setKernel(oap::EqualizerEngine::Kernel::Simd);
+
+        // Full-scale noise exercises the limiter and the output clamp.
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<int> sample(-32768, 32767);
+        const int totalFrames = 48000;
+        std::vector<int16_t> a(totalFrames * 2);
+        for (auto& s : a)
+            s = static_cast<int16_t>(sample(rng));
+        std::vector<int16_t> b = a;
+
+        std::array<float, oap::kNumBands> gains;
+        for (int i = 0; i < oap::kNumBands; ++i)
+            gains[i] = (i % 2) ? 12.0f : -9.0f;
+        scalar.setAllGains(gains);
+        simd.setAllGains(gains);
+
+        // Odd period sizes split blocks and bulk conversions at every offset;
+        // the changes land mid-ramp and during the bypass crossfade.
+        const int periods[] = {1, 7, 32, 33, 256, 1000, 5};
+        int pos = 0;
+        for (int call = 0; pos < totalFrames; ++call) {
+            if (call == 40) {
+                scalar.setBypassed(true);
+                simd.setBypassed(true);
+            } else if (call == 45) {
+                scalar.setGain(3, -12.0f);
+                simd.setGain(3, -12.0f);
+            } else if (call == 120) {
+                scalar.setBypassed(false);
+                simd.setBypassed(false);
+            }
+            const int frames = std::min(periods[call % 7], totalFrames - pos);
+            scalar.process(a.data() + pos * 2, frames);
+            simd.process(b.data() + pos * 2, frames);
+            pos += frames;
+        }
+
+        for (int i = 0; i < totalFrames * 2; ++i) {
+            if (a[i] != b[i]) {
+                QFAIL(qPrintable(QString("%1 differs from scalar at sample %2: %3 vs %4")
+                                     .arg(oap::EqualizerEngine::simdKernelName())
+                                     .arg(i).arg(b[i]).arg(a[i])));
+            }
+        }
+    }
+
+    void testMonoSimdKernelFallsBackToScalar()
+    {
+        oap::EqualizerEngine scalar(48000.0f, 1);
+        oap::EqualizerEngine simd(48000.0f, 1);
+        scalar.setKernel(oap::EqualizerEngine::Kernel::Scalar);
+        scalar.setGain(5, 12.0f);
+        simd.setGain(5, 12.0f);
+
+        std::vector<int16_t> a(4800);
+        for (int i = 0; i < 4800; ++i)
+            a[i] = static_cast<int16_t>(8000.0f * std::sin(2.0f * M_PI * 1000.0f * i / 48000.0f));
+        std::vector<int16_t> b = a;
+        scalar.process(a.data(), 4800);
+        simd.process(b.data(), 4800);
+        QVERIFY(a == b);
+    }
+
+    void testFloatOutputMatchesInt16Output()
+    {
+        // The F32 overload is the same pipeline without the final
+        // quantization: rounding its output reproduces the int16 path.
+        for (auto kernel : {oap::EqualizerEngine::Kernel::Scalar,
+                            oap::EqualizerEngine::Kernel::Simd}) {
+            oap::EqualizerEngine pcm;
+            oap::EqualizerEngine flt;
+            pcm.setKernel(kernel);
+            flt.setKernel(kernel);
+            pcm.setGain(5, 12.0f);
+            flt.setGain(5, 12.0f);
+
+            auto in = generateStereoSine(1000.0f, 30000.0f, 4800);
+            auto expected = in;
+            std::vector<float> out(in.size());
+            for (int pos = 0; pos < 4800; pos += 300) {
+                pcm.process(expected.data() + pos * 2, 300);
+                flt.process(in.data() + pos * 2, out.data() + pos * 2, 300);
+            }
+            for (size_t i = 0; i < out.size(); ++i) {
+                const float scaled = std::clamp(out[i] * 32768.0f, -32768.0f, 32767.0f);
+                QCOMPARE(static_cast<int16_t>(static_cast<int32_t>(scaled)), expected[i]);
+            }
+        }
+
+        // Fully bypassed, the float path is a plain conversion.
+        oap::EqualizerEngine bypassed;
+        bypassed.setBypassed(true);
+        std::vector<int16_t> warm(9600, 0);
+        bypassed.process(warm.data(), 4800);
+        const int16_t in[4] = {-32768, 16384, 0, 32767};
+        float out[4] = {};
+        bypassed.process(in, out, 2);
+        QCOMPARE(out[0], -1.0f);
+        QCOMPARE(out[1], 0.5f);
+        QCOMPARE(out[2], 0.0f);
+        QCOMPARE(out[3], 32767.0f / 32768.0f);
+    }
+
+    void benchmarkPeriod_data()
+    {
+        QTest::addColumn<bool>("useSimd");
+        QTest::addColumn<bool>("transition");
+        QTest::newRow("scalar") << false << false;
+        QTest::newRow("simd") << true << false;
+        QTest::newRow("scalar-transition") << false << true;
+        QTest::newRow("simd-transition") << true << true;
+    }
+
+    void benchmarkPeriod()
+    {
+        // One 1024-frame stereo PipeWire period with all bands active. The
+        // transition rows restart a coefficient ramp before every period.
+        QFETCH(bool, useSimd);
+        QFETCH(bool, transition);
+        if (useSimd && !oap::EqualizerEngine::simdKernelName())
+            QSKIP("No SIMD kernel on this target");
+
+        oap::EqualizerEngine engine;
+        engine.setKernel(useSimd ? oap::EqualizerEngine::Kernel::Simd
+                                 : oap::EqualizerEngine::Kernel::Scalar);
+        std::array<float, oap::kNumBands> gains;
+        gains.fill(6.0f);
+        engine.setAllGains(gains);
+        auto period = generateStereoSine(1000.0f, 8000.0f, 1024);
+        engine.process(period.data(), 1024);
+
+        float gain = 6.0f;
+        QBENCHMARK {
+            if (transition) {
+                gain = -gain;
+                engine.setGain(5, gain);
+            }
+            engine.process(period.data(), 1024);
+        }
+    }
+
     void testConcurrentPublicationNeverInstallsTornSnapshot()
     {
         oap::EqualizerEngine engine;
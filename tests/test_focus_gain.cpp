@@ -91,6 +91,30 @@ private slots:
         QCOMPARE(done, 0.0f);
         QCOMPARE(second[second.size() - 1], int16_t(0));
     }
+
+    void floatRampMatchesInt16RampWithoutTruncation()
+    {
+        auto pcm = constantFrames(480, 2, 10001);
+        std::vector<float> samples(pcm.size(), 10001.0f / 32768.0f);
+        const float pcmGain = oap::applyFocusGain(pcm.data(), 480, 2, 1.0f, 0.2f);
+        const float floatGain = oap::applyFocusGain(samples.data(), 480, 2, 1.0f, 0.2f);
+        QCOMPARE(floatGain, pcmGain);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            // int16 truncates toward zero; float keeps the fraction.
+            const float scaled = samples[i] * 32768.0f;
+            QVERIFY(scaled >= float(pcm[i]));
+            QVERIFY(scaled < float(pcm[i]) + 1.0f);
+        }
+
+        std::vector<int16_t> in = {-32768, -1, 0, 16384, 32767};
+        std::vector<float> out(in.size());
+        oap::convertS16ToF32(in.data(), out.data(), static_cast<int>(in.size()));
+        QCOMPARE(out[0], -1.0f);
+        QCOMPARE(out[1], -1.0f / 32768.0f);
+        QCOMPARE(out[2], 0.0f);
+        QCOMPARE(out[3], 0.5f);
+        QCOMPARE(out[4], 32767.0f / 32768.0f);
+    }
 };
 
 QTEST_MAIN(TestFocusGain)
@@ -0,0 +1,110 @@
+#include <QtTest>
+
+#include "core/services/HistoryRing.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace oap::data;
+
+namespace {
+
+constexpr qint64 kOpenFrom = std::numeric_limits<qint64>::min();
+constexpr qint64 kOpenTo = std::numeric_limits<qint64>::max();
+constexpr double kGap = std::numeric_limits<double>::quiet_NaN();
+
+} // namespace
+
+class TestHistoryRing : public QObject {
+    Q_OBJECT
+private slots:
+    void testRingWrapsAndRangeStaysOrdered();
+    void testOutOfOrderPointsAreDropped();
+    void testDecimatedKeepsLastPointPerBucket();
+    void testMinMaxBucketsSkipGaps();
+};
+
+void TestHistoryRing::testRingWrapsAndRangeStaysOrdered() {
+    HistoryRing ring(4);
+    QVERIFY(ring.isEmpty());
+    for (qint64 t = 1; t <= 6; ++t) QVERIFY(ring.append(t * 10, double(t)));
+    QCOMPARE(ring.size(), qsizetype(4));
+
+    const QList<HistoryPoint> all = ring.range(kOpenFrom, kOpenTo);
+    QCOMPARE(all.size(), 4);
+    QCOMPARE(all.first().observedAtUnixMs, qint64(30));
+    QCOMPARE(all.last().observedAtUnixMs, qint64(60));
+
+    const QList<HistoryPoint> middle = ring.range(40, 50);
+    QCOMPARE(middle.size(), 2);
+    QCOMPARE(middle[0].value, 4.0);
+    QCOMPARE(middle[1].value, 5.0);
+    QVERIFY(ring.range(61, kOpenTo).isEmpty());
+    QVERIFY(ring.range(50, 40).isEmpty());
+
+    // A capped read keeps the newest points; count() still sees them all.
+    const QList<HistoryPoint> newest = ring.range(kOpenFrom, kOpenTo, 3);
+    QCOMPARE(newest.size(), 3);
+    QCOMPARE(newest.first().observedAtUnixMs, qint64(40));
+    QCOMPARE(newest.last().observedAtUnixMs, qint64(60));
+    QCOMPARE(ring.range(40, 50, 3).size(), 2);
+    QCOMPARE(ring.count(kOpenFrom, kOpenTo), qsizetype(4));
+    QCOMPARE(ring.count(40, 50), qsizetype(2));
+    QCOMPARE(ring.count(50, 40), qsizetype(0));
+
+    // Nothing grows past the capacity given up front.
+    HistoryRing none;
+    QVERIFY(!none.append(1, 1.0));
+    QVERIFY(none.isEmpty());
+}
+
+void TestHistoryRing::testOutOfOrderPointsAreDropped() {
+    HistoryRing ring(8);
+    QVERIFY(ring.append(100, 1.0));
+    QVERIFY(!ring.append(90, 2.0));
+    QVERIFY(ring.append(100, 3.0));
+    QCOMPARE(ring.size(), qsizetype(2));
+    QCOMPARE(ring.range(100, 100).last().value, 3.0);
+}
+
+void TestHistoryRing::testDecimatedKeepsLastPointPerBucket() {
+    HistoryRing ring(1000);
+    for (qint64 t = 0; t < 1000; ++t) ring.append(t, double(t));
+
+    const QList<HistoryPoint> points = ring.decimated(kOpenFrom, kOpenTo, 10);
+    QCOMPARE(points.size(), 10);
+    QCOMPARE(points.first().observedAtUnixMs, qint64(99));
+    QCOMPARE(points.last().observedAtUnixMs, qint64(999));
+
+    // A range already within the limit comes back whole.
+    QCOMPARE(ring.decimated(0, 4, 10).size(), 5);
+    QVERIFY(ring.decimated(kOpenFrom, kOpenTo, 0).isEmpty());
+}
+
+void TestHistoryRing::testMinMaxBucketsSkipGaps() {
+    HistoryRing ring(16);
+    const double values[] = {5.0, -2.0, 7.0, kGap, kGap, kGap, 1.0, 3.0};
+    for (int i = 0; i < 8; ++i) ring.append(1000 + i * 10, values[i]);
+
+    // Four 18 ms buckets over the retained 1000..1070; the all-gap one is
+    // omitted.
+    const QList<HistoryBucket> buckets = ring.buckets(kOpenFrom, kOpenTo, 4);
+    QCOMPARE(buckets.size(), 3);
+    QCOMPARE(buckets[0].startUnixMs, qint64(1000));
+    QCOMPARE(buckets[0].endUnixMs, qint64(1017));
+    QCOMPARE(buckets[0].minimum, -2.0);
+    QCOMPARE(buckets[0].maximum, 5.0);
+    QCOMPARE(buckets[0].last, -2.0);
+    QCOMPARE(buckets[0].count, quint32(2));
+    QCOMPARE(buckets[1].startUnixMs, qint64(1018));
+    QCOMPARE(buckets[1].count, quint32(1));
+    QCOMPARE(buckets[2].startUnixMs, qint64(1054));
+    QCOMPARE(buckets[2].minimum, 1.0);
+    QCOMPARE(buckets[2].maximum, 3.0);
+
+    // Raw reads keep the gaps.
+    QVERIFY(std::isnan(ring.range(1030, 1030).first().value));
+}
+
+QTEST_GUILESS_MAIN(TestHistoryRing)
+#include "test_history_ring.moc"
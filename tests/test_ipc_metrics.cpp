@@ -0,0 +1,104 @@
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocalSocket>
+#include <QTest>
+#include <QUuid>
+
+#include "core/LatencyHistogram.hpp"
+#include "core/MetricsRegistry.hpp"
+#include "core/services/IpcServer.hpp"
+
+using namespace oap;
+
+class TestIpcMetrics : public QObject {
+    Q_OBJECT
+
+    QString socketPath() const
+    {
+        return QDir::tempPath() + "/oap-ipc-metrics-"
+            + QUuid::createUuid().toString(QUuid::WithoutBraces) + ".sock";
+    }
+
+    QJsonObject roundTrip(const QString& socketPath, const QJsonObject& request)
+    {
+        QLocalSocket socket;
+        socket.connectToServer(socketPath);
+        if (!socket.waitForConnected(2000))
+            return {};
+
+        socket.write(QJsonDocument(request).toJson(QJsonDocument::Compact) + "\n");
+        socket.flush();
+
+        QElapsedTimer timer;
+        timer.start();
+        while (socket.bytesAvailable() == 0 && timer.elapsed() < 2000) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 20);
+            socket.waitForReadyRead(20);
+        }
+
+        const QJsonObject response = QJsonDocument::fromJson(socket.readAll().trimmed()).object();
+        socket.disconnectFromServer();
+        return response;
+    }
+
+    static QJsonObject findMetric(const QJsonObject& dump, const QString& name)
+    {
+        for (const auto& value : dump.value("metrics").toArray()) {
+            if (value.toObject().value("name").toString() == name)
+                return value.toObject();
+        }
+        return {};
+    }
+
+private slots:
+    void getMetricsDumpsRegisteredHistograms()
+    {
+        LatencyHistogram histogram;
+        auto registration = MetricsRegistry::instance().add(
+            QStringLiteral("touch.total"), QStringLiteral("ipc-test"), QStringLiteral("us"), &histogram);
+        for (int i = 0; i < 99; ++i)
+            histogram.record(1000);
+        histogram.record(80000);
+
+        IpcServer server;
+        const QString ipcSocketPath = socketPath();
+        QVERIFY(server.start(ipcSocketPath));
+
+        QJsonObject metric = findMetric(roundTrip(ipcSocketPath, {{"command", "get_metrics"}}),
+                                        QStringLiteral("touch.total"));
+        QCOMPARE(metric.value("label").toString(), QStringLiteral("ipc-test"));
+        QCOMPARE(metric.value("count").toInteger(), 100);
+        QVERIFY(metric.value("p50").toInteger() < 1100);
+        QVERIFY(metric.value("p999").toInteger() >= 80000);
+
+        // A reset dump still reports the interval it closes.
+        metric = findMetric(roundTrip(ipcSocketPath, {{"command", "get_metrics"},
+                                                      {"data", QJsonObject{{"reset", true}}}}),
+                            QStringLiteral("touch.total"));
+        QCOMPARE(metric.value("count").toInteger(), 100);
+        metric = findMetric(roundTrip(ipcSocketPath, {{"command", "get_metrics"}}),
+                            QStringLiteral("touch.total"));
+        QCOMPARE(metric.value("count").toInteger(), 0);
+    }
+
+    void getMetricsRejectsUnknownFields()
+    {
+        IpcServer server;
+        const QString ipcSocketPath = socketPath();
+        QVERIFY(server.start(ipcSocketPath));
+
+        QJsonObject response = roundTrip(ipcSocketPath, {{"command", "get_metrics"},
+                                                         {"data", QJsonObject{{"bogus", 1}}}});
+        QVERIFY(!response.value("ok").toBool(true));
+        response = roundTrip(ipcSocketPath, {{"command", "get_metrics"},
+                                             {"data", QJsonObject{{"reset", "yes"}}}});
+        QVERIFY(!response.value("error").toString().isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(TestIpcMetrics)
+#include "test_ipc_metrics.moc"
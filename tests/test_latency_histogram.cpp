@@ -0,0 +1,170 @@
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonObject>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/LatencyHistogram.hpp"
+#include "core/MetricsRegistry.hpp"
+
+using oap::LatencyBuckets;
+using oap::LatencyHistogram;
+
+namespace {
+
+QJsonObject findMetric(const QJsonObject& dump, const QString& name, const QString& label)
+{
+    for (const auto& value : dump.value("metrics").toArray()) {
+        const QJsonObject metric = value.toObject();
+        if (metric.value("name").toString() == name && metric.value("label").toString() == label)
+            return metric;
+    }
+    return {};
+}
+
+} // namespace
+
+class TestLatencyHistogram : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testBucketsCoverRangeContiguously()
+    {
+        QCOMPARE(LatencyBuckets::lowerBound(0), uint64_t(0));
+        for (int i = 1; i < LatencyHistogram::kBucketCount; ++i)
+            QCOMPARE(LatencyBuckets::lowerBound(i), LatencyBuckets::upperBound(i - 1) + 1);
+        QCOMPARE(LatencyBuckets::upperBound(LatencyHistogram::kBucketCount - 1),
+                 LatencyBuckets::kMaxValue);
+
+        for (uint64_t value : {uint64_t(0), uint64_t(1), uint64_t(63), uint64_t(64),
+                               uint64_t(1000), uint64_t(16667), uint64_t(1) << 30,
+                               LatencyBuckets::kMaxValue}) {
+            const int index = LatencyBuckets::index(value);
+            QVERIFY(value >= LatencyBuckets::lowerBound(index));
+            QVERIFY(value <= LatencyBuckets::upperBound(index));
+            // Bucket width stays within 1/kSubBuckets of its values.
+            const uint64_t width = LatencyBuckets::upperBound(index) - LatencyBuckets::lowerBound(index) + 1;
+            QVERIFY(width == 1 || width * LatencyBuckets::kSubBuckets <= LatencyBuckets::lowerBound(index));
+        }
+        QCOMPARE(LatencyBuckets::index(LatencyBuckets::kMaxValue + 12345),
+                 LatencyHistogram::kBucketCount - 1);
+    }
+
+    void testPercentilesTrackExactValues()
+    {
+        LatencyHistogram histogram;
+        std::mt19937_64 rng(7);
+        std::lognormal_distribution<double> latencyUs(8.0, 1.0);
+        std::vector<uint64_t> samples;
+        for (int i = 0; i < 50000; ++i) {
+            const uint64_t value = static_cast<uint64_t>(latencyUs(rng));
+            samples.push_back(value);
+            histogram.record(value);
+        }
+        std::sort(samples.begin(), samples.end());
+
+        const LatencyHistogram::Snapshot snap = histogram.snapshot();
+        QCOMPARE(snap.count, uint64_t(samples.size()));
+        for (double p : {50.0, 90.0, 99.0, 99.9}) {
+            const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * samples.size())) - 1;
+            const double exact = double(samples[rank]);
+            const double reported = double(snap.percentile(p));
+            QVERIFY2(reported >= exact && reported <= exact * (1.0 + 1.0 / LatencyBuckets::kSubBuckets),
+                     qPrintable(QStringLiteral("p%1 exact=%2 reported=%3").arg(p).arg(exact).arg(reported)));
+        }
+        QVERIFY(snap.max() >= samples.back());
+        QVERIFY(snap.min() <= samples.front());
+    }
+
+    void testSmallValuesAreExact()
+    {
+        LatencyHistogram histogram;
+        for (uint64_t v = 1; v <= 10; ++v)
+            histogram.record(v);
+        const LatencyHistogram::Snapshot snap = histogram.snapshot();
+        QCOMPARE(snap.percentile(50.0), uint64_t(5));
+        QCOMPARE(snap.percentile(100.0), uint64_t(10));
+        QCOMPARE(snap.min(), uint64_t(1));
+        QCOMPARE(snap.mean(), 5.5);
+        QCOMPARE(LatencyHistogram::Snapshot().percentile(99.0), uint64_t(0));
+    }
+
+    void testWindowReportsOnlyNewSamples()
+    {
+        LatencyHistogram histogram;
+        oap::LatencyWindow window(histogram);
+        for (int i = 0; i < 100; ++i)
+            histogram.record(50000);
+        LatencyHistogram::Snapshot first = window.take();
+        QCOMPARE(first.count, uint64_t(100));
+
+        for (int i = 0; i < 10; ++i)
+            histogram.record(100);
+        LatencyHistogram::Snapshot second = window.take();
+        QCOMPARE(second.count, uint64_t(10));
+        QCOMPARE(second.max(), uint64_t(100));
+        QCOMPARE(second.sum, uint64_t(1000));
+
+        window.reset();
+        QCOMPARE(window.take().count, uint64_t(0));
+        QCOMPARE(histogram.snapshot().count, uint64_t(110));
+    }
+
+    void testConcurrentRecordLosesNothing()
+    {
+        LatencyHistogram histogram;
+        constexpr int kThreads = 4;
+        constexpr int kSamples = 100000;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&histogram, t]() {
+                for (int i = 0; i < kSamples; ++i)
+                    histogram.record(uint64_t(t * 1000 + i % 1000));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        QCOMPARE(histogram.snapshot().count, uint64_t(kThreads * kSamples));
+    }
+
+    void testRegistryDumpsAndForgetsHistograms()
+    {
+        auto& registry = oap::MetricsRegistry::instance();
+        LatencyHistogram histogram;
+        for (int i = 0; i < 1000; ++i)
+            histogram.record(uint64_t(i));
+
+        {
+            oap::MetricsRegistry::Registration registration = registry.add(
+                QStringLiteral("test.metric"), QStringLiteral("a"), QStringLiteral("us"), &histogram);
+            QVERIFY(registration.isRegistered());
+
+            // Samples recorded before registration are not reported.
+            QJsonObject metric = findMetric(registry.toJson(), "test.metric", "a");
+            QCOMPARE(metric.value("count").toInteger(), 0);
+
+            histogram.record(20000);
+            histogram.record(40000);
+            registration.setLabel(QStringLiteral("b"));
+            metric = findMetric(registry.toJson(), "test.metric", "b");
+            QCOMPARE(metric.value("unit").toString(), QStringLiteral("us"));
+            QCOMPARE(metric.value("count").toInteger(), 2);
+            QVERIFY(metric.value("p50").toInteger() >= 20000);
+            QVERIFY(metric.value("p999").toInteger() >= 40000);
+            QVERIFY(metric.contains("p90"));
+            QVERIFY(metric.contains("p99"));
+
+            registry.resetBaseline();
+            metric = findMetric(registry.toJson(), "test.metric", "b");
+            QCOMPARE(metric.value("count").toInteger(), 0);
+        }
+        QVERIFY(findMetric(registry.toJson(), "test.metric", "b").isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(TestLatencyHistogram)
+#include "test_latency_histogram.moc"
@@ -1,7 +1,10 @@
 #include <QtTest>
 #include "core/Logging.hpp"
 
+#include <atomic>
 #include <cstdio>
+#include <thread>
+#include <vector>
 #include <unistd.h>
 
 namespace {
@@ -35,6 +38,8 @@ public:
         if (!file_)
             return result;
 
+        // The handler writes from a background thread.
+        oap::flushLogs();
         fflush(stderr);
         rewind(file_);
         char buffer[256];
@@ -91,6 +96,10 @@ private slots:
     void testLibraryDetectionNewTags();
     void testNonLibraryMessage();
 
+    // Async sink
+    void testConcurrentBurstIsWrittenOrCounted();
+    void testFlushLogsWaitsForQueuedMessages();
+
     void cleanup();
     void cleanupTestCase();
 };
@@ -277,6 +286,59 @@ void TestLogging::testNonLibraryMessage()
     QVERIFY(!oap::isLibraryMessage("default", "src/main.cpp", QStringLiteral("Hello")));
 }
 
+void TestLogging::testConcurrentBurstIsWrittenOrCounted()
+{
+    constexpr int kThreads = 4;
+    constexpr int kMessages = 5000;
+    const quint64 droppedBefore = oap::droppedLogMessages();
+
+    StderrCapture capture;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < kMessages; ++i)
+                qCInfo(lcCore).noquote() << QStringLiteral("burst-%1-%2").arg(t).arg(i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    const QList<QByteArray> lines = capture.output().split('\n');
+
+    int written = 0;
+    int lastIndex[kThreads];
+    std::fill(std::begin(lastIndex), std::end(lastIndex), -1);
+    for (const QByteArray& line : lines) {
+        const int pos = line.indexOf("burst-");
+        if (pos < 0)
+            continue;
+        const QList<QByteArray> parts = line.mid(pos + 6).split('-');
+        QCOMPARE(parts.size(), 2);
+        const int thread = parts[0].toInt();
+        const int index = parts[1].toInt();
+        QVERIFY(thread >= 0 && thread < kThreads);
+        // Per-thread order survives the merge.
+        QVERIFY(index > lastIndex[thread]);
+        lastIndex[thread] = index;
+        ++written;
+    }
+    const quint64 dropped = oap::droppedLogMessages() - droppedBefore;
+    QCOMPARE(quint64(written) + dropped, quint64(kThreads * kMessages));
+}
+
+void TestLogging::testFlushLogsWaitsForQueuedMessages()
+{
+    const QString marker = QStringLiteral("flush-barrier-marker");
+    QByteArray output;
+    {
+        StderrCapture capture;
+        std::thread worker([&marker]() { qCWarning(lcCore).noquote() << marker; });
+        worker.join();
+        output = capture.output();
+    }
+    QVERIFY(output.contains(marker.toUtf8()));
+    QVERIFY(output.contains("[W] [Core]"));
+}
+
 void TestLogging::cleanup()
 {
     // Every test leaves the installed handler with quiet defaults.
@@ -0,0 +1,140 @@
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonObject>
+
+#include <cmath>
+
+#include "core/audio/ProcessProfiler.hpp"
+
+using oap::ProcessProfiler;
+
+namespace {
+
+// 1024 frames at 48 kHz.
+constexpr uint64_t kPeriodNs = 21333333;
+constexpr uint32_t kFrames = 1024;
+constexpr uint32_t kRate = 48000;
+
+bool hasMetric(const QString& name, const QString& label)
+{
+    const QJsonObject dump = oap::MetricsRegistry::instance().toJson();
+    for (const auto& value : dump.value("metrics").toArray()) {
+        const QJsonObject metric = value.toObject();
+        if (metric.value("name").toString() == name && metric.value("label").toString() == label)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+class TestProcessProfiler : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testLoadClassifiesNearMissesAndOverruns()
+    {
+        ProcessProfiler profiler;
+        uint64_t now = 1000000000;
+        // 10%, 80% and 120% of the period.
+        for (uint64_t permille : {100u, 800u, 1200u}) {
+            profiler.begin(now);
+            profiler.end(now + kPeriodNs * permille / 1000, kFrames, kRate);
+            now += kPeriodNs;
+        }
+
+        const ProcessProfiler::Summary summary = profiler.take();
+        QCOMPARE(summary.duration.count, uint64_t(3));
+        QCOMPARE(summary.nearMisses, uint32_t(1));
+        QCOMPARE(summary.overruns, uint32_t(1));
+        QVERIFY(summary.load.max() >= 1199);
+        QCOMPARE(summary.period.count, uint64_t(3));
+        QVERIFY(std::abs(summary.period.mean() - double(kPeriodNs)) < 1.0);
+
+        // Counters and windows restart after each take().
+        const ProcessProfiler::Summary next = profiler.take();
+        QCOMPARE(next.duration.count, uint64_t(0));
+        QCOMPARE(next.overruns, uint32_t(0));
+    }
+
+    void testIntervalIsMeasuredAgainstPreviousPeriod()
+    {
+        ProcessProfiler profiler;
+        uint64_t now = 1000000000;
+        profiler.begin(now);
+        profiler.end(now + 1000, kFrames, kRate);
+
+        // On time, then a wake-up two periods later.
+        now += kPeriodNs;
+        profiler.begin(now);
+        profiler.end(now + 1000, kFrames, kRate);
+        now += 2 * kPeriodNs;
+        profiler.begin(now);
+        profiler.end(now + 1000, kFrames, kRate);
+
+        const ProcessProfiler::Summary summary = profiler.take();
+        QCOMPARE(summary.interval.count, uint64_t(2));
+        QCOMPARE(summary.lateWakeups, uint32_t(1));
+        QVERIFY(summary.interval.max() >= 2 * kPeriodNs);
+    }
+
+    void testCallbackWithoutBufferRecordsDurationOnly()
+    {
+        ProcessProfiler profiler;
+        profiler.begin(5000);
+        profiler.end(6000, 0, kRate);
+
+        const ProcessProfiler::Summary summary = profiler.take();
+        QCOMPARE(summary.duration.count, uint64_t(1));
+        QCOMPARE(summary.load.count, uint64_t(0));
+        QCOMPARE(summary.period.count, uint64_t(0));
+        QCOMPARE(summary.stagePercent(ProcessProfiler::Equalizer), 0.0);
+    }
+
+    void testStagesAreChargedOnlyWhenEnabled()
+    {
+        ProcessProfiler off;
+        off.begin(ProcessProfiler::nowNs());
+        off.lap(ProcessProfiler::Equalizer);
+        off.end(ProcessProfiler::nowNs(), kFrames, kRate);
+        QCOMPARE(off.take().stages[ProcessProfiler::Equalizer].count, uint64_t(0));
+
+        ProcessProfiler on;
+        on.setStageTiming(true);
+        on.begin(ProcessProfiler::nowNs());
+        QTest::qSleep(2);
+        on.lap(ProcessProfiler::Equalizer);
+        on.lap(ProcessProfiler::Gain);
+        on.end(ProcessProfiler::nowNs(), kFrames, kRate);
+
+        const ProcessProfiler::Summary summary = on.take();
+        for (int s = 0; s < ProcessProfiler::kStageCount; ++s)
+            QCOMPARE(summary.stages[s].count, uint64_t(1));
+        QVERIFY(summary.stages[ProcessProfiler::Equalizer].sum >= 2000000);
+        QCOMPARE(summary.stages[ProcessProfiler::RateMatch].sum, uint64_t(0));
+        // 2 ms of a 21.3 ms period.
+        QVERIFY(summary.stagePercent(ProcessProfiler::Equalizer) > 9.0);
+    }
+
+    void testMetricsRegisterWithStreamLabel()
+    {
+        {
+            ProcessProfiler profiler;
+            profiler.registerMetrics(QStringLiteral("aa_media"));
+            QVERIFY(hasMetric("audio.process", "aa_media"));
+            QVERIFY(hasMetric("audio.interval", "aa_media"));
+            QVERIFY(hasMetric("audio.load", "aa_media"));
+            QVERIFY(!hasMetric("audio.stage.eq", "aa_media"));
+        }
+        QVERIFY(!hasMetric("audio.process", "aa_media"));
+
+        ProcessProfiler staged;
+        staged.setStageTiming(true);
+        staged.registerMetrics(QStringLiteral("aa_speech"));
+        QVERIFY(hasMetric("audio.stage.eq", "aa_speech"));
+        QVERIFY(hasMetric("audio.stage.rate", "aa_speech"));
+    }
+};
+
+QTEST_GUILESS_MAIN(TestProcessProfiler)
+#include "test_process_profiler.moc"
@@ -202,6 +202,123 @@ test('shared binding preserves exact scalars, metadata, and monotonic receipt',
     assert.equal(socket.sent.map(h.decode).filter(m => m.unsubscribeDataChannelsRequest).length, 1);
 });
 
+test('delivery options shape each subscriber and reach the server', async () => {
+    const h = harness();
+    const socket = await h.connect(true);
+    const ref = dataRef('engine.rpm');
+    const dashboard = [];
+    const full = [];
+    h.sandbox.prodigy.data.subscribe(ref, e => { if (e.sample) dashboard.push(e.sample.value); },
+                                     { minIntervalMs: 100, latestOnly: true });
+    await Promise.resolve();
+    const subscriptions = () => socket.sent.map(h.decode)
+        .filter(m => m.subscribeDataChannelsRequest)
+        .map(m => m.subscribeDataChannelsRequest);
+    assert.equal(subscriptions().length, 1);
+    assert.equal(subscriptions()[0].options.minIntervalMs, 100);
+    assert.equal(subscriptions()[0].options.latestOnly, true);
+
+    h.receive(socket, {
+        dataChannelAvailabilityEvent: {
+            channel: ref, availability: 1,
+            definition: { channelName: 'engine.rpm', displayName: 'RPM', valueType: 1 },
+            catalogRevision: 1,
+        },
+    });
+    const publish = (value, atMs, quality = 1) => {
+        h.setMonotonic(atMs);
+        h.receive(socket, {
+            dataValuesEvent: {
+                providerNamespace: ref.providerNamespace,
+                samples: [{ channelName: 'engine.rpm', value: { doubleValue: value }, quality }],
+            },
+        });
+    };
+    publish(800, 0);
+    publish(810, 30);
+    publish(820, 60);
+    assert.deepEqual(dashboard, [800]);
+    assert.equal(h.reconnects.length, 1);
+    h.setMonotonic(100);
+    h.reconnects.shift()();
+    assert.deepEqual(dashboard, [800, 820]);
+
+    // A quality change goes out inside the interval and replaces the held sample.
+    publish(822, 102);
+    assert.equal(h.reconnects.length, 1);
+    publish(825, 105, 2);
+    assert.deepEqual(dashboard, [800, 820, 825]);
+    h.reconnects.shift()();
+    assert.deepEqual(dashboard, [800, 820, 825]);
+
+    // An unshaped listener widens what the server sends for the binding.
+    h.sandbox.prodigy.data.subscribe(ref, e => { if (e.sample) full.push(e.sample.value); });
+    await Promise.resolve();
+    assert.equal(subscriptions().length, 2);
+    assert.equal(subscriptions()[1].options, null);
+    publish(830, 110);
+    publish(840, 150);
+    assert.deepEqual(full, [830, 840]);
+    // 830 is back to good quality, so it skips the interval as well.
+    assert.deepEqual(dashboard, [800, 820, 825, 830]);
+});
+
+test('history queries send the range and map points and buckets', async () => {
+    const h = harness();
+    const socket = await h.connect(true);
+    const ref = dataRef('coolant');
+
+    const pendingRaw = h.sandbox.prodigy.data.queryHistory(ref, { fromUnixMs: 1000 });
+    await Promise.resolve();
+    const raw = h.decode(socket.sent.at(-1));
+    assert.equal(raw.queryDataHistoryRequest.channel.channelName, 'coolant');
+    assert.equal(Number(raw.queryDataHistoryRequest.fromUnixMs), 1000);
+    assert.equal(raw.queryDataHistoryRequest.toUnixMs, null);
+    assert.equal(raw.queryDataHistoryRequest.mode, 0);
+    h.receive(socket, {
+        requestId: raw.requestId,
+        queryDataHistoryResponse: {
+            accepted: true, capacity: 600,
+            points: [{ observedAtUnixMs: 1000, value: 88.5 }, { observedAtUnixMs: 1100 }],
+        },
+    });
+    const history = await pendingRaw;
+    assert.equal(history.capacity, 600);
+    assert.equal(history.truncated, false);
+    assert.equal(history.points.length, 2);
+    assert.equal(history.points[0].timestampMs, 1000);
+    assert.equal(history.points[0].value, 88.5);
+    assert.equal(history.points[1].value, undefined);
+
+    const pendingBuckets = h.sandbox.prodigy.data.queryHistory(ref, { mode: 'minMax', maxPoints: 60 });
+    await Promise.resolve();
+    const bucketed = h.decode(socket.sent.at(-1));
+    assert.equal(bucketed.queryDataHistoryRequest.mode, 2);
+    assert.equal(bucketed.queryDataHistoryRequest.maxPoints, 60);
+    h.receive(socket, {
+        requestId: bucketed.requestId,
+        queryDataHistoryResponse: {
+            accepted: true, capacity: 600,
+            buckets: [{ startUnixMs: 0, endUnixMs: 999, minimum: 80, maximum: 90, last: 85, count: 10 }],
+        },
+    });
+    const buckets = (await pendingBuckets).buckets;
+    assert.equal(buckets.length, 1);
+    assert.equal(buckets[0].endMs, 999);
+    assert.equal(buckets[0].min, 80);
+    assert.equal(buckets[0].max, 90);
+
+    const pendingRejected = h.sandbox.prodigy.data.queryHistory(dataRef('label'));
+    await Promise.resolve();
+    h.receive(socket, {
+        requestId: h.decode(socket.sent.at(-1)).requestId,
+        queryDataHistoryResponse: { accepted: false, reason: 'channel keeps no history' },
+    });
+    await assert.rejects(pendingRejected, /channel keeps no history/);
+    await assert.rejects(h.sandbox.prodigy.data.queryHistory(ref, { mode: 'median' }),
+                         /unknown history mode/);
+});
+
 test('double, signed, unsigned, boolean, and string mappings are fixed', async () => {
     const h = harness();
     const socket = await h.connect(true);
@@ -0,0 +1,82 @@
+#include <QTest>
+
+#include "core/TransitJitterEstimator.hpp"
+
+using oap::TransitJitterEstimator;
+
+class TestTransitJitterEstimator : public QObject {
+    Q_OBJECT
+private slots:
+    void testJitterIsMeasuredAboveMinimumTransit();
+    void testMappingFollowsDriftWithinTwoWindows();
+    void testTimelineJumpReanchors();
+    void testRetargetHintAndP95();
+};
+
+void TestTransitJitterEstimator::testJitterIsMeasuredAboveMinimumTransit()
+{
+    TransitJitterEstimator transit;
+    QVERIFY(!transit.hasOffset());
+    QCOMPARE(transit.recentP95Us(), int64_t(0));
+
+    QCOMPARE(transit.observe(0, 1000000).jitterUs, int64_t(0));
+    QCOMPARE(transit.observe(20000, 1030000).jitterUs, int64_t(10000));
+    // A faster arrival lowers the mapping itself.
+    QCOMPARE(transit.observe(40000, 1035000).jitterUs, int64_t(0));
+    QCOMPARE(transit.offsetUs(), int64_t(995000));
+    QCOMPARE(transit.observe(60000, 1060000).jitterUs, int64_t(5000));
+}
+
+void TestTransitJitterEstimator::testMappingFollowsDriftWithinTwoWindows()
+{
+    TransitJitterEstimator transit;
+    transit.observe(0, 1000000);
+    // The transit rises by 20 ms for good (the clocks drifted). The old
+    // minimum holds through the current and the next window, then goes.
+    const int64_t windowUs = TransitJitterEstimator::kOffsetWindowUs;
+    transit.observe(windowUs / 2, 1000000 + windowUs / 2 + 20000);
+    QCOMPARE(transit.offsetUs(), int64_t(1000000));
+    transit.observe(windowUs, 1000000 + windowUs + 20000);
+    QCOMPARE(transit.offsetUs(), int64_t(1000000));
+    transit.observe(2 * windowUs, 1000000 + 2 * windowUs + 20000);
+    QCOMPARE(transit.offsetUs(), int64_t(1020000));
+}
+
+void TestTransitJitterEstimator::testTimelineJumpReanchors()
+{
+    TransitJitterEstimator transit;
+    for (int i = 0; i < 10; ++i)
+        transit.observe(500000000 + int64_t(i) * 20000, 1000000 + int64_t(i) * 20000 + i * 1000);
+    QVERIFY(transit.recentP95Us() > 0);
+
+    // The remote restarted its timeline: no jitter spike, history forgotten.
+    const TransitJitterEstimator::Observation jump = transit.observe(0, 1300000);
+    QCOMPARE(jump.jitterUs, int64_t(0));
+    QCOMPARE(transit.offsetUs(), int64_t(1300000));
+    QCOMPARE(transit.recentP95Us(), int64_t(0));
+
+    transit.reset();
+    QVERIFY(!transit.hasOffset());
+}
+
+void TestTransitJitterEstimator::testRetargetHintAndP95()
+{
+    TransitJitterEstimator transit;
+    int hints = 0;
+    // Every 20th sample is 30 ms late, the rest on time: 5% late.
+    for (int i = 0; i < 100; ++i) {
+        const int64_t lateUs = (i % 20 == 19) ? 30000 : 0;
+        if (transit.observe(int64_t(i) * 20000, 1000000 + int64_t(i) * 20000 + lateUs).retarget)
+            ++hints;
+    }
+    QCOMPARE(hints, 100 / TransitJitterEstimator::kRetargetInterval);
+    QCOMPARE(transit.recentP95Us(), int64_t(30000));
+
+    // Mostly on time again: the percentile follows the recent samples.
+    for (int i = 100; i < 100 + int(TransitJitterEstimator::kJitterSamples); ++i)
+        transit.observe(int64_t(i) * 20000, 1000000 + int64_t(i) * 20000);
+    QCOMPARE(transit.recentP95Us(), int64_t(0));
+}
+
+QTEST_GUILESS_MAIN(TestTransitJitterEstimator)
+#include "test_transit_jitter_estimator.moc"
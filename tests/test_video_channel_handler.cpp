@@ -209,6 +209,9 @@ private slots:
         qint64 emittedTs = frameSpy[0][1].value<qint64>();
         QVERIFY(emittedTs > 0);
         QVERIFY(emittedTs != 1234567890); // Must NOT be the protocol timestamp
+        // The protocol timestamp travels separately for presentation scheduling
+        QCOMPARE(frameSpy[0][2].value<qint64>(), qint64(1234567890));
+        QCOMPARE(frameSpy[1][2].value<qint64>(), qint64(1234567891));
 
         // Should send ACK for each frame
         QCOMPARE(sendSpy.count(), 2);
@@ -235,6 +238,60 @@ private slots:
         QCOMPARE(handler.ackCount(), 0u);
     }
 
+    void testMediaPayloadSharesAssembledBuffer() {
+        qRegisterMetaType<std::shared_ptr<const QByteArray>>();
+
+        oaa::hu::VideoChannelHandler handler;
+        handler.onChannelOpened();
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(1);
+        start.set_config(0);
+        QByteArray startPayload(start.ByteSizeLong(), '\0');
+        start.SerializeToArray(startPayload.data(), startPayload.size());
+        handler.onMessage(oaa::AVMessageId::START_INDICATION, startPayload);
+
+        QSignalSpy frameSpy(&handler, &oaa::hu::VideoChannelHandler::videoFrameData);
+
+        // Message ID (2) + timestamp (8) + access unit, as AASession routes it
+        QByteArray message(10 + 2048, '\x07');
+        const char* expected = message.constData() + 10;
+        handler.onMediaPayload(message, 10, 42, true);
+        message = {};  // the emitted view must keep the bytes alive
+
+        QCOMPARE(frameSpy.count(), 1);
+        auto shared = frameSpy[0][0].value<std::shared_ptr<const QByteArray>>();
+        QVERIFY(shared);
+        QCOMPARE(shared->size(), 2048);
+        QVERIFY(shared->constData() == expected);
+        QCOMPARE(shared->at(2047), '\x07');
+    }
+
+    void testPhoneTimestampZeroIsKept() {
+        qRegisterMetaType<std::shared_ptr<const QByteArray>>();
+
+        oaa::hu::VideoChannelHandler handler;
+        handler.onChannelOpened();
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(1);
+        start.set_config(0);
+        QByteArray startPayload(start.ByteSizeLong(), '\0');
+        start.SerializeToArray(startPayload.data(), startPayload.size());
+        handler.onMessage(oaa::AVMessageId::START_INDICATION, startPayload);
+
+        QSignalSpy frameSpy(&handler, &oaa::hu::VideoChannelHandler::videoFrameData);
+
+        // AV_MEDIA_WITH_TIMESTAMP at phone time 0 is a real timestamp...
+        QByteArray timed(2 + 8 + 64, '\x00');
+        QVERIFY(oaa::IAVChannelHandler::dispatchMedia(&handler, 0x0000, timed, 2));
+        // ...while AV_MEDIA_INDICATION carries none.
+        QByteArray untimed(2 + 64, '\x00');
+        QVERIFY(oaa::IAVChannelHandler::dispatchMedia(&handler, 0x0001, untimed, 2));
+
+        QCOMPARE(frameSpy.count(), 2);
+        QCOMPARE(frameSpy[0][2].value<qint64>(), qint64(0));
+        QCOMPARE(frameSpy[1][2].value<qint64>(), qint64(-1));
+    }
+
     void testVideoMediaAckPolicy_data() {
         QTest::addColumn<int>("galMajor");
         QTest::addColumn<int>("galMinor");
@@ -282,6 +339,132 @@ private slots:
         QCOMPARE(handler.ackCount(), 1u);
     }
 
+    void testCoalescedAcksReduceOutboundRecords() {
+        qRegisterMetaType<std::shared_ptr<const QByteArray>>();
+
+        oaa::hu::VideoChannelHandler handler;
+        oaa::MediaAckPolicy policy;
+        policy.mode = oaa::MediaAckPolicy::Mode::Coalesced;
+        handler.setAckPolicy(policy);
+        handler.onChannelOpened();
+
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(5);
+        start.set_config(0);
+        handler.onMessage(oaa::AVMessageId::START_INDICATION,
+                          QByteArray::fromStdString(start.SerializeAsString()));
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        // One socket read delivering several access units, then a turn break.
+        for (int i = 0; i < 4; ++i)
+            handler.onMediaData(QByteArray(512, '\x01'), i);
+        QCOMPARE(sendSpy.count(), 0);
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 1);
+
+        // Permits still owed at a restart go out under the old session id.
+        handler.onMediaData(QByteArray(512, '\x01'), 4);
+        start.set_session(6);
+        handler.onMessage(oaa::AVMessageId::START_INDICATION,
+                          QByteArray::fromStdString(start.SerializeAsString()));
+        QCOMPARE(sendSpy.count(), 2);
+
+        oaa::proto::messages::AVMediaAckIndication first;
+        const QByteArray firstPayload = sendSpy[0][2].toByteArray();
+        QVERIFY(first.ParseFromArray(firstPayload.constData(), firstPayload.size()));
+        QCOMPARE(first.session_id(), 5);
+        QCOMPARE(first.ack_count(), 4);
+        oaa::proto::messages::AVMediaAckIndication second;
+        const QByteArray secondPayload = sendSpy[1][2].toByteArray();
+        QVERIFY(second.ParseFromArray(secondPayload.constData(), secondPayload.size()));
+        QCOMPARE(second.session_id(), 5);
+        QCOMPARE(second.ack_count(), 1);
+
+        QCOMPARE(handler.receivedFrameCount(), 5u);
+        QCOMPARE(handler.ackCount(), 2u);
+        QCOMPARE(handler.ackedFrameCount(), 5u);
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 2);
+    }
+
+    void testBackPressureHoldsAcksWhileDecoderIsBehind() {
+        qRegisterMetaType<std::shared_ptr<const QByteArray>>();
+
+        oaa::hu::VideoChannelHandler handler;
+        oaa::MediaAckPolicy policy;
+        policy.holdBacklog = 2;
+        policy.maxHoldMs = 5000;
+        handler.setAckPolicy(policy);
+        uint32_t backlog = 0;
+        handler.setBacklogProbe([&backlog]() { return backlog; });
+        qint64 nowUs = 1000000;
+        handler.setAckClockForTest([&nowUs]() { return nowUs; });
+        handler.onChannelOpened();
+
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(9);
+        start.set_config(0);
+        handler.onMessage(oaa::AVMessageId::START_INDICATION,
+                          QByteArray::fromStdString(start.SerializeAsString()));
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        handler.onMediaData(QByteArray(64, '\x01'), 0);
+        QCOMPARE(sendSpy.count(), 1);
+
+        // Decoder falls behind: permits are withheld, frames still flow.
+        backlog = 3;
+        handler.onMediaData(QByteArray(64, '\x01'), 1);
+        handler.onMediaData(QByteArray(64, '\x01'), 2);
+        nowUs += 20000;
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 1);
+        QCOMPARE(handler.receivedFrameCount(), 3u);
+
+        // Once it catches up, every held permit goes out in one indication.
+        backlog = 1;
+        QTRY_COMPARE(sendSpy.count(), 2);
+        oaa::proto::messages::AVMediaAckIndication ack;
+        const QByteArray ackPayload = sendSpy[1][2].toByteArray();
+        QVERIFY(ack.ParseFromArray(ackPayload.constData(), ackPayload.size()));
+        QCOMPARE(ack.session_id(), 9);
+        QCOMPARE(ack.ack_count(), 2);
+        QCOMPARE(handler.ackedFrameCount(), 3u);
+        QCOMPARE(handler.ackHoldCount(), uint64_t(1));
+        QCOMPARE(handler.ackHoldTimeoutCount(), uint64_t(0));
+        QCOMPARE(handler.ackHeldUs(), uint64_t(20000));
+    }
+
+    void testBackPressureHoldIsBounded() {
+        qRegisterMetaType<std::shared_ptr<const QByteArray>>();
+
+        oaa::hu::VideoChannelHandler handler;
+        oaa::MediaAckPolicy policy;
+        policy.holdBacklog = 1;
+        policy.maxHoldMs = 30;
+        handler.setAckPolicy(policy);
+        handler.setBacklogProbe([]() { return uint32_t(50); });
+        qint64 nowUs = 1000000;
+        handler.setAckClockForTest([&nowUs]() { return nowUs; });
+        handler.onChannelOpened();
+
+        oaa::proto::messages::AVChannelStartIndication start;
+        start.set_session(3);
+        start.set_config(0);
+        handler.onMessage(oaa::AVMessageId::START_INDICATION,
+                          QByteArray::fromStdString(start.SerializeAsString()));
+
+        QSignalSpy sendSpy(&handler, &oaa::IChannelHandler::sendRequested);
+        handler.onMediaData(QByteArray(64, '\x01'), 0);
+        nowUs += 29000;
+        QCoreApplication::processEvents();
+        QCOMPARE(sendSpy.count(), 0);
+        // A stuck decoder must not stall the phone for good.
+        nowUs += 1000;
+        QTRY_COMPARE(sendSpy.count(), 1);
+        QCOMPARE(handler.ackHoldTimeoutCount(), uint64_t(1));
+        QCOMPARE(handler.ackHeldUs(), uint64_t(30000));
+    }
+
     void testMediaOptionsEmitsOneBoundedTypedSummary() {
         oaa::hu::VideoChannelHandler handler;
         QSignalSpy optionsSpy(
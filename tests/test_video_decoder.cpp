@@ -3,6 +3,7 @@
 #include <QMutex>
 #include <QStringList>
 
+#include "core/aa/PerfStats.hpp"
 #include "core/aa/VideoDecoder.hpp"
 
 namespace {
@@ -19,6 +20,16 @@ QByteArray annexBNal(char first, char second = '\x01')
     return data;
 }
 
+/// A decodable 16x16 H.264 IDR access unit (SPS, PPS, one I_PCM macroblock).
+QByteArray pcmIdrAccessUnit()
+{
+    const QByteArray startCode("\x00\x00\x00\x01", 4);
+    return startCode + QByteArray::fromHex("6742c00ada79")
+        + startCode + QByteArray::fromHex("68ce3880")
+        + startCode + QByteArray::fromHex("6588848680")
+        + QByteArray(16 * 16 + 2 * 8 * 8, '\x80') + QByteArray(1, '\x80');
+}
+
 } // namespace
 
 namespace oap::aa {
@@ -30,6 +41,28 @@ public:
         VideoDecoder::failCodecInitForTest_.store(true);
     }
 
+    static void enableCatchUp(VideoDecoder& decoder, int ageMs, bool requestKeyframes)
+    {
+        decoder.catchUpAgeNs_ = qint64(ageMs) * 1000000;
+        decoder.requestKeyframes_ = requestKeyframes;
+    }
+
+    /// Queue @p frames in one step, as if they had piled up while the worker
+    /// was busy, each enqueued @p ageMs ago.
+    static void enqueueBacklog(VideoDecoder& decoder, const QList<QByteArray>& frames, int ageMs)
+    {
+        const qint64 enqueueTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            PerfStats::Clock::now().time_since_epoch()).count() - qint64(ageMs) * 1000000;
+        VideoDecoder::DecodeWorker* worker = decoder.worker_;
+        QMutexLocker locker(&worker->mutex_);
+        for (const QByteArray& frame : frames) {
+            VideoDecoder::DecodeWorker::WorkItem item;
+            item.data = std::make_shared<const QByteArray>(frame);
+            item.enqueueTimeNs = enqueueTimeNs;
+            worker->queue_.push_back(std::move(item));
+        }
+        worker->condition_.wakeOne();
+    }
 };
 
 } // namespace oap::aa
@@ -183,6 +216,175 @@ private slots:
         QTest::qWait(30);
         QCOMPARE(errorSpy.count(), 1);
     }
+
+    void decodedFrameCarriesPhoneTimestamp()
+    {
+        oap::aa::VideoDecoder decoder;
+        QVideoSink sink;
+        decoder.setVideoSink(&sink);
+        QSignalSpy frameSpy(&decoder, &oap::aa::VideoDecoder::frameReady);
+
+        decoder.beginStream();
+        // The parser releases an access unit once the next one starts, so the
+        // second unit pushes the first through with the first's timestamp.
+        decoder.decodeFrame(std::make_shared<const QByteArray>(pcmIdrAccessUnit()), 0, 40000);
+        decoder.decodeFrame(std::make_shared<const QByteArray>(pcmIdrAccessUnit()), 0, 73000);
+
+        QTRY_COMPARE(frameSpy.count(), 1);
+        const QVideoFrame frame = decoder.takeLatestFrame();
+        QVERIFY(frame.isValid());
+        QCOMPARE(frame.startTime(), qint64(40000));
+    }
+
+    void sliceThreadPolicyScalesWithHeightAndCores()
+    {
+        using oap::aa::VideoDecoder;
+        // Dual-core and single-core hosts stay single-threaded.
+        QCOMPARE(VideoDecoder::sliceThreadCount(1, 1080), 1);
+        QCOMPARE(VideoDecoder::sliceThreadCount(2, 1080), 1);
+
+        QCOMPARE(VideoDecoder::sliceThreadCount(4, 480), 2);
+        QCOMPARE(VideoDecoder::sliceThreadCount(4, 720), 2);
+        QCOMPARE(VideoDecoder::sliceThreadCount(4, 1080), 3);
+        // One core is always left for the UI, audio and protocol threads.
+        QCOMPARE(VideoDecoder::sliceThreadCount(4, 1440), 3);
+        QCOMPARE(VideoDecoder::sliceThreadCount(8, 1440), 4);
+        QCOMPARE(VideoDecoder::sliceThreadCount(16, 2160), 6);
+
+        // Unknown height is sized as 720p.
+        QCOMPARE(VideoDecoder::sliceThreadCount(8, 0),
+                 VideoDecoder::sliceThreadCount(8, 720));
+    }
+
+    void accessUnitScanStopsAtFirstSlice()
+    {
+        using oap::aa::VideoDecoder;
+        // H.264: SPS + PPS + IDR, a lone P slice, and SEI ahead of an IDR.
+        const QByteArray idr = annexBNal('\x67') + annexBNal('\x68') + annexBNal('\x65');
+        QCOMPARE(VideoDecoder::scanAccessUnit(idr, AV_CODEC_ID_H264),
+                 uint8_t(VideoDecoder::kRandomAccess | VideoDecoder::kParameterSets
+                         | VideoDecoder::kPicture));
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x41'), AV_CODEC_ID_H264),
+                 uint8_t(VideoDecoder::kPicture));
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x06') + annexBNal('\x65'),
+                                              AV_CODEC_ID_H264),
+                 uint8_t(VideoDecoder::kRandomAccess | VideoDecoder::kPicture));
+        // Parameter sets after the first slice belong to a later picture.
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x41') + annexBNal('\x67'),
+                                              AV_CODEC_ID_H264),
+                 uint8_t(VideoDecoder::kPicture));
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x67') + annexBNal('\x68'),
+                                              AV_CODEC_ID_H264),
+                 uint8_t(VideoDecoder::kParameterSets));
+
+        // H.265: VPS + IDR_W_RADL, a CRA (not a clean skip point), TRAIL_R.
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x40') + annexBNal('\x26'),
+                                              AV_CODEC_ID_H265),
+                 uint8_t(VideoDecoder::kRandomAccess | VideoDecoder::kParameterSets
+                         | VideoDecoder::kPicture));
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x2a'), AV_CODEC_ID_H265),
+                 uint8_t(VideoDecoder::kPicture));
+        QCOMPARE(VideoDecoder::scanAccessUnit(annexBNal('\x02'), AV_CODEC_ID_H265),
+                 uint8_t(VideoDecoder::kPicture));
+
+        QCOMPARE(VideoDecoder::scanAccessUnit(idr, AV_CODEC_ID_VP9), uint8_t(0));
+        QCOMPARE(VideoDecoder::scanAccessUnit(QByteArray("\x00\x00", 2), AV_CODEC_ID_H264),
+                 uint8_t(0));
+    }
+
+    void staleBacklogSkipsToNewestKeyframe()
+    {
+        oap::aa::VideoDecoder decoder;
+        oap::aa::VideoDecoderTestAccess::enableCatchUp(decoder, 100, false);
+        QSignalSpy codecSpy(&decoder, &oap::aa::VideoDecoder::streamCodecDetected);
+        QSignalSpy keyframeSpy(&decoder, &oap::aa::VideoDecoder::keyframeNeeded);
+
+        decoder.beginStream();
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x67')));
+        QTRY_COMPARE(codecSpy.count(), 1);
+
+        // P P IDR P [SPS PPS] IDR P: the older IDR is skipped too, the
+        // standalone parameter sets are kept for the newest one.
+        oap::aa::VideoDecoderTestAccess::enqueueBacklog(
+            decoder,
+            {annexBNal('\x41'), annexBNal('\x41'), annexBNal('\x65'), annexBNal('\x41'),
+             annexBNal('\x67') + annexBNal('\x68'), annexBNal('\x65'), annexBNal('\x41')},
+            500);
+        QTRY_COMPARE(decoder.queueDepth(), 0);
+        QCOMPARE(decoder.catchUpCount(), uint64_t(1));
+        QCOMPARE(decoder.catchUpDroppedFrames(), uint64_t(4));
+        QCOMPARE(decoder.catchUpSaved().snapshot().count, uint64_t(1));
+        QCOMPARE(keyframeSpy.count(), 0);
+
+        // A fresh backlog is decoded in full.
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x41')));
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x65')));
+        QTRY_COMPARE(decoder.queueDepth(), 0);
+        QCOMPARE(decoder.catchUpCount(), uint64_t(1));
+    }
+
+    void staleBacklogDropsParameterSetsThatCarryAPicture()
+    {
+        oap::aa::VideoDecoder decoder;
+        oap::aa::VideoDecoderTestAccess::enableCatchUp(decoder, 100, false);
+        QSignalSpy codecSpy(&decoder, &oap::aa::VideoDecoder::streamCodecDetected);
+
+        decoder.beginStream();
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x67')));
+        QTRY_COMPARE(codecSpy.count(), 1);
+
+        // P [SPS PPS P] IDR: the parameter sets share an access unit with a
+        // stale P slice, so that unit is skipped along with the lone P.
+        oap::aa::VideoDecoderTestAccess::enqueueBacklog(
+            decoder,
+            {annexBNal('\x41'), annexBNal('\x67') + annexBNal('\x68') + annexBNal('\x41'),
+             annexBNal('\x65')},
+            500);
+        QTRY_COMPARE(decoder.queueDepth(), 0);
+        QCOMPARE(decoder.catchUpCount(), uint64_t(1));
+        QCOMPARE(decoder.catchUpDroppedFrames(), uint64_t(2));
+    }
+
+    void staleBacklogStartingAtKeyframeRequestsNone()
+    {
+        oap::aa::VideoDecoder decoder;
+        oap::aa::VideoDecoderTestAccess::enableCatchUp(decoder, 100, true);
+        QSignalSpy codecSpy(&decoder, &oap::aa::VideoDecoder::streamCodecDetected);
+        QSignalSpy keyframeSpy(&decoder, &oap::aa::VideoDecoder::keyframeNeeded);
+
+        decoder.beginStream();
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x67')));
+        QTRY_COMPARE(codecSpy.count(), 1);
+
+        oap::aa::VideoDecoderTestAccess::enqueueBacklog(
+            decoder, {annexBNal('\x65'), annexBNal('\x41'), annexBNal('\x41')}, 500);
+        QTRY_COMPARE(decoder.queueDepth(), 0);
+        QCOMPARE(decoder.catchUpCount(), uint64_t(0));
+        QCOMPARE(keyframeSpy.count(), 0);
+        QCOMPARE(decoder.keyframeRequestCount(), uint64_t(0));
+    }
+
+    void staleBacklogWithoutKeyframeRequestsOneOncePerInterval()
+    {
+        oap::aa::VideoDecoder decoder;
+        oap::aa::VideoDecoderTestAccess::enableCatchUp(decoder, 100, true);
+        QSignalSpy codecSpy(&decoder, &oap::aa::VideoDecoder::streamCodecDetected);
+        QSignalSpy keyframeSpy(&decoder, &oap::aa::VideoDecoder::keyframeNeeded);
+
+        const quint64 generation = decoder.beginStream();
+        decoder.decodeFrame(std::make_shared<const QByteArray>(annexBNal('\x67')));
+        QTRY_COMPARE(codecSpy.count(), 1);
+
+        oap::aa::VideoDecoderTestAccess::enqueueBacklog(
+            decoder, {annexBNal('\x41'), annexBNal('\x41'), annexBNal('\x41')}, 500);
+        QTRY_COMPARE(decoder.queueDepth(), 0);
+        QTRY_COMPARE(keyframeSpy.count(), 1);
+        QCOMPARE(keyframeSpy[0][0].toULongLong(), generation);
+        QCOMPARE(decoder.catchUpCount(), uint64_t(0));
+        QCOMPARE(decoder.keyframeRequestCount(), uint64_t(1));
+        QTest::qWait(30);
+        QCOMPARE(keyframeSpy.count(), 1);
+    }
 };
 
 QTEST_MAIN(TestVideoDecoder)
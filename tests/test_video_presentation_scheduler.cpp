@@ -0,0 +1,201 @@
+#include <QTest>
+#include <QVideoFrame>
+#include <QVideoFrameFormat>
+
+#include "core/aa/VideoPresentationScheduler.hpp"
+
+using oap::aa::VideoPresentationScheduler;
+
+namespace {
+
+constexpr int64_t kVsyncUs = 16667;
+constexpr int64_t kFrameUs = 33333;
+
+QVideoFrame frameAt(int64_t ptsUs)
+{
+    QVideoFrame frame(QVideoFrameFormat(QSize(16, 16), QVideoFrameFormat::Format_YUV420P));
+    if (ptsUs >= 0)
+        frame.setStartTime(ptsUs);
+    return frame;
+}
+
+} // namespace
+
+class TestVideoPresentationScheduler : public QObject {
+    Q_OBJECT
+private slots:
+    void testLowestLatencyShowsNewestFrame();
+    void testSmoothKeepsPhoneCadenceThroughBurst();
+    void testSmoothDropsFramesThatMissedTheirVsync();
+    void testTargetDelayFollowsJitterAndIsCapped();
+    void testUntimedFramesPresentImmediately();
+    void testUntimedFrameDoesNotWaitBehindTimedFrames();
+    void testTimelineJumpResyncs();
+    void testQueueIsBounded();
+};
+
+void TestVideoPresentationScheduler::testLowestLatencyShowsNewestFrame()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.push(frameAt(0), 1000000);
+    scheduler.push(frameAt(kFrameUs), 1000000 + kFrameUs);
+    scheduler.push(frameAt(2 * kFrameUs), 1000000 + 2 * kFrameUs);
+
+    const QVideoFrame shown = scheduler.takeDue(1000000 + 2 * kFrameUs, kVsyncUs);
+    QCOMPARE(shown.startTime(), 2 * kFrameUs);
+    QVERIFY(!scheduler.hasPending());
+    QCOMPARE(scheduler.stats().presented, uint64_t(1));
+    QCOMPARE(scheduler.stats().droppedSuperseded, uint64_t(2));
+    QCOMPARE(scheduler.stats().droppedLate, uint64_t(0));
+}
+
+void TestVideoPresentationScheduler::testSmoothKeepsPhoneCadenceThroughBurst()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    const int64_t base = 5000000;
+
+    // First frame anchors the clock mapping.
+    scheduler.push(frameAt(0), base);
+    QCOMPARE(scheduler.takeDue(base, kVsyncUs).startTime(), int64_t(0));
+
+    // Frames 1-3 arrive together 3 frame periods in (a network stall).
+    const int64_t burst = base + 3 * kFrameUs;
+    for (int i = 1; i <= 3; ++i)
+        scheduler.push(frameAt(i * kFrameUs), burst);
+
+    // Everything already overdue goes out at the next vsync; the newest
+    // wins, the one that missed its slot is counted late.
+    const QVideoFrame shown = scheduler.takeDue(burst, kVsyncUs);
+    QCOMPARE(shown.startTime(), 3 * kFrameUs);
+    QCOMPARE(scheduler.stats().droppedLate, uint64_t(2));
+
+    // Steady arrival afterwards: each frame appears at its own vsync.
+    for (int i = 4; i < 8; ++i) {
+        const int64_t ready = base + i * kFrameUs + 2000;
+        scheduler.push(frameAt(i * kFrameUs), ready);
+        QVERIFY(!scheduler.takeDue(ready - kVsyncUs, kVsyncUs).isValid());
+        QCOMPARE(scheduler.takeDue(ready, kVsyncUs).startTime(), i * kFrameUs);
+    }
+    QVERIFY(scheduler.jitter().snapshot().max() >= uint64_t(2 * kFrameUs));
+}
+
+void TestVideoPresentationScheduler::testSmoothDropsFramesThatMissedTheirVsync()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    const int64_t base = 1000000;
+    for (int i = 0; i < 4; ++i)
+        scheduler.push(frameAt(i * kFrameUs), base + i * kFrameUs);
+
+    // The display stalled for four frame periods: only the newest due frame
+    // is shown, it is counted as presented late, older ones as dropped late.
+    const int64_t vsync = base + 4 * kFrameUs;
+    QCOMPARE(scheduler.takeDue(vsync, kVsyncUs).startTime(), 3 * kFrameUs);
+    const VideoPresentationScheduler::Stats& stats = scheduler.stats();
+    QCOMPARE(stats.presented, uint64_t(1));
+    QCOMPARE(stats.presentedLate, uint64_t(1));
+    QCOMPARE(stats.droppedLate, uint64_t(3));
+    QVERIFY(scheduler.lateness().snapshot().max() >= uint64_t(kFrameUs));
+}
+
+void TestVideoPresentationScheduler::testTargetDelayFollowsJitterAndIsCapped()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    const int64_t base = 1000000;
+
+    // Every fourth frame arrives 20 ms late.
+    for (int i = 0; i < 64; ++i) {
+        const int64_t extra = (i % 4 == 3) ? 20000 : 0;
+        scheduler.push(frameAt(i * kFrameUs), base + i * kFrameUs + extra);
+        scheduler.takeDue(base + i * kFrameUs + extra, kVsyncUs);
+    }
+    QCOMPARE(scheduler.stats().targetDelayUs, int64_t(20000));
+
+    VideoPresentationScheduler capped;
+    capped.setMode(VideoPresentationScheduler::Mode::Smooth);
+    capped.setMaxDelayUs(5000);
+    for (int i = 0; i < 64; ++i) {
+        const int64_t extra = (i % 4 == 3) ? 20000 : 0;
+        capped.push(frameAt(i * kFrameUs), base + i * kFrameUs + extra);
+        capped.takeDue(base + i * kFrameUs + extra, kVsyncUs);
+    }
+    QCOMPARE(capped.stats().targetDelayUs, int64_t(5000));
+}
+
+void TestVideoPresentationScheduler::testUntimedFramesPresentImmediately()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    scheduler.push(frameAt(-1), 2000000);
+    QVERIFY(scheduler.takeDue(2000000, kVsyncUs).isValid());
+    QCOMPARE(scheduler.stats().untimed, uint64_t(1));
+}
+
+void TestVideoPresentationScheduler::testUntimedFrameDoesNotWaitBehindTimedFrames()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    const int64_t base = 1000000;
+    // Build up a 20 ms target delay, as above.
+    for (int i = 0; i < 64; ++i) {
+        const int64_t extra = (i % 4 == 3) ? 20000 : 0;
+        scheduler.push(frameAt(i * kFrameUs), base + i * kFrameUs + extra);
+        scheduler.takeDue(base + i * kFrameUs + extra, kVsyncUs);
+    }
+    QCOMPARE(scheduler.stats().targetDelayUs, int64_t(20000));
+    const uint64_t superseded = scheduler.stats().droppedSuperseded;
+
+    // A timed frame held by the target delay, then an untimed one.
+    const int64_t ready = base + 64 * kFrameUs;
+    scheduler.push(frameAt(64 * kFrameUs), ready);
+    QCOMPARE(scheduler.nextDueUs(), ready + 20000);
+    scheduler.push(frameAt(-1), ready + 1000);
+    QCOMPARE(scheduler.nextDueUs(), ready + 1000);
+
+    const QVideoFrame shown = scheduler.takeDue(ready + 1000, kVsyncUs);
+    QVERIFY(shown.isValid());
+    QCOMPARE(shown.startTime(), int64_t(-1));
+    QVERIFY(!scheduler.hasPending());
+    QCOMPARE(scheduler.stats().droppedSuperseded, superseded + 1);
+
+    // Timed frames after it keep their own due times.
+    scheduler.push(frameAt(65 * kFrameUs), ready + kFrameUs);
+    QCOMPARE(scheduler.nextDueUs(), ready + kFrameUs + 20000);
+}
+
+void TestVideoPresentationScheduler::testTimelineJumpResyncs()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    scheduler.push(frameAt(500000000), 1000000);
+    scheduler.takeDue(1000000, kVsyncUs);
+
+    // The phone restarted its encoder with a fresh timeline; the next frame
+    // must not be held for minutes or treated as hopelessly late.
+    scheduler.push(frameAt(0), 1000000 + kFrameUs);
+    QCOMPARE(scheduler.takeDue(1000000 + kFrameUs, kVsyncUs).startTime(), int64_t(0));
+    QCOMPARE(scheduler.stats().presentedLate, uint64_t(0));
+}
+
+void TestVideoPresentationScheduler::testQueueIsBounded()
+{
+    VideoPresentationScheduler scheduler;
+    scheduler.setMode(VideoPresentationScheduler::Mode::Smooth);
+    scheduler.push(frameAt(0), 0);
+    // Frames far in the future relative to their arrival pile up.
+    for (int i = 1; i <= 20; ++i)
+        scheduler.push(frameAt(int64_t(i) * 10000), 1);
+    QCOMPARE(scheduler.nextDueUs() >= 0, true);
+    QCOMPARE(scheduler.stats().droppedOverflow,
+             uint64_t(21 - VideoPresentationScheduler::kMaxQueued));
+    QCOMPARE(scheduler.stats().droppedLate, uint64_t(0));
+
+    scheduler.reset();
+    QVERIFY(!scheduler.hasPending());
+    QCOMPARE(scheduler.nextDueUs(), int64_t(-1));
+}
+
+QTEST_GUILESS_MAIN(TestVideoPresentationScheduler)
+#include "test_video_presentation_scheduler.moc"
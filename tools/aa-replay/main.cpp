@@ -0,0 +1,158 @@
+// Headless AA session replay: feeds a binary protocol capture through the
+// same video and audio channel handlers the orchestrator registers, into
+// VideoDecoder and AudioService, with no phone, transport or TLS. Decoder and
+// audio [Perf] lines are enabled so decode and audio latency can be profiled
+// on a dev box against real traffic.
+//
+//   aa-replay capture.oacap               captured wall-clock pacing
+//   aa-replay --max-speed capture.oacap   as fast as the pipeline accepts
+//   aa-replay --no-audio capture.oacap    no PipeWire; audio is only counted
+//
+// Record the capture from the start of a session (protocol capture attaches
+// when the session is created) so the AV setup/start messages are present.
+#include <QCommandLineParser>
+#include <QGuiApplication>
+#include <QLoggingCategory>
+#include <QTimer>
+
+#include <memory>
+
+#include <oaa/Channel/ChannelId.hpp>
+#include <oaa/HU/Handlers/AudioChannelHandler.hpp>
+#include <oaa/HU/Handlers/VideoChannelHandler.hpp>
+#include <oaa/Session/SessionReplayer.hpp>
+
+#include "core/aa/VideoDecoder.hpp"
+#include "core/services/AudioService.hpp"
+
+namespace {
+
+struct AudioSink {
+    const char* name;
+    uint8_t channelId;
+    int priority;
+    int sampleRate;
+    int channels;
+    std::unique_ptr<oaa::hu::AudioChannelHandler> handler;
+    oap::AudioStreamHandle* stream = nullptr;
+    quint64 bytes = 0;
+};
+
+// Let queued decode work and audio writes land before the summary.
+constexpr int kDrainMs = 250;
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("aa-replay"));
+    QLoggingCategory::setFilterRules(QStringLiteral("oap.aa.debug=true\noap.audio.debug=true"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Replay a binary AA session capture headlessly"));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("capture"),
+        QStringLiteral("Capture written with connection.protocol_capture.format: binary"));
+    const QCommandLineOption maxSpeedOption(QStringLiteral("max-speed"),
+        QStringLiteral("Dispatch as fast as the pipeline accepts instead of captured pacing"));
+    const QCommandLineOption noAudioOption(QStringLiteral("no-audio"),
+        QStringLiteral("Do not open PipeWire streams; audio payloads are only counted"));
+    parser.addOptions({maxSpeedOption, noAudioOption});
+    parser.process(app);
+    if (parser.positionalArguments().size() != 1)
+        parser.showHelp(1);
+    const QString capturePath = parser.positionalArguments().first();
+
+    oaa::SessionReplayer replayer;
+    replayer.setPace(parser.isSet(maxSpeedOption) ? oaa::SessionReplayer::Pace::MaxSpeed
+                                                  : oaa::SessionReplayer::Pace::WallClock);
+
+    // Video: handler -> decoder exactly as ProjectedDisplaySession wires it.
+    oaa::hu::VideoChannelHandler video;
+    oap::aa::VideoDecoder decoder;
+    decoder.setDiagnosticLabel(QStringLiteral("[replay]"));
+    quint64 decodedFrames = 0;
+    QObject::connect(&video, &oaa::hu::VideoChannelHandler::streamStarted,
+                     &decoder, [&decoder](int32_t, uint32_t) { decoder.beginStream(); });
+    QObject::connect(&video, &oaa::hu::VideoChannelHandler::streamStopped,
+                     &decoder, [&decoder]() { decoder.endStream(); });
+    QObject::connect(&video, &oaa::hu::VideoChannelHandler::videoFrameData,
+                     &decoder, [&decoder](std::shared_ptr<const QByteArray> data,
+                                          qint64 enqueueTimeNs, qint64 phoneTimestampUs) {
+                         decoder.decodeFrame(std::move(data), enqueueTimeNs, phoneTimestampUs);
+                     });
+    QObject::connect(&decoder, &oap::aa::VideoDecoder::frameReady,
+                     &decoder, [&decoder, &decodedFrames]() {
+                         if (decoder.takeLatestFrame().isValid())
+                             ++decodedFrames;
+                     });
+    replayer.registerChannel(oaa::ChannelId::Video, &video);
+
+    // Audio: the orchestrator's three AA streams.
+    std::unique_ptr<oap::AudioService> audio;
+    if (!parser.isSet(noAudioOption))
+        audio = std::make_unique<oap::AudioService>();
+    AudioSink sinks[] = {
+        {"AA Media", oaa::ChannelId::MediaAudio, 50, 48000, 2, nullptr},
+        {"AA Speech", oaa::ChannelId::SpeechAudio, 60, 48000, 1, nullptr},
+        {"AA System", oaa::ChannelId::SystemAudio, 40, 16000, 1, nullptr},
+    };
+    for (auto& sink : sinks) {
+        sink.handler = std::make_unique<oaa::hu::AudioChannelHandler>(sink.channelId);
+        if (audio) {
+            sink.stream = audio->createStream(QString::fromLatin1(sink.name), sink.priority,
+                                              sink.sampleRate, sink.channels);
+        }
+        QObject::connect(sink.handler.get(), &oaa::hu::AudioChannelHandler::audioDataReceived,
+                         &app, [&sink, &audio](const QByteArray& data, uint64_t) {
+                             sink.bytes += data.size();
+                             if (audio && sink.stream) {
+                                 audio->writeAudio(sink.stream,
+                                     reinterpret_cast<const uint8_t*>(data.constData()),
+                                     data.size());
+                             }
+                         });
+        replayer.registerChannel(sink.channelId, sink.handler.get());
+    }
+
+    if (!replayer.open(capturePath.toStdString())) {
+        qCritical().noquote() << "[Replay] cannot open" << capturePath << ":"
+                              << QString::fromStdString(replayer.error());
+        return 1;
+    }
+
+    QObject::connect(&replayer, &oaa::SessionReplayer::finished, &app, [&]() {
+        QTimer::singleShot(kDrainMs, &app, [&]() {
+            const auto& stats = replayer.stats();
+            const double captureSec = stats.captureUs / 1e6;
+            const double elapsedSec = stats.elapsedUs / 1e6;
+            qInfo().noquote() << QStringLiteral(
+                "[Replay] %1 records (%2 dispatched, %3 outbound skipped, %4 unhandled, "
+                "%9 capture gaps), capture=%5 s elapsed=%6 s (%7x), max_lag=%8 ms")
+                .arg(stats.records).arg(stats.dispatched).arg(stats.outboundSkipped)
+                .arg(stats.unhandled)
+                .arg(captureSec, 0, 'f', 1).arg(elapsedSec, 0, 'f', 1)
+                .arg(elapsedSec > 0 ? captureSec / elapsedSec : 0.0, 0, 'f', 1)
+                .arg(stats.maxLagUs / 1000.0, 0, 'f', 1)
+                .arg(stats.gaps);
+            qInfo().noquote() << QStringLiteral(
+                "[Replay] video: received=%1 decoded=%2 | audio bytes: media=%3 speech=%4 system=%5")
+                .arg(video.receivedFrameCount()).arg(decodedFrames)
+                .arg(sinks[0].bytes).arg(sinks[1].bytes).arg(sinks[2].bytes);
+            QCoreApplication::quit();
+        });
+    });
+    replayer.start();
+    const int rc = app.exec();
+
+    replayer.stop();
+    decoder.endStream();
+    if (audio) {
+        for (auto& sink : sinks)
+            audio->destroyStream(sink.stream);
+    }
+    return rc;
+}
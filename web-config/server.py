@@ -213,6 +213,11 @@ def api_set_logging():
     return jsonify(ipc_request("set_logging", data))
 
 
+@app.route("/api/metrics", methods=["GET"])
+def api_get_metrics():
+    return jsonify(ipc_request("get_metrics"))
+
+
 @app.route("/api/status", methods=["GET"])
 def api_status():
     return jsonify(ipc_request("status"))